@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/core.hpp>
+
+#include <random>
+
+using namespace aarith;
+
+template <size_t W> word_array<W> random_array(const unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    uniform_word_array_distribution<W> dist;
+    return dist(rng);
+}
+
+/**
+ * Extracting the masked bits one at a time (the baseline).
+ */
+template <size_t W> void extract_bitwise(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    const auto mask = random_array<W>(2);
+    for (auto _ : state)
+    {
+        word_array<W> result;
+        size_t position = 0;
+        for (size_t i = 0; i < W; ++i)
+        {
+            if (mask.bit(i))
+            {
+                result.set_bit(position++, value.bit(i));
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void extract(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    const auto mask = random_array<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(extract_bits(value, mask));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void deposit(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    const auto mask = random_array<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(deposit_bits(value, mask));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void reverse(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reverse_bits(value));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void swap_bytes(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(byte_swap(value));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void interleave(benchmark::State& state)
+{
+    const auto a = random_array<W>(1);
+    const auto b = random_array<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(interleave_bits(a, b));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 4));
+}
+
+template <size_t W> void deinterleave(benchmark::State& state)
+{
+    const auto value = random_array<W>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(deinterleave_bits(value));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+#define AARITH_BIT_BENCHMARK(fun)                                                                  \
+    BENCHMARK_TEMPLATE(fun, 64);                                                                   \
+    BENCHMARK_TEMPLATE(fun, 256);                                                                  \
+    BENCHMARK_TEMPLATE(fun, 1024)
+
+AARITH_BIT_BENCHMARK(extract_bitwise);
+AARITH_BIT_BENCHMARK(extract);
+AARITH_BIT_BENCHMARK(deposit);
+AARITH_BIT_BENCHMARK(reverse);
+AARITH_BIT_BENCHMARK(swap_bytes);
+AARITH_BIT_BENCHMARK(interleave);
+AARITH_BIT_BENCHMARK(deinterleave);
+
+BENCHMARK_MAIN();
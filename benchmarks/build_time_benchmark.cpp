@@ -0,0 +1,133 @@
+/**
+ * @file build_time_benchmark.cpp
+ *
+ * Measures the compile and link times of a selection of the tests, once instantiating all
+ * operations in every test and once using the explicit instantiations of the commonly used widths
+ * and formats (aarith/instantiations.hpp, compiled once like the aarith_instantiations library).
+ *
+ * Usage: build_time-benchmark [test source...]
+ *
+ * The tests are compiled without optimizations (like the test suite). Each test source is linked
+ * into an executable of its own.
+ */
+
+#include "command_timing.hpp"
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct build_time
+{
+    double compile{0.0};
+    double link{0.0};
+    std::uintmax_t bytes{0};
+
+    build_time& operator+=(const build_time& other)
+    {
+        compile += other.compile;
+        link += other.link;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+std::vector<std::string> split_list(const std::string& list)
+{
+    std::vector<std::string> result;
+    std::stringstream stream{list};
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        if (!item.empty())
+        {
+            result.push_back(item);
+        }
+    }
+    return result;
+}
+
+void report(const std::string& name, const std::string& mode, const build_time& time)
+{
+    std::cout << std::left << std::setw(40) << name << std::setw(14) << mode << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12) << time.compile
+              << std::setw(12) << time.link << std::setw(14) << time.bytes << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string source_dir{AARITH_SOURCE_DIR};
+    const std::string compiler = std::string{AARITH_CXX_COMPILER} + " -std=c++17 " +
+                                 AARITH_CXX_FLAGS + " -I" + source_dir + "/src -I" + source_dir +
+                                 "/lib/catch2 -I" + source_dir + "/tests/integer -I" +
+                                 source_dir + "/tests/float";
+    const std::string extern_flags = " -include aarith/instantiations.hpp -DAARITH_EXTERN_TEMPLATES";
+
+    std::vector<std::string> tests;
+    for (int i = 1; i < argc; ++i)
+    {
+        tests.emplace_back(argv[i]);
+    }
+    if (tests.empty())
+    {
+        for (const auto& test : split_list(AARITH_TEST_SOURCES))
+        {
+            tests.push_back(source_dir + "/" + test);
+        }
+    }
+
+    const fs::path dir = fs::temp_directory_path() / "aarith_build_time";
+    fs::create_directories(dir);
+    const std::string object = (dir / "test.o").string();
+    const std::string executable = (dir / "test").string();
+    const std::string main_object = (dir / "catch-main.o").string();
+    const std::string instantiations = (dir / "instantiations.o").string();
+
+    timed_command(compiler + " -c " + source_dir + "/lib/catch2/catch-main.cpp -o " + main_object);
+
+    std::cout << std::left << std::setw(40) << "test" << std::setw(14) << "mode" << std::right
+              << std::setw(12) << "compile [s]" << std::setw(12) << "link [s]" << std::setw(14)
+              << "size [bytes]"
+              << "\n";
+
+    build_time once;
+    once.compile = timed_command(compiler + " -c " + source_dir +
+                                 "/src/aarith/instantiations.cpp -o " + instantiations);
+    once.bytes = fs::file_size(instantiations);
+    report("aarith_instantiations (once)", "", once);
+
+    build_time total_implicit;
+    build_time total_extern = once;
+    for (const auto& test : tests)
+    {
+        const std::string name = fs::path{test}.filename().string();
+
+        build_time implicit;
+        implicit.compile = timed_command(compiler + " -c " + test + " -o " + object);
+        implicit.link = timed_command(compiler + " " + object + " " + main_object +
+                                      " -lpthread -o " + executable);
+        implicit.bytes = fs::file_size(executable);
+        report(name, "implicit", implicit);
+        total_implicit += implicit;
+
+        build_time external;
+        external.compile =
+            timed_command(compiler + extern_flags + " -c " + test + " -o " + object);
+        external.link = timed_command(compiler + " " + object + " " + main_object + " " +
+                                      instantiations + " -lpthread -o " + executable);
+        external.bytes = fs::file_size(executable);
+        report(name, "extern", external);
+        total_extern += external;
+    }
+
+    report("total", "implicit", total_implicit);
+    report("total", "extern", total_extern);
+
+    fs::remove_all(dir);
+    return EXIT_SUCCESS;
+}
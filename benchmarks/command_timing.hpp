@@ -0,0 +1,27 @@
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/**
+ * @file command_timing.hpp
+ *
+ * Helpers for the benchmarks measuring the build (instead of the execution) of code using aarith.
+ */
+
+/**
+ * @brief Runs a shell command and returns its wall-clock time in seconds, exits if it fails
+ */
+inline double timed_command(const std::string& command)
+{
+    const auto start = std::chrono::steady_clock::now();
+    if (std::system(command.c_str()) != 0)
+    {
+        std::cerr << "command failed: " << command << "\n";
+        std::exit(EXIT_FAILURE);
+    }
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    return duration.count();
+}
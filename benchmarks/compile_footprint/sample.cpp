@@ -0,0 +1,62 @@
+/**
+ * @file sample.cpp
+ *
+ * The translation unit compiled by the compile-footprint benchmark: it uses the typical
+ * operations on wide integers and quadruple precision floating-point numbers.
+ */
+
+#include <aarith/float.hpp>
+#include <aarith/integer.hpp>
+
+#include <string>
+
+using namespace aarith;
+
+using U = uinteger<4096>;
+using I = integer<4096>;
+using F = floating_point<15, 112>;
+
+U sample_add(const U& a, const U& b)
+{
+    return add(a, b) - b;
+}
+
+uinteger<8192> sample_mul(const U& a, const U& b)
+{
+    return expanding_mul(a, b);
+}
+
+U sample_div(const U& a, const U& b)
+{
+    return div(a, b) + remainder(a, b);
+}
+
+I sample_signed(const I& a, const I& b)
+{
+    return div(mul(a, b), b);
+}
+
+U sample_shift(const U& a, const size_t shift)
+{
+    return (a << shift) ^ (a >> shift);
+}
+
+bool sample_compare(const U& a, const U& b)
+{
+    return a < b || count_leading_zeroes(a) > count_leading_zeroes(b);
+}
+
+std::string sample_string(const U& a)
+{
+    return to_decimal(a);
+}
+
+F sample_float(const F& a, const F& b)
+{
+    return (a + b) * (a - b) / b;
+}
+
+uinteger<2048> sample_karazuba(const uinteger<1024>& a, const uinteger<1024>& b)
+{
+    return expanding_karazuba(a, b);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file compile_footprint_benchmark.cpp
+ *
+ * Measures the compile time and the object size of a translation unit using wide integers and
+ * quadruple precision floating-point numbers (compile_footprint/sample.cpp), once with the limb
+ * kernels defined inline in the headers and once with the kernels compiled separately into the
+ * aarith_kernels library.
+ *
+ * Usage: compile_footprint-benchmark [include directory of another aarith checkout]
+ *
+ * If another include directory is given, the header-only compilation against it is measured as
+ * baseline as well.
+ */
+
+#include "command_timing.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct footprint
+{
+    double seconds;
+    std::uintmax_t bytes;
+};
+
+/**
+ * Compiles a source file the given number of times, returns the fastest compile time and the
+ * size of the object file.
+ */
+footprint compile(const std::string& source, const std::string& flags, const size_t repetitions)
+{
+    const fs::path object = fs::temp_directory_path() / "aarith_compile_footprint.o";
+    const std::string command =
+        std::string{AARITH_CXX_COMPILER} + " -std=c++17 " + flags + " -c " + source + " -o " +
+        object.string();
+
+    double fastest = 0.0;
+    for (size_t i = 0; i < repetitions; ++i)
+    {
+        const double seconds = timed_command(command);
+        fastest = i == 0 ? seconds : std::min(fastest, seconds);
+    }
+
+    const footprint result{fastest, fs::file_size(object)};
+    fs::remove(object);
+    return result;
+}
+
+int main(int argc, char* argv[])
+{
+    constexpr size_t repetitions = 3;
+
+    const std::string include{AARITH_INCLUDE_DIR};
+    const std::string sample{AARITH_SAMPLE_SOURCE};
+    const std::string kernels = include + "/aarith/core/limb_kernels.cpp";
+
+    std::cout << std::left << std::setw(28) << "configuration" << std::setw(8) << "flags"
+              << std::right << std::setw(14) << "time [s]" << std::setw(14) << "size [bytes]"
+              << "\n";
+
+    const auto report = [](const std::string& name, const std::string& level, const footprint f) {
+        std::cout << std::left << std::setw(28) << name << std::setw(8) << level << std::right
+                  << std::setw(14) << std::fixed << std::setprecision(2) << f.seconds
+                  << std::setw(14) << f.bytes << "\n";
+    };
+
+    for (const std::string level : {"-O0", "-O2"})
+    {
+        if (argc > 1)
+        {
+            report("baseline", level,
+                   compile(sample, level + " -I" + std::string{argv[1]}, repetitions));
+        }
+        report("header-only", level, compile(sample, level + " -I" + include, repetitions));
+        report("separate kernels", level,
+               compile(sample, level + " -DAARITH_SEPARATE_KERNELS -I" + include, repetitions));
+        // compiled once per program, not once per translation unit
+        report("  + aarith_kernels", level,
+               compile(kernels, level + " -DAARITH_SEPARATE_KERNELS -I" + include, 1));
+    }
+
+    return EXIT_SUCCESS;
+}
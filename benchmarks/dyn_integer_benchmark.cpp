@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/integer.hpp>
+
+#include <random>
+
+using namespace aarith;
+
+template <size_t W> uinteger<W> random_value(const unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    uniform_word_array_distribution<W> dist;
+    return uinteger<W>{dist(rng)};
+}
+
+/**
+ * The fixed-width operations (the baseline for the runtime-width operations).
+ */
+template <size_t W> void fixed_add(benchmark::State& state)
+{
+    const auto a = random_value<W>(1);
+    const auto b = random_value<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(add(a, b));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void dyn_add(benchmark::State& state)
+{
+    const dyn_uinteger a{random_value<W>(1)};
+    const dyn_uinteger b{random_value<W>(2)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(add(a, b));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void fixed_mul(benchmark::State& state)
+{
+    const auto a = random_value<W>(1);
+    const auto b = random_value<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mul(a, b));
+    }
+}
+
+template <size_t W> void dyn_mul(benchmark::State& state)
+{
+    const dyn_uinteger a{random_value<W>(1)};
+    const dyn_uinteger b{random_value<W>(2)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mul(a, b));
+    }
+}
+
+template <size_t W> void fixed_div(benchmark::State& state)
+{
+    const auto a = random_value<W>(1);
+    const auto b = random_value<W>(2) >> (W / 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(div(a, b));
+    }
+}
+
+template <size_t W> void dyn_div(benchmark::State& state)
+{
+    const dyn_uinteger a{random_value<W>(1)};
+    const dyn_uinteger b{random_value<W>(2) >> (W / 2)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(div(a, b));
+    }
+}
+
+#define AARITH_DYN_BENCHMARK(fun)                                                                  \
+    BENCHMARK_TEMPLATE(fun, 64);                                                                   \
+    BENCHMARK_TEMPLATE(fun, 256);                                                                  \
+    BENCHMARK_TEMPLATE(fun, 1024);                                                                 \
+    BENCHMARK_TEMPLATE(fun, 4096)
+
+AARITH_DYN_BENCHMARK(fixed_add);
+AARITH_DYN_BENCHMARK(dyn_add);
+AARITH_DYN_BENCHMARK(fixed_mul);
+AARITH_DYN_BENCHMARK(dyn_mul);
+AARITH_DYN_BENCHMARK(fixed_div);
+AARITH_DYN_BENCHMARK(dyn_div);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,784 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/float.hpp>
+#include <aarith/float/approx_operations.hpp>
+
+#include "perf_counters.hpp"
+
+#ifdef AARITH_BENCHMARK_MPFR
+#include <gmp.h>
+#include <mpfr.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace aarith; // NOLINT
+
+/*
+ * The throughput of the floating-point operations for common and exotic formats.
+ *
+ * Every benchmark runs its operation on a batch of pre-generated random operands that are drawn in
+ * one of the modes of floating_point_distribution (the mode is the last part of the name), so the
+ * cost of, e.g., subnormal or special operands shows up in separate rows. The rows of float and
+ * double and of MPFR (if found, computing at the same precision and exponent range including the
+ * emulation of subnormal numbers) use the same operands and names, e.g.,
+ * "Add/float8_23/NonSpecial", "Add/float/NonSpecial" and "Add/mpfr8_23/NonSpecial".
+ *
+ * The target float-timing-json writes the results (with repetitions) to float-timing.json.
+ */
+
+namespace aarith::helpers {
+
+constexpr size_t batch_size = 1024;
+
+template <FloatGenerationModes Mode> [[nodiscard]] constexpr const char* mode_name()
+{
+    switch (Mode)
+    {
+    case FloatGenerationModes::NormalizedOnly:
+        return "NormalizedOnly";
+    case FloatGenerationModes::DenormalizedOnly:
+        return "DenormalizedOnly";
+    case FloatGenerationModes::NormalizedAndSpecial:
+        return "NormalizedAndSpecial";
+    case FloatGenerationModes::NonSpecial:
+        return "NonSpecial";
+    case FloatGenerationModes::FullyRandom:
+        return "FullyRandom";
+    case FloatGenerationModes::Special:
+        return "Special";
+    case FloatGenerationModes::LogUniform:
+        return "LogUniform";
+    case FloatGenerationModes::UlpNeighbourhood:
+        return "UlpNeighbourhood";
+    case FloatGenerationModes::NearTie:
+        return "NearTie";
+    }
+    return "";
+}
+
+template <size_t E, size_t M> [[nodiscard]] std::string format_name(const std::string& prefix)
+{
+    return prefix + std::to_string(E) + "_" + std::to_string(M);
+}
+
+/**
+ * The floating-point format of a native type
+ */
+template <class T> struct native_format;
+
+template <> struct native_format<float>
+{
+    using type = floating_point<8, 23>;
+};
+
+template <> struct native_format<double>
+{
+    using type = floating_point<11, 52>;
+};
+
+/**
+ * Random operands, the stream distinguishes the operands of an operation
+ *
+ * In the mode UlpNeighbourhood, the numbers are at most 16 ULPs away from one (i.e., additions and
+ * subtractions cancel most bits).
+ */
+template <size_t E, size_t M, FloatGenerationModes Mode>
+[[nodiscard]] std::vector<floating_point<E, M>> random_operands(const uint64_t stream)
+{
+    using F = floating_point<E, M>;
+
+    philox4x64 rng{philox4x64::default_seed, stream};
+    std::vector<F> operands(batch_size);
+    if constexpr (Mode == FloatGenerationModes::UlpNeighbourhood)
+    {
+        floating_point_distribution<E, M, Mode> distribution{F::one(), 16};
+        distribution.generate(operands.begin(), operands.end(), rng);
+    }
+    else
+    {
+        floating_point_distribution<E, M, Mode> distribution;
+        distribution.generate(operands.begin(), operands.end(), rng);
+    }
+    return operands;
+}
+
+/**
+ * The same random operands as floating_points or as native floats
+ */
+template <class T, FloatGenerationModes Mode>
+[[nodiscard]] std::vector<T> random_operands_of(const uint64_t stream)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        using F = typename native_format<T>::type;
+        const auto operands =
+            random_operands<F::exponent_width(), F::mantissa_width(), Mode>(stream);
+        std::vector<T> natives;
+        for (const auto& operand : operands)
+        {
+            natives.push_back(static_cast<T>(operand));
+        }
+        return natives;
+    }
+    else
+    {
+        return random_operands<T::exponent_width(), T::mantissa_width(), Mode>(stream);
+    }
+}
+
+void set_throughput(benchmark::State& state)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch_size));
+}
+
+template <class T, class Op, FloatGenerationModes Mode> void binary(benchmark::State& state)
+{
+    const auto lhs = random_operands_of<T, Mode>(0);
+    const auto rhs = random_operands_of<T, Mode>(1);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            const auto result = Op::compute(lhs[i], rhs[i]);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+template <class T, class Op, FloatGenerationModes Mode> void unary(benchmark::State& state)
+{
+    const auto operands = random_operands_of<T, Mode>(0);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (const auto& operand : operands)
+        {
+            const auto result = Op::compute(operand);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+struct Add
+{
+    static constexpr const char* name = "Add";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        return a + b;
+    }
+};
+
+struct Sub
+{
+    static constexpr const char* name = "Sub";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        return a - b;
+    }
+};
+
+struct Mul
+{
+    static constexpr const char* name = "Mul";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        return a * b;
+    }
+};
+
+struct Div
+{
+    static constexpr const char* name = "Div";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        return a / b;
+    }
+};
+
+struct Less
+{
+    static constexpr const char* name = "Less";
+
+    template <class T> static bool compute(const T& a, const T& b)
+    {
+        return a < b;
+    }
+};
+
+struct Equal
+{
+    static constexpr const char* name = "Equal";
+
+    template <class T> static bool compute(const T& a, const T& b)
+    {
+        return a == b;
+    }
+};
+
+struct TotalOrder
+{
+    static constexpr const char* name = "TotalOrder";
+
+    template <size_t E, size_t M>
+    static bool compute(const floating_point<E, M>& a, const floating_point<E, M>& b)
+    {
+        return totalOrder(a, b);
+    }
+};
+
+struct ToDouble
+{
+    static constexpr const char* name = "ToDouble";
+
+    template <size_t E, size_t M> static double compute(const floating_point<E, M>& a)
+    {
+        return static_cast<double>(a);
+    }
+};
+
+/**
+ * Conversion from the (exactly representable) double values of the numbers
+ */
+struct FromDouble
+{
+    static constexpr const char* name = "FromDouble";
+
+    template <class T> static T compute(const double a)
+    {
+        return T{a};
+    }
+};
+
+/**
+ * Conversion to the binary128 format of IEEE-754
+ */
+struct ToQuadruple
+{
+    static constexpr const char* name = "ToQuadruple";
+
+    template <size_t E, size_t M>
+    static floating_point<15, 112> compute(const floating_point<E, M>& a)
+    {
+        return width_cast<15, 112>(a);
+    }
+};
+
+struct Normalize
+{
+    static constexpr const char* name = "Normalize";
+
+    template <size_t E, size_t M>
+    static floating_point<E, M> compute(const floating_point<E, M>& a)
+    {
+        return normalize<E, M, M>(a);
+    }
+};
+
+struct ToSciString
+{
+    static constexpr const char* name = "ToSciString";
+
+    template <size_t E, size_t M> static std::string compute(const floating_point<E, M>& a)
+    {
+        return to_sci_string(a);
+    }
+
+    template <class T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+    static std::string compute(const T a)
+    {
+        // the shortest precision that always round-trips
+        constexpr int digits = std::numeric_limits<T>::max_digits10;
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.*e", digits - 1, static_cast<double>(a));
+        return std::string{buffer};
+    }
+};
+
+struct ToHex
+{
+    static constexpr const char* name = "ToHex";
+
+    template <size_t E, size_t M> static std::string compute(const floating_point<E, M>& a)
+    {
+        return to_hex(a);
+    }
+};
+
+/**
+ * Conversions from double need the operands as doubles, i.e., formats that fit into double
+ */
+template <size_t E, size_t M, FloatGenerationModes Mode> void from_double(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    const auto operands = random_operands<E, M, Mode>(0);
+    std::vector<double> doubles;
+    for (const auto& operand : operands)
+    {
+        doubles.push_back(static_cast<double>(operand));
+    }
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (const double operand : doubles)
+        {
+            const auto result = FromDouble::compute<F>(operand);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+struct AnytimeAdd
+{
+    static constexpr const char* name = "AnytimeAdd";
+
+    template <size_t M> static constexpr unsigned int precise_bits = M + 1;
+
+    template <size_t E, size_t M>
+    static floating_point<E, M> compute(const floating_point<E, M>& a,
+                                        const floating_point<E, M>& b, const unsigned int bits)
+    {
+        return anytime_add(a, b, bits);
+    }
+};
+
+struct AnytimeSub
+{
+    static constexpr const char* name = "AnytimeSub";
+
+    template <size_t M> static constexpr unsigned int precise_bits = M + 1;
+
+    template <size_t E, size_t M>
+    static floating_point<E, M> compute(const floating_point<E, M>& a,
+                                        const floating_point<E, M>& b, const unsigned int bits)
+    {
+        return anytime_sub(a, b, bits);
+    }
+};
+
+struct AnytimeMul
+{
+    static constexpr const char* name = "AnytimeMul";
+
+    template <size_t M> static constexpr unsigned int precise_bits = 2 * M;
+
+    template <size_t E, size_t M>
+    static floating_point<E, M> compute(const floating_point<E, M>& a,
+                                        const floating_point<E, M>& b, const unsigned int bits)
+    {
+        return anytime_mul(a, b, bits);
+    }
+};
+
+struct AnytimeDiv
+{
+    static constexpr const char* name = "AnytimeDiv";
+
+    template <size_t M> static constexpr unsigned int precise_bits = M + 1;
+
+    template <size_t E, size_t M>
+    static floating_point<E, M> compute(const floating_point<E, M>& a,
+                                        const floating_point<E, M>& b, const unsigned int bits)
+    {
+        return anytime_div(a, b, bits);
+    }
+};
+
+/**
+ * Anytime operations computing the given number of most-significant bits (the argument)
+ */
+template <size_t E, size_t M, class Op> void anytime(benchmark::State& state)
+{
+    const auto lhs = random_operands<E, M, FloatGenerationModes::NonSpecial>(0);
+    const auto rhs = random_operands<E, M, FloatGenerationModes::NonSpecial>(1);
+    const auto bits = static_cast<unsigned int>(state.range(0));
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            const auto result = Op::compute(lhs[i], rhs[i], bits);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+/**
+ * Additions with the FAU adder splitting the mantissa addition at LSP bits and predicting the carry
+ * from Shared bits
+ */
+template <size_t E, size_t M, size_t LSP, size_t Shared> void fau_add(benchmark::State& state)
+{
+    const auto lhs = random_operands<E, M, FloatGenerationModes::NonSpecial>(0);
+    const auto rhs = random_operands<E, M, FloatGenerationModes::NonSpecial>(1);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            const auto result = FAU_add<E, M, LSP, Shared>(lhs[i], rhs[i]);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+template <class T, class Op, FloatGenerationModes Mode>
+void register_binary(const std::string& type)
+{
+    benchmark::RegisterBenchmark(
+        (std::string{Op::name} + "/" + type + "/" + mode_name<Mode>()).c_str(),
+        &binary<T, Op, Mode>);
+}
+
+template <class T, class Op, FloatGenerationModes Mode>
+void register_unary(const std::string& type)
+{
+    benchmark::RegisterBenchmark(
+        (std::string{Op::name} + "/" + type + "/" + mode_name<Mode>()).c_str(),
+        &unary<T, Op, Mode>);
+}
+
+/**
+ * The arithmetic and the comparisons for the operands of all modes
+ */
+template <class T, FloatGenerationModes... Modes>
+void register_arithmetic_in_modes(const std::string& type)
+{
+    (register_binary<T, Add, Modes>(type), ...);
+    (register_binary<T, Sub, Modes>(type), ...);
+    (register_binary<T, Mul, Modes>(type), ...);
+    (register_binary<T, Div, Modes>(type), ...);
+    (register_binary<T, Less, Modes>(type), ...);
+    (register_binary<T, Equal, Modes>(type), ...);
+}
+
+template <class T> void register_arithmetic(const std::string& type)
+{
+    using Modes = FloatGenerationModes;
+    register_arithmetic_in_modes<T, Modes::NormalizedOnly, Modes::DenormalizedOnly,
+                                 Modes::NormalizedAndSpecial, Modes::NonSpecial,
+                                 Modes::FullyRandom, Modes::Special, Modes::LogUniform,
+                                 Modes::UlpNeighbourhood, Modes::NearTie>(type);
+}
+
+template <size_t E, size_t M> void register_float_benchmarks()
+{
+    using F = floating_point<E, M>;
+    using Modes = FloatGenerationModes;
+    const std::string type = format_name<E, M>("float");
+
+    register_arithmetic<F>(type);
+    register_binary<F, TotalOrder, Modes::FullyRandom>(type);
+
+    if constexpr (E <= 11 && M <= 52)
+    {
+        register_unary<F, ToDouble, Modes::NonSpecial>(type);
+        benchmark::RegisterBenchmark(("FromDouble/" + type + "/NonSpecial").c_str(),
+                                     &from_double<E, M, Modes::NonSpecial>);
+    }
+    if constexpr (E < 15 && M < 112)
+    {
+        register_unary<F, ToQuadruple, Modes::NonSpecial>(type);
+    }
+    register_unary<F, Normalize, Modes::NonSpecial>(type);
+    register_unary<F, Normalize, Modes::DenormalizedOnly>(type);
+    register_unary<F, ToSciString, Modes::NonSpecial>(type);
+    register_unary<F, ToHex, Modes::NonSpecial>(type);
+}
+
+template <size_t E, size_t M, class Op> void register_anytime(const std::string& type)
+{
+    constexpr auto precise_bits = static_cast<int64_t>(Op::template precise_bits<M>);
+    benchmark::RegisterBenchmark((std::string{Op::name} + "/" + type).c_str(), &anytime<E, M, Op>)
+        ->ArgName("bits")
+        ->Arg(precise_bits)
+        ->Arg(precise_bits / 2)
+        ->Arg(precise_bits / 4);
+}
+
+template <size_t E, size_t M> void register_approximate_benchmarks()
+{
+    const std::string type = format_name<E, M>("float");
+    register_anytime<E, M, AnytimeAdd>(type);
+    register_anytime<E, M, AnytimeSub>(type);
+    register_anytime<E, M, AnytimeMul>(type);
+    register_anytime<E, M, AnytimeDiv>(type);
+}
+
+template <size_t E, size_t M, size_t LSP, size_t Shared> void register_fau_add()
+{
+    const std::string name = "FAUAdd/" + format_name<E, M>("float") +
+                             "/lsp:" + std::to_string(LSP) + "/shared:" + std::to_string(Shared);
+    benchmark::RegisterBenchmark(name.c_str(), &fau_add<E, M, LSP, Shared>);
+}
+
+template <class T> void register_native_benchmarks(const std::string& type)
+{
+    register_arithmetic<T>(type);
+    register_unary<T, ToSciString, FloatGenerationModes::NonSpecial>(type);
+}
+
+#ifdef AARITH_BENCHMARK_MPFR
+
+/**
+ * Sets the exponent range of MPFR to the one of the format (and restores the previous one)
+ */
+template <size_t E, size_t M> class mpfr_exponent_range
+{
+public:
+    mpfr_exponent_range()
+        : old_emin(mpfr_get_emin())
+        , old_emax(mpfr_get_emax())
+    {
+        constexpr int64_t bias = (int64_t{1} << (E - 1)) - 1;
+        mpfr_set_emin(2 - bias - static_cast<int64_t>(M));
+        mpfr_set_emax(bias + 1);
+    }
+
+    mpfr_exponent_range(const mpfr_exponent_range&) = delete;
+    mpfr_exponent_range& operator=(const mpfr_exponent_range&) = delete;
+
+    ~mpfr_exponent_range()
+    {
+        mpfr_set_emin(old_emin);
+        mpfr_set_emax(old_emax);
+    }
+
+private:
+    mpfr_exp_t old_emin;
+    mpfr_exp_t old_emax;
+};
+
+/**
+ * MPFR numbers with the values of floating_points (at the precision of the floating_points)
+ */
+template <size_t E, size_t M> class mpfr_buffer
+{
+public:
+    explicit mpfr_buffer(const std::vector<floating_point<E, M>>& values)
+        : size(values.size())
+        , numbers(new mpfr_t[values.size()])
+    {
+        constexpr int64_t bias = (int64_t{1} << (E - 1)) - 1;
+
+        mpz_t mantissa;
+        mpz_init(mantissa);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto& value = values[i];
+            const int sign = value.is_negative() ? -1 : 1;
+
+            mpfr_init2(numbers[i], M + 1);
+            if (value.is_nan())
+            {
+                mpfr_set_nan(numbers[i]);
+            }
+            else if (value.is_inf())
+            {
+                mpfr_set_inf(numbers[i], sign);
+            }
+            else if (value.is_zero())
+            {
+                mpfr_set_zero(numbers[i], sign);
+            }
+            else
+            {
+                // the value is the full mantissa times 2^(exponent - bias - M), subnormal numbers
+                // have the exponent of the smallest normal numbers
+                const auto full_mantissa = value.get_full_mantissa();
+                const auto exponent = std::max<int64_t>(
+                    static_cast<int64_t>(static_cast<uint64_t>(value.get_exponent())), 1);
+                mpz_import(mantissa, full_mantissa.word_count(), -1, sizeof(uint64_t), 0, 0,
+                           full_mantissa.data());
+                mpfr_set_z_2exp(numbers[i], mantissa, exponent - bias - static_cast<int64_t>(M),
+                                MPFR_RNDN);
+                if (sign < 0)
+                {
+                    mpfr_neg(numbers[i], numbers[i], MPFR_RNDN);
+                }
+            }
+        }
+        mpz_clear(mantissa);
+    }
+
+    mpfr_buffer(const mpfr_buffer&) = delete;
+    mpfr_buffer& operator=(const mpfr_buffer&) = delete;
+
+    ~mpfr_buffer()
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            mpfr_clear(numbers[i]);
+        }
+    }
+
+    mpfr_srcptr operator[](const size_t i) const
+    {
+        return numbers[i];
+    }
+
+private:
+    size_t size;
+    std::unique_ptr<mpfr_t[]> numbers;
+};
+
+struct mpfr_operation
+{
+    static int compute(Add, mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b)
+    {
+        return mpfr_add(r, a, b, MPFR_RNDN);
+    }
+
+    static int compute(Sub, mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b)
+    {
+        return mpfr_sub(r, a, b, MPFR_RNDN);
+    }
+
+    static int compute(Mul, mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b)
+    {
+        return mpfr_mul(r, a, b, MPFR_RNDN);
+    }
+
+    static int compute(Div, mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr b)
+    {
+        return mpfr_div(r, a, b, MPFR_RNDN);
+    }
+};
+
+template <size_t E, size_t M, class Op, FloatGenerationModes Mode>
+void mpfr_binary(benchmark::State& state)
+{
+    const mpfr_exponent_range<E, M> range;
+    const mpfr_buffer<E, M> a{random_operands<E, M, Mode>(0)};
+    const mpfr_buffer<E, M> b{random_operands<E, M, Mode>(1)};
+
+    mpfr_t r;
+    mpfr_init2(r, M + 1);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            const int ternary = mpfr_operation::compute(Op{}, r, a[i], b[i]);
+            benchmark::DoNotOptimize(mpfr_subnormalize(r, ternary, MPFR_RNDN));
+        }
+    }
+    counters.report(state, batch_size);
+    mpfr_clear(r);
+    set_throughput(state);
+}
+
+template <size_t E, size_t M, FloatGenerationModes Mode>
+void mpfr_to_sci_string(benchmark::State& state)
+{
+    const mpfr_exponent_range<E, M> range;
+    const mpfr_buffer<E, M> a{random_operands<E, M, Mode>(0)};
+
+    mpfr_exp_t exponent;
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            char* digits = mpfr_get_str(nullptr, &exponent, 10, 0, a[i], MPFR_RNDN);
+            benchmark::DoNotOptimize(digits);
+            mpfr_free_str(digits);
+        }
+    }
+    counters.report(state, batch_size);
+    set_throughput(state);
+}
+
+template <size_t E, size_t M, class Op, FloatGenerationModes Mode>
+void register_mpfr_binary(const std::string& type)
+{
+    benchmark::RegisterBenchmark(
+        (std::string{Op::name} + "/" + type + "/" + mode_name<Mode>()).c_str(),
+        &mpfr_binary<E, M, Op, Mode>);
+}
+
+template <size_t E, size_t M, FloatGenerationModes... Modes> void register_mpfr_in_modes()
+{
+    const std::string type = format_name<E, M>("mpfr");
+    (register_mpfr_binary<E, M, Add, Modes>(type), ...);
+    (register_mpfr_binary<E, M, Sub, Modes>(type), ...);
+    (register_mpfr_binary<E, M, Mul, Modes>(type), ...);
+    (register_mpfr_binary<E, M, Div, Modes>(type), ...);
+    benchmark::RegisterBenchmark(("ToSciString/" + type + "/NonSpecial").c_str(),
+                                 &mpfr_to_sci_string<E, M, FloatGenerationModes::NonSpecial>);
+}
+
+template <size_t E, size_t M> void register_mpfr_benchmarks()
+{
+    using Modes = FloatGenerationModes;
+    register_mpfr_in_modes<E, M, Modes::NormalizedOnly, Modes::DenormalizedOnly,
+                           Modes::NormalizedAndSpecial, Modes::NonSpecial, Modes::FullyRandom,
+                           Modes::Special, Modes::LogUniform, Modes::UlpNeighbourhood,
+                           Modes::NearTie>();
+}
+
+#endif
+} // namespace aarith::helpers
+
+int main(int argc, char** argv)
+{
+    using namespace aarith::helpers; // NOLINT
+
+    // IEEE-754 binary16, bfloat16, binary32, binary64 and binary128
+    register_float_benchmarks<5, 10>();
+    register_float_benchmarks<8, 7>();
+    register_float_benchmarks<8, 23>();
+    register_float_benchmarks<11, 52>();
+    register_float_benchmarks<15, 112>();
+    // the 8-bit formats E4M3 and E5M2 and a format with a 256-bit encoding
+    register_float_benchmarks<4, 3>();
+    register_float_benchmarks<5, 2>();
+    register_float_benchmarks<19, 236>();
+
+    register_native_benchmarks<float>("float");
+    register_native_benchmarks<double>("double");
+
+    register_approximate_benchmarks<5, 10>();
+    register_approximate_benchmarks<8, 23>();
+    register_approximate_benchmarks<11, 52>();
+    register_fau_add<8, 23, 8, 2>();
+    register_fau_add<8, 23, 12, 4>();
+    register_fau_add<8, 23, 16, 8>();
+    register_fau_add<11, 52, 26, 4>();
+    register_fau_add<11, 52, 40, 8>();
+
+#ifdef AARITH_BENCHMARK_MPFR
+    register_mpfr_benchmarks<5, 10>();
+    register_mpfr_benchmarks<8, 7>();
+    register_mpfr_benchmarks<8, 23>();
+    register_mpfr_benchmarks<11, 52>();
+    register_mpfr_benchmarks<15, 112>();
+    register_mpfr_benchmarks<4, 3>();
+    register_mpfr_benchmarks<5, 2>();
+    register_mpfr_benchmarks<19, 236>();
+#endif
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+}
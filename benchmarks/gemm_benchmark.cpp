@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/float.hpp>
+#include <aarith/integer.hpp>
+#include <aarith/linalg.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+template <class T> auto random_matrix(const size_t size, const unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    std::vector<T> values;
+    values.reserve(size);
+    if constexpr (is_float_v<T>)
+    {
+        std::uniform_real_distribution<double> dist{-1.0, 1.0};
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.emplace_back(dist(rng));
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<int> dist{-100, 100}; // NOLINT
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.emplace_back(dist(rng));
+        }
+    }
+    return values;
+}
+
+/**
+ * Square matrix multiplication using the textbook triple loop.
+ */
+template <class Strategy> void naive_gemm(benchmark::State& state)
+{
+    using Element = typename Strategy::element_type;
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto a = random_matrix<Element>(n * n, 1);
+    const auto b = random_matrix<Element>(n * n, 2);
+    std::vector<typename Strategy::result_type> c(n * n);
+    const Strategy strategy;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = 0; j < n; ++j)
+            {
+                auto acc = strategy.zero();
+                for (size_t p = 0; p < n; ++p)
+                {
+                    strategy.multiply_accumulate(acc, a[i * n + p], b[p * n + j]);
+                }
+                c[i * n + j] = strategy.finalize(acc);
+            }
+        }
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n * n * n));
+}
+
+/**
+ * Square matrix multiplication using the blocked, multi-threaded gemm.
+ */
+template <class Strategy> void blocked_gemm(benchmark::State& state)
+{
+    using Element = typename Strategy::element_type;
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto a = random_matrix<Element>(n * n, 1);
+    const auto b = random_matrix<Element>(n * n, 2);
+    std::vector<typename Strategy::result_type> c(n * n);
+    thread_pool pool{static_cast<size_t>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        gemm<Strategy>(n, n, n, a.data(), n, b.data(), n, c.data(), n, Strategy{}, pool);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n * n * n));
+}
+
+using int8_strategy = exact_arithmetic<integer<8>, integer<32>>;
+using int24_strategy = exact_arithmetic<integer<24>, integer<128>>;
+using float_strategy = exact_arithmetic<floating_point<8, 23>>;
+using kulisch_strategy = kulisch_arithmetic<8, 23>;
+
+BENCHMARK_TEMPLATE(naive_gemm, int8_strategy)->Arg(128);
+BENCHMARK_TEMPLATE(blocked_gemm, int8_strategy)->Args({128, 1})->Args({128, 4})->UseRealTime();
+BENCHMARK_TEMPLATE(naive_gemm, int24_strategy)->Arg(64);
+BENCHMARK_TEMPLATE(blocked_gemm, int24_strategy)->Args({64, 1})->Args({64, 4})->UseRealTime();
+BENCHMARK_TEMPLATE(naive_gemm, float_strategy)->Arg(64);
+BENCHMARK_TEMPLATE(blocked_gemm, float_strategy)->Args({64, 1})->Args({64, 4})->UseRealTime();
+BENCHMARK_TEMPLATE(naive_gemm, kulisch_strategy)->Arg(32);
+BENCHMARK_TEMPLATE(blocked_gemm, kulisch_strategy)->Args({32, 1})->Args({32, 4})->UseRealTime();
+
+BENCHMARK_MAIN();
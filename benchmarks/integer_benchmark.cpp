@@ -2,632 +2,802 @@
 
 #include <aarith/integer.hpp>
 
-#include <chrono>
-#include <iostream>
+#include "perf_counters.hpp"
+
+#ifdef AARITH_BENCHMARK_MPIR
+#include <mpir.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <random>
 #include <string>
-#include <tuple>
+#include <type_traits>
+#include <vector>
 
-using namespace std;               // NOLINT
 using namespace aarith;            // NOLINT
 using namespace integer_operators; // NOLINT
 
+/*
+ * The throughput of the integer operations for widths from 8 to 65536 bits.
+ *
+ * Every benchmark runs its operation on buffers of pre-generated random operands (the same ones in
+ * every run), so neither the generation of the operands nor a loop-carried dependency is part of
+ * the measurement. The counters give the operations per second (items_per_second) and the bits of
+ * operands per second (bits_per_second). The rows of the native integers and of MPIR (if found)
+ * use the same operands and names, e.g., "Add/uinteger/64", "Add/uint64_t" and "Add/mpz/64".
+ *
+ * The target integer-timing-json writes the results (with repetitions) to integer-timing.json so
+ * they can be compared across commits, e.g., with compare.py of Google Benchmark. The environment
+ * variable BENCHMARK_FILTER selects a part of the matrix, e.g., BENCHMARK_FILTER='/uinteger/64$'.
+ */
+
 namespace aarith::helpers {
 
-template <typename Op> void generic_arithmetic(benchmark::State& state) // NOLINT
+__extension__ using uint128_t = unsigned __int128;
+
+/**
+ * The number of operands in a buffer: at most 128 KiB of each operand, at least 16 operands
+ */
+[[nodiscard]] constexpr size_t buffer_size(const size_t width)
 {
-    using namespace std; // NOLINT
-    using I = typename Op::Type;
+    return std::clamp<size_t>((size_t{1} << 20U) / width, 16, 1024);
+}
 
-    I one;
+template <class T> [[nodiscard]] constexpr size_t width_of()
+{
+    if constexpr (is_integral_v<T>)
+    {
+        return T::width();
+    }
+    else
+    {
+        return 8 * sizeof(T);
+    }
+}
 
-    if constexpr (aarith::is_integral_v<I>)
+template <class T> [[nodiscard]] T random_operand(xoshiro256starstar& rng)
+{
+    if constexpr (is_integral_v<T>)
     {
-        one = I::one();
+        uniform_word_array_distribution<T::width()> distribution;
+        return T{distribution(rng)};
+    }
+    else if constexpr (sizeof(T) > sizeof(uint64_t))
+    {
+        return (T{rng()} << 64U) | T{rng()};
     }
     else
     {
-        one = static_cast<I>(1);
+        return static_cast<T>(rng());
     }
+}
+
+/**
+ * The left operands (random numbers) and the right operands of an operation (the operation
+ * derives them from random numbers)
+ */
+template <class Op, class T> [[nodiscard]] auto random_operands()
+{
+    constexpr size_t n = buffer_size(width_of<T>());
 
+    xoshiro256starstar rng;
+    std::vector<T> lhs;
+    std::vector<decltype(Op::rhs(std::declval<T>(), std::declval<T>()))> rhs;
+    for (size_t i = 0; i < n; ++i)
+    {
+        lhs.push_back(random_operand<T>(rng));
+        rhs.push_back(Op::rhs(lhs.back(), random_operand<T>(rng)));
+    }
+    return std::make_pair(lhs, rhs);
+}
+
+void set_throughput(benchmark::State& state, const size_t operations, const size_t width)
+{
+    const auto total = static_cast<double>(state.iterations()) * static_cast<double>(operations);
+    state.SetItemsProcessed(static_cast<int64_t>(total));
+    state.counters["bits_per_second"] =
+        benchmark::Counter(total * static_cast<double>(width), benchmark::Counter::kIsRate);
+}
+
+template <class Op, class T> void binary_throughput(benchmark::State& state)
+{
+    const auto [lhs, rhs] = random_operands<Op, T>();
+    const perf_counters counters;
     for (auto _ : state)
     {
-        for (I a = std::numeric_limits<I>::min(); a != std::numeric_limits<I>::max(); a = a + one)
+        for (size_t i = 0; i < lhs.size(); ++i)
         {
+            const auto result = Op::compute(lhs[i], rhs[i]);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, lhs.size());
+    set_throughput(state, lhs.size(), width_of<T>());
+}
 
-            for (I b = std::numeric_limits<I>::min(); b != std::numeric_limits<I>::max();
-                 b = b + one)
-            {
-                benchmark::DoNotOptimize(Op::compute(a, b)); // NOLINT
-            }
+template <class Op, class T> void unary_throughput(benchmark::State& state)
+{
+    const auto operands = random_operands<Op, T>().first;
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (const auto& operand : operands)
+        {
+            const auto result = Op::compute(operand);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    counters.report(state, operands.size());
+    set_throughput(state, operands.size(), width_of<T>());
+}
+
+/**
+ * Operations whose right operands are just random numbers
+ */
+struct random_rhs
+{
+    template <class T> static T rhs(const T&, const T& random)
+    {
+        return random;
+    }
+};
+
+struct Add : random_rhs
+{
+    static constexpr const char* name = "Add";
 
-            // extra run for the largest b
-            benchmark::DoNotOptimize(Op::compute(a, std::numeric_limits<I>::max())); // NOLINT
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        if constexpr (is_integral_v<T>)
+        {
+            return add(a, b);
         }
+        else
+        {
+            return static_cast<T>(a + b);
+        }
+    }
+};
 
-        for (I b = std::numeric_limits<I>::min(); b != std::numeric_limits<I>::max(); b = b + one)
+struct Sub : random_rhs
+{
+    static constexpr const char* name = "Sub";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        if constexpr (is_integral_v<T>)
+        {
+            return sub(a, b);
+        }
+        else
         {
-            benchmark::DoNotOptimize(Op::compute(std::numeric_limits<I>::max(), b)); // NOLINT
+            return static_cast<T>(a - b);
         }
+    }
+};
+
+struct SchoolbookMul : random_rhs
+{
+    static constexpr const char* name = "SchoolbookMul";
 
-        benchmark::DoNotOptimize( // NOLINT
-            Op::compute(std::numeric_limits<I>::max(), std::numeric_limits<I>::max()));
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        if constexpr (is_integral_v<T>)
+        {
+            return schoolbook_mul(a, b);
+        }
+        else
+        {
+            return static_cast<T>(a * b);
+        }
     }
-}
+};
 
-template <typename I> class Add
+struct KarazubaMul : random_rhs
 {
-public:
-    using Type = I;
+    static constexpr const char* name = "KarazubaMul";
 
-    static I compute(const I& a, const I& b)
+    template <class T> static T compute(const T& a, const T& b)
     {
-        using namespace integer_operators; // NOLINT // NOLINT
-        return a + b;
+        return karazuba(a, b);
     }
 };
 
-template <typename I> class Sub
+struct NaiveMul : random_rhs
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "NaiveMul";
+
+    template <class T> static T compute(const T& a, const T& b)
     {
-        using namespace integer_operators; // NOLINT
-        return a + b;
+        return naive_mul(a, b);
     }
 };
 
-template <typename I> class Div
+struct BoothMul : random_rhs
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "BoothMul";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        return booth_mul(a, b);
+    }
+};
+
+struct BoothInPlaceMul : random_rhs
+{
+    static constexpr const char* name = "BoothInPlaceMul";
+
+    template <class T> static T compute(const T& a, const T& b)
     {
-        using namespace integer_operators; // NOLINT
-        if (b != static_cast<I>(0))
+        return booth_inplace_mul(a, b);
+    }
+};
+
+/**
+ * Divisions by non-zero divisors of half the width (i.e., the quotients have about half the width)
+ */
+struct half_width_divisor
+{
+    template <class T> static T rhs(const T&, const T& random)
+    {
+        return (random >> (width_of<T>() / 2)) | T{1U};
+    }
+};
+
+struct Div : half_width_divisor
+{
+    static constexpr const char* name = "Div";
+
+    template <class T> static T compute(const T& a, const T& b)
+    {
+        if constexpr (is_integral_v<T>)
         {
-            return a / b;
+            return div(a, b);
         }
         else
         {
-            if constexpr (aarith::is_integral_v<I>)
-            {
-                return I::zero();
-            }
-            else
-            {
-                return static_cast<I>(0);
-            }
+            return static_cast<T>(a / b);
         }
     }
 };
 
-template <typename I> class Mod
+struct Rem : half_width_divisor
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "Rem";
+
+    template <class T> static T compute(const T& a, const T& b)
     {
-        using namespace integer_operators; // NOLINT
-        if (b != static_cast<I>(0))
+        if constexpr (is_integral_v<T>)
         {
-            return a % b;
+            return remainder(a, b);
         }
         else
         {
-            if constexpr (aarith::is_integral_v<I>)
-            {
-                return I::zero();
-            }
-            else
-            {
-                return static_cast<I>(0);
-            }
+            return static_cast<T>(a % b);
         }
     }
 };
 
-template <typename I> class NaiveMul
+/**
+ * Shifts by random amounts less than the width
+ */
+struct random_shift
 {
-public:
-    using Type = I;
-    static I compute(const I a, const I b)
+    template <class T> static size_t rhs(const T&, const T& random)
     {
-        using namespace integer_operators; // NOLINT
-        return a * b;
+        return static_cast<size_t>(static_cast<uint64_t>(random) % width_of<T>());
     }
 };
 
-template <typename I> class Karazuba
+struct ShiftLeft : random_shift
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "ShiftLeft";
+
+    template <class T> static T compute(const T& a, const size_t shift)
     {
-        using namespace integer_operators; // NOLINT
-        return karazuba(a, b);
+        return static_cast<T>(a << shift);
     }
 };
 
-template <typename I> class BoothMul
+struct ShiftRight : random_shift
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "ShiftRight";
+
+    template <class T> static T compute(const T& a, const size_t shift)
     {
-        return booth_mul(a, b);
+        return static_cast<T>(a >> shift);
     }
 };
 
-template <typename I> class InPlaceMul
+struct Less : random_rhs
 {
-public:
-    using Type = I;
-    static I compute(const I& a, const I& b)
+    static constexpr const char* name = "Less";
+
+    template <class T> static bool compute(const T& a, const T& b)
     {
-        return booth_inplace_mul(a, b);
+        return a < b;
     }
 };
 
-template <typename I> void scalar_product(benchmark::State& state) // NOLINT
+/**
+ * Comparisons of equal numbers (i.e., all words have to be compared)
+ */
+struct Equal
 {
-    using namespace integer_operators; // NOLINT
-    for (auto _ : state)
+    static constexpr const char* name = "Equal";
+
+    template <class T> static T rhs(const T& lhs, const T&)
     {
-        state.PauseTiming();
-        std::vector<I> v1(state.range(0));
-        std::vector<I> v2(state.range(0));
+        return lhs;
+    }
 
-        I fst = std::numeric_limits<I>::min();
-        I lst = std::numeric_limits<I>::max();
+    template <class T> static bool compute(const T& a, const T& b)
+    {
+        return a == b;
+    }
+};
+
+struct Widen : random_rhs
+{
+    static constexpr const char* name = "Widen";
 
-        I one;
+    template <size_t W> static uinteger<2 * W> compute(const uinteger<W>& a)
+    {
+        return width_cast<2 * W>(a);
+    }
+};
+
+struct Narrow : random_rhs
+{
+    static constexpr const char* name = "Narrow";
+
+    template <size_t W> static uinteger<W / 2> compute(const uinteger<W>& a)
+    {
+        return width_cast<W / 2>(a);
+    }
+};
+
+struct ToUint64 : random_rhs
+{
+    static constexpr const char* name = "ToUint64";
+
+    template <size_t W> static uint64_t compute(const uinteger<W>& a)
+    {
+        return static_cast<uint64_t>(a);
+    }
+};
+
+struct ToDecimal : random_rhs
+{
+    static constexpr const char* name = "ToDecimal";
 
-        if constexpr (aarith::is_integral_v<I>)
+    template <class T> static std::string compute(const T& a)
+    {
+        if constexpr (is_integral_v<T>)
         {
-            one = I::one();
+            return to_decimal(a);
         }
         else
         {
-            one = static_cast<I>(1);
+            return std::to_string(a);
+        }
+    }
+};
+
+struct ToHex : random_rhs
+{
+    static constexpr const char* name = "ToHex";
+
+    template <size_t W> static std::string compute(const uinteger<W>& a)
+    {
+        return to_hex(a);
+    }
+};
+
+struct ToBinary : random_rhs
+{
+    static constexpr const char* name = "ToBinary";
+
+    template <size_t W> static std::string compute(const uinteger<W>& a)
+    {
+        return to_binary(a);
+    }
+};
+
+template <class Op, class T> void register_binary(const std::string& type)
+{
+    benchmark::RegisterBenchmark((std::string{Op::name} + "/" + type).c_str(),
+                                 &binary_throughput<Op, T>);
+}
+
+template <class Op, class T> void register_unary(const std::string& type)
+{
+    benchmark::RegisterBenchmark((std::string{Op::name} + "/" + type).c_str(),
+                                 &unary_throughput<Op, T>);
+}
+
+template <size_t W> void register_aarith_benchmarks()
+{
+    using U = uinteger<W>;
+    using I = integer<W>;
+    const std::string uint_type = "uinteger/" + std::to_string(W);
+    const std::string int_type = "integer/" + std::to_string(W);
+
+    register_binary<Add, U>(uint_type);
+    register_binary<Sub, U>(uint_type);
+    register_binary<SchoolbookMul, U>(uint_type);
+    register_binary<KarazubaMul, U>(uint_type);
+    register_binary<NaiveMul, I>(int_type);
+    // the Booth multiplications need W additions of W bits each
+    if constexpr (W <= 16384)
+    {
+        register_binary<BoothMul, I>(int_type);
+        register_binary<BoothInPlaceMul, I>(int_type);
+    }
+    register_binary<Div, U>(uint_type);
+    register_binary<Rem, U>(uint_type);
+    register_binary<ShiftLeft, U>(uint_type);
+    register_binary<ShiftRight, U>(uint_type);
+    register_binary<Less, U>(uint_type);
+    register_binary<Equal, U>(uint_type);
+
+    register_unary<Widen, U>(uint_type);
+    register_unary<Narrow, U>(uint_type);
+    register_unary<ToUint64, U>(uint_type);
+    register_unary<ToDecimal, U>(uint_type);
+    register_unary<ToHex, U>(uint_type);
+    register_unary<ToBinary, U>(uint_type);
+}
+
+template <class T> void register_native_benchmarks(const std::string& type)
+{
+    register_binary<Add, T>(type);
+    register_binary<Sub, T>(type);
+    register_binary<SchoolbookMul, T>(type);
+    register_binary<Div, T>(type);
+    register_binary<Rem, T>(type);
+    register_binary<ShiftLeft, T>(type);
+    register_binary<ShiftRight, T>(type);
+    register_binary<Less, T>(type);
+    register_binary<Equal, T>(type);
+    if constexpr (sizeof(T) <= sizeof(uint64_t))
+    {
+        register_unary<ToDecimal, T>(type);
+    }
+}
+
+#ifdef AARITH_BENCHMARK_MPIR
+
+/**
+ * The operations of MPIR on the same operands as the operations of aarith (the results are not
+ * reduced to the width of the operands)
+ */
+struct mpz_operation
+{
+    static void compute(Add, mpz_ptr r, mpz_srcptr a, mpz_srcptr b)
+    {
+        mpz_add(r, a, b);
+    }
+
+    static void compute(Sub, mpz_ptr r, mpz_srcptr a, mpz_srcptr b)
+    {
+        mpz_sub(r, a, b);
+    }
+
+    static void compute(SchoolbookMul, mpz_ptr r, mpz_srcptr a, mpz_srcptr b)
+    {
+        mpz_mul(r, a, b);
+    }
+
+    static void compute(Div, mpz_ptr r, mpz_srcptr a, mpz_srcptr b)
+    {
+        mpz_tdiv_q(r, a, b);
+    }
+
+    static void compute(Rem, mpz_ptr r, mpz_srcptr a, mpz_srcptr b)
+    {
+        mpz_tdiv_r(r, a, b);
+    }
+
+    static void compute(ShiftLeft, mpz_ptr r, mpz_srcptr a, const size_t shift)
+    {
+        mpz_mul_2exp(r, a, shift);
+    }
+
+    static void compute(ShiftRight, mpz_ptr r, mpz_srcptr a, const size_t shift)
+    {
+        mpz_tdiv_q_2exp(r, a, shift);
+    }
+
+    static bool compute(Less, mpz_ptr, mpz_srcptr a, mpz_srcptr b)
+    {
+        return mpz_cmp(a, b) < 0;
+    }
+
+    static bool compute(Equal, mpz_ptr, mpz_srcptr a, mpz_srcptr b)
+    {
+        return mpz_cmp(a, b) == 0;
+    }
+};
+
+/**
+ * mpz_t numbers with the values of unsigned integers
+ */
+class mpz_buffer
+{
+public:
+    template <size_t W>
+    explicit mpz_buffer(const std::vector<uinteger<W>>& values)
+        : size(values.size())
+        , numbers(new mpz_t[values.size()])
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            mpz_init2(numbers[i], W);
+            mpz_import(numbers[i], values[i].word_count(), -1, sizeof(uint64_t), 0, 0,
+                       values[i].data());
         }
+    }
 
-        for (size_t i = 0; i < state.range(0); ++i)
+    mpz_buffer(const mpz_buffer&) = delete;
+    mpz_buffer& operator=(const mpz_buffer&) = delete;
+
+    ~mpz_buffer()
+    {
+        for (size_t i = 0; i < size; ++i)
         {
-            v1.push_back(fst);
-            v2.push_back(lst);
+            mpz_clear(numbers[i]);
+        }
+    }
+
+    mpz_srcptr operator[](const size_t i) const
+    {
+        return numbers[i];
+    }
 
-            fst = fst + one;
-            lst = lst - one;
+private:
+    size_t size;
+    std::unique_ptr<mpz_t[]> numbers;
+};
+
+template <class Op, size_t W> void mpir_binary_throughput(benchmark::State& state)
+{
+    const auto [lhs, rhs] = random_operands<Op, uinteger<W>>();
+    const mpz_buffer a{lhs};
+
+    mpz_t r;
+    mpz_init2(r, 2 * W);
+    const auto run = [&](const auto& b) {
+        const perf_counters counters;
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < lhs.size(); ++i)
+            {
+                using Result = decltype(mpz_operation::compute(Op{}, r, a[i], b[i]));
+                if constexpr (std::is_void_v<Result>)
+                {
+                    mpz_operation::compute(Op{}, r, a[i], b[i]);
+                    benchmark::ClobberMemory();
+                }
+                else
+                {
+                    const auto result = mpz_operation::compute(Op{}, r, a[i], b[i]);
+                    benchmark::DoNotOptimize(result);
+                }
+            }
         }
-        state.ResumeTiming();
+        counters.report(state, lhs.size());
+    };
+    if constexpr (std::is_same_v<typename decltype(rhs)::value_type, size_t>)
+    {
+        run(rhs);
+    }
+    else
+    {
+        run(mpz_buffer{rhs});
+    }
+    mpz_clear(r);
+    set_throughput(state, lhs.size(), W);
+}
 
-        I result = static_cast<I>(0);
-        auto iter1 = std::begin(v1);
-        auto iter2 = std::begin(v2);
+template <int Base, size_t W> void mpir_to_string_throughput(benchmark::State& state)
+{
+    const auto operands = random_operands<random_rhs, uinteger<W>>().first;
+    const mpz_buffer a{operands};
 
-        for (; iter1 != std::end(v1); ++iter1)
+    // the digits, a sign and the terminating zero
+    std::vector<char> digits(W + 2);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < operands.size(); ++i)
         {
-            benchmark::DoNotOptimize(result = result + (*iter1 * *iter2)); // NOLINT
-            ++iter2;
+            benchmark::DoNotOptimize(mpz_get_str(digits.data(), Base, a[i]));
+            benchmark::ClobberMemory();
         }
     }
+    counters.report(state, operands.size());
+    set_throughput(state, operands.size(), W);
+}
+
+template <class Op, size_t W> void register_mpir_binary(const std::string& type)
+{
+    benchmark::RegisterBenchmark((std::string{Op::name} + "/" + type).c_str(),
+                                 &mpir_binary_throughput<Op, W>);
+}
+
+template <size_t W> void register_mpir_benchmarks()
+{
+    const std::string type = "mpz/" + std::to_string(W);
+
+    register_mpir_binary<Add, W>(type);
+    register_mpir_binary<Sub, W>(type);
+    register_mpir_binary<SchoolbookMul, W>(type);
+    register_mpir_binary<Div, W>(type);
+    register_mpir_binary<Rem, W>(type);
+    register_mpir_binary<ShiftLeft, W>(type);
+    register_mpir_binary<ShiftRight, W>(type);
+    register_mpir_binary<Less, W>(type);
+    register_mpir_binary<Equal, W>(type);
+    benchmark::RegisterBenchmark(("ToDecimal/" + type).c_str(), &mpir_to_string_throughput<10, W>);
+    benchmark::RegisterBenchmark(("ToHex/" + type).c_str(), &mpir_to_string_throughput<16, W>);
+    benchmark::RegisterBenchmark(("ToBinary/" + type).c_str(), &mpir_to_string_throughput<2, W>);
+}
+
+#endif
+
+template <size_t W> uinteger<W> random_wide_uinteger(const unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    uniform_uinteger_distribution<W> dist;
+    return dist(rng);
+}
+
+/**
+ * Value-returning arithmetic creates a new integer for every result while the in-place kernels
+ * overwrite their first operand.
+ */
+template <size_t W> void wide_add_value(benchmark::State& state) // NOLINT
+{
+    auto a = random_wide_uinteger<W>(1);
+    const auto b = random_wide_uinteger<W>(2);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        a = a + b;
+        benchmark::DoNotOptimize(a);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void wide_add_inplace(benchmark::State& state) // NOLINT
+{
+    auto a = random_wide_uinteger<W>(1);
+    const auto b = random_wide_uinteger<W>(2);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        a += b;
+        benchmark::DoNotOptimize(a);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void wide_sub_value(benchmark::State& state) // NOLINT
+{
+    auto a = random_wide_uinteger<W>(1);
+    const auto b = random_wide_uinteger<W>(2);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        a = a - b;
+        benchmark::DoNotOptimize(a);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void wide_sub_inplace(benchmark::State& state) // NOLINT
+{
+    auto a = random_wide_uinteger<W>(1);
+    const auto b = random_wide_uinteger<W>(2);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        a -= b;
+        benchmark::DoNotOptimize(a);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void wide_mul_add_value(benchmark::State& state) // NOLINT
+{
+    auto acc = random_wide_uinteger<W>(1);
+    const auto a = random_wide_uinteger<W>(2);
+    const auto b = random_wide_uinteger<W>(3);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        acc = acc + a * b;
+        benchmark::DoNotOptimize(acc);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void wide_mul_add_inplace(benchmark::State& state) // NOLINT
+{
+    auto acc = random_wide_uinteger<W>(1);
+    const auto a = random_wide_uinteger<W>(2);
+    const auto b = random_wide_uinteger<W>(3);
+    const perf_counters counters;
+    for (auto _ : state)
+    {
+        mul_add_inplace(acc, a, b);
+        benchmark::DoNotOptimize(acc);
+    }
+    counters.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void register_wide_benchmarks()
+{
+    const std::string width = std::to_string(W);
+    benchmark::RegisterBenchmark(("WideAddValue/" + width).c_str(), &wide_add_value<W>);
+    benchmark::RegisterBenchmark(("WideAddInPlace/" + width).c_str(), &wide_add_inplace<W>);
+    benchmark::RegisterBenchmark(("WideSubValue/" + width).c_str(), &wide_sub_value<W>);
+    benchmark::RegisterBenchmark(("WideSubInPlace/" + width).c_str(), &wide_sub_inplace<W>);
+    benchmark::RegisterBenchmark(("WideMulAddValue/" + width).c_str(), &wide_mul_add_value<W>);
+    benchmark::RegisterBenchmark(("WideMulAddInPlace/" + width).c_str(),
+                                 &wide_mul_add_inplace<W>);
 }
 } // namespace aarith::helpers
 
 int main(int argc, char** argv)
 {
-
     using namespace aarith::helpers; // NOLINT
 
-    constexpr size_t reps = 5;
-    // the code below has been generated using a ruby script...
-
-    benchmark::RegisterBenchmark("Adduint8t", &generic_arithmetic<Add<uint8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subuint8t", &generic_arithmetic<Sub<uint8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Muluint8t", &generic_arithmetic<NaiveMul<uint8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divuint8t", &generic_arithmetic<Div<uint8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Moduint8t", &generic_arithmetic<Mod<uint8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addint8t", &generic_arithmetic<Add<int8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subint8t", &generic_arithmetic<Sub<int8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulint8t", &generic_arithmetic<NaiveMul<int8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divint8t", &generic_arithmetic<Div<int8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modint8t", &generic_arithmetic<Mod<int8_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Adduint16t", &generic_arithmetic<Add<uint16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subuint16t", &generic_arithmetic<Sub<uint16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Muluint16t", &generic_arithmetic<NaiveMul<uint16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divuint16t", &generic_arithmetic<Div<uint16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Moduint16t", &generic_arithmetic<Mod<uint16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addint16t", &generic_arithmetic<Add<int16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subint16t", &generic_arithmetic<Sub<int16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulint16t", &generic_arithmetic<NaiveMul<int16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divint16t", &generic_arithmetic<Div<int16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modint16t", &generic_arithmetic<Mod<int16_t>>)
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithinteger8",
-                                 &generic_arithmetic<Add<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithinteger8",
-                                 &generic_arithmetic<Sub<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithinteger8",
-                                 &generic_arithmetic<NaiveMul<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithinteger8",
-                                 &generic_arithmetic<Div<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithinteger8",
-                                 &generic_arithmetic<Mod<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithinteger10",
-                                 &generic_arithmetic<Add<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithinteger10",
-                                 &generic_arithmetic<Sub<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithinteger10",
-                                 &generic_arithmetic<NaiveMul<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithinteger10",
-                                 &generic_arithmetic<Div<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithinteger10",
-                                 &generic_arithmetic<Mod<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithinteger12",
-                                 &generic_arithmetic<Add<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithinteger12",
-                                 &generic_arithmetic<Sub<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithinteger12",
-                                 &generic_arithmetic<NaiveMul<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithinteger12",
-                                 &generic_arithmetic<Div<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithinteger12",
-                                 &generic_arithmetic<Mod<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithinteger14",
-                                 &generic_arithmetic<Add<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithinteger14",
-                                 &generic_arithmetic<Sub<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithinteger14",
-                                 &generic_arithmetic<NaiveMul<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithinteger14",
-                                 &generic_arithmetic<Div<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithinteger14",
-                                 &generic_arithmetic<Mod<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithinteger16",
-                                 &generic_arithmetic<Add<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithinteger16",
-                                 &generic_arithmetic<Sub<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithinteger16",
-                                 &generic_arithmetic<NaiveMul<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithinteger16",
-                                 &generic_arithmetic<Div<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithinteger16",
-                                 &generic_arithmetic<Mod<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithuinteger8",
-                                 &generic_arithmetic<Add<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithuinteger8",
-                                 &generic_arithmetic<Sub<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithuinteger8",
-                                 &generic_arithmetic<NaiveMul<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithuinteger8",
-                                 &generic_arithmetic<Div<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithuinteger8",
-                                 &generic_arithmetic<Mod<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithuinteger10",
-                                 &generic_arithmetic<Add<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithuinteger10",
-                                 &generic_arithmetic<Sub<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithuinteger10",
-                                 &generic_arithmetic<NaiveMul<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithuinteger10",
-                                 &generic_arithmetic<Div<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithuinteger10",
-                                 &generic_arithmetic<Mod<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithuinteger12",
-                                 &generic_arithmetic<Add<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithuinteger12",
-                                 &generic_arithmetic<Sub<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithuinteger12",
-                                 &generic_arithmetic<NaiveMul<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithuinteger12",
-                                 &generic_arithmetic<Div<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithuinteger12",
-                                 &generic_arithmetic<Mod<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithuinteger14",
-                                 &generic_arithmetic<Add<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithuinteger14",
-                                 &generic_arithmetic<Sub<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithuinteger14",
-                                 &generic_arithmetic<NaiveMul<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithuinteger14",
-                                 &generic_arithmetic<Div<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithuinteger14",
-                                 &generic_arithmetic<Mod<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Addaarithuinteger16",
-                                 &generic_arithmetic<Add<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Subaarithuinteger16",
-                                 &generic_arithmetic<Sub<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Mulaarithuinteger16",
-                                 &generic_arithmetic<NaiveMul<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Divaarithuinteger16",
-                                 &generic_arithmetic<Div<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Modaarithuinteger16",
-                                 &generic_arithmetic<Mod<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("BoothMulaarithinteger8",
-                                 &generic_arithmetic<BoothMul<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("InPlaceMulaarithinteger8",
-                                 &generic_arithmetic<InPlaceMul<aarith::integer<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("BoothMulaarithinteger10",
-                                 &generic_arithmetic<BoothMul<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("InPlaceMulaarithinteger10",
-                                 &generic_arithmetic<InPlaceMul<aarith::integer<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("BoothMulaarithinteger12",
-                                 &generic_arithmetic<BoothMul<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("InPlaceMulaarithinteger12",
-                                 &generic_arithmetic<InPlaceMul<aarith::integer<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("BoothMulaarithinteger14",
-                                 &generic_arithmetic<BoothMul<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("InPlaceMulaarithinteger14",
-                                 &generic_arithmetic<InPlaceMul<aarith::integer<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("BoothMulaarithinteger16",
-                                 &generic_arithmetic<BoothMul<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("InPlaceMulaarithinteger16",
-                                 &generic_arithmetic<InPlaceMul<aarith::integer<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Karazubaaarithuinteger8",
-                                 &generic_arithmetic<Karazuba<aarith::uinteger<8>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Karazubaaarithuinteger10",
-                                 &generic_arithmetic<Karazuba<aarith::uinteger<10>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Karazubaaarithuinteger12",
-                                 &generic_arithmetic<Karazuba<aarith::uinteger<12>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Karazubaaarithuinteger14",
-                                 &generic_arithmetic<Karazuba<aarith::uinteger<14>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
-    benchmark::RegisterBenchmark("Karazubaaarithuinteger16",
-                                 &generic_arithmetic<Karazuba<aarith::uinteger<16>>>) // NOLINT
-        ->Unit(benchmark::kMillisecond)
-        ->Repetitions(reps)
-        ->DisplayAggregatesOnly();
+    register_native_benchmarks<uint8_t>("uint8_t");
+    register_native_benchmarks<uint16_t>("uint16_t");
+    register_native_benchmarks<uint32_t>("uint32_t");
+    register_native_benchmarks<uint64_t>("uint64_t");
+    register_native_benchmarks<uint128_t>("uint128_t");
+
+    register_aarith_benchmarks<8>();
+    register_aarith_benchmarks<16>();
+    register_aarith_benchmarks<32>();
+    register_aarith_benchmarks<64>();
+    register_aarith_benchmarks<128>();
+    register_aarith_benchmarks<256>();
+    register_aarith_benchmarks<512>();
+    register_aarith_benchmarks<1024>();
+    register_aarith_benchmarks<4096>();
+    register_aarith_benchmarks<16384>();
+    register_aarith_benchmarks<65536>();
+
+#ifdef AARITH_BENCHMARK_MPIR
+    register_mpir_benchmarks<64>();
+    register_mpir_benchmarks<128>();
+    register_mpir_benchmarks<256>();
+    register_mpir_benchmarks<512>();
+    register_mpir_benchmarks<1024>();
+    register_mpir_benchmarks<4096>();
+    register_mpir_benchmarks<16384>();
+    register_mpir_benchmarks<65536>();
+#endif
+
+    register_wide_benchmarks<64>();
+    register_wide_benchmarks<128>();
+    register_wide_benchmarks<256>();
+    register_wide_benchmarks<512>();
+    register_wide_benchmarks<1024>();
+    register_wide_benchmarks<2048>();
+    register_wide_benchmarks<4096>();
+    register_wide_benchmarks<8192>();
 
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/float.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+template <size_t E, size_t M> auto random_vector(const size_t length, const unsigned int seed)
+{
+    using F = floating_point<E, M>;
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+    std::vector<F> values;
+    values.reserve(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        values.emplace_back(dist(rng));
+    }
+    return values;
+}
+
+/**
+ * Dot product using a floating-point multiplication and addition per element.
+ */
+template <size_t E, size_t M> void float_dot_product(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    const auto length = static_cast<size_t>(state.range(0));
+    const auto a = random_vector<E, M>(length, 1);
+    const auto b = random_vector<E, M>(length, 2);
+
+    for (auto _ : state)
+    {
+        F result = F::zero();
+        for (size_t i = 0; i < length; ++i)
+        {
+            result = add(result, mul(a[i], b[i]));
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+
+/**
+ * Dot product accumulated exactly and rounded once.
+ */
+template <size_t E, size_t M> void kulisch_dot_product(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    const auto length = static_cast<size_t>(state.range(0));
+    const auto a = random_vector<E, M>(length, 1);
+    const auto b = random_vector<E, M>(length, 2);
+
+    for (auto _ : state)
+    {
+        kulisch_accumulator<E, M> acc;
+        for (size_t i = 0; i < length; ++i)
+        {
+            acc.accumulate_product(a[i], b[i]);
+        }
+        F result = acc.round();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+
+/**
+ * Dot product accumulated exactly using the per-thread accumulators of a thread pool.
+ */
+template <size_t E, size_t M> void parallel_kulisch_dot_product(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    const auto length = static_cast<size_t>(state.range(0));
+    const auto threads = static_cast<size_t>(state.range(1));
+    const auto a = random_vector<E, M>(length, 1);
+    const auto b = random_vector<E, M>(length, 2);
+    thread_pool pool{threads};
+
+    for (auto _ : state)
+    {
+        F result = exact_dot_product<E, M>(a.begin(), a.end(), b.begin(), pool).round();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * length));
+}
+
+BENCHMARK_TEMPLATE(float_dot_product, 8, 23)->Arg(1024);
+BENCHMARK_TEMPLATE(kulisch_dot_product, 8, 23)->Arg(1024);
+BENCHMARK_TEMPLATE(float_dot_product, 11, 52)->Arg(1024);
+BENCHMARK_TEMPLATE(kulisch_dot_product, 11, 52)->Arg(1024);
+BENCHMARK_TEMPLATE(parallel_kulisch_dot_product, 11, 52)
+    ->Args({1 << 16, 1})
+    ->Args({1 << 16, 4})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
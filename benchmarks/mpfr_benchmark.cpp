@@ -1,22 +0,0 @@
-#include <stdio.h>
-
-#include <gmp.h>
-#include <mpfr.h>
-
-int main(void)
-{
-    unsigned int i;
-    mpfr_t s, t, u;
-
-    mpfr_init2(s, 200);
-    mpfr_set_str(s, "1.375", 10, MPFR_RNDD);
-
-    mpfr_prec_round(s, 2, MPFR_RNDN);
-    mpfr_out_str(stdout, 10, 0, s, MPFR_RNDD);
-    putchar('\n');
-    mpfr_clear(s);
-    mpfr_clear(t);
-    mpfr_clear(u);
-    mpfr_free_cache();
-    return 0;
-}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file perf_counters.hpp
+ *
+ * Hardware performance counters for the benchmarks, read with the Linux perf_event_open interface.
+ *
+ * The counters are only collected if the environment variable `AARITH_PERF_COUNTERS` is set (to
+ * anything but 0). The benchmarks then report the cycles, instructions, branch misses and L1 data
+ * and last-level cache read misses per operation as well as the instructions per cycle. Only user
+ * space is counted and only the calling thread.
+ *
+ * Counters that cannot be opened (e.g., in virtual machines and containers without access to the
+ * PMU or with perf_event_paranoid above 2) are left out after a single warning, without any
+ * counters the benchmarks report their times only.
+ */
+
+namespace aarith::helpers {
+
+/**
+ * @brief The counters since the construction, reported per operation
+ *
+ * Construct it right before the benchmark loop and report after it:
+ *
+ *     const perf_counters counters;
+ *     for (auto _ : state) { ... }
+ *     counters.report(state, operations_per_iteration);
+ */
+class perf_counters
+{
+public:
+    perf_counters()
+    {
+        if (const event_set* set = events())
+        {
+            for (size_t i = 0; i < event_count; ++i)
+            {
+                start_[i] = set->read(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds the counts per operation (and the IPC) to the counters of the benchmark
+     *
+     * @param state The state of the benchmark (after its loop)
+     * @param operations The number of operations per iteration of the benchmark loop
+     */
+    void report(benchmark::State& state, const size_t operations = 1) const
+    {
+        const event_set* set = events();
+        if (set == nullptr || state.iterations() == 0)
+        {
+            return;
+        }
+
+        const double total = static_cast<double>(state.iterations()) *
+                             static_cast<double>(operations);
+        std::array<double, event_count> per_operation{};
+        std::array<bool, event_count> counted{};
+        for (size_t i = 0; i < event_count; ++i)
+        {
+            const reading end = set->read(i);
+            const uint64_t running = end.running - start_[i].running;
+            if (!set->is_open(i) || running == 0)
+            {
+                continue;
+            }
+            // the kernel multiplexes the counters if there are more events than hardware counters
+            const double scale =
+                static_cast<double>(end.enabled - start_[i].enabled) / static_cast<double>(running);
+            per_operation[i] = static_cast<double>(end.value - start_[i].value) * scale / total;
+            counted[i] = true;
+            state.counters[std::string{event_names[i]} + "/op"] = per_operation[i];
+        }
+
+        if (counted[cycles] && counted[instructions] && per_operation[cycles] > 0)
+        {
+            state.counters["IPC"] = per_operation[instructions] / per_operation[cycles];
+        }
+    }
+
+private:
+    enum event : size_t
+    {
+        cycles,
+        instructions,
+        branch_misses,
+        l1d_misses,
+        llc_misses,
+        event_count
+    };
+
+    static constexpr std::array<const char*, event_count> event_names{
+        "cycles", "instructions", "branch-misses", "L1D-misses", "LLC-misses"};
+
+    struct reading
+    {
+        uint64_t value = 0;
+        uint64_t enabled = 0;
+        uint64_t running = 0;
+    };
+
+    /**
+     * @brief The opened events, they count from their creation until the end of the program
+     */
+    class event_set
+    {
+    public:
+        event_set()
+        {
+            fds_.fill(-1);
+#if defined(__linux__)
+            constexpr uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D |
+                                               (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+            constexpr uint64_t llc_read_miss = PERF_COUNT_HW_CACHE_LL |
+                                               (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+            const std::array<std::pair<uint32_t, uint64_t>, event_count> configs{{
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                {PERF_TYPE_HW_CACHE, l1d_read_miss},
+                {PERF_TYPE_HW_CACHE, llc_read_miss},
+            }};
+
+            std::string unavailable;
+            int error = 0;
+            for (size_t i = 0; i < event_count; ++i)
+            {
+                perf_event_attr attr{};
+                attr.size = sizeof(attr);
+                attr.type = configs[i].first;
+                attr.config = configs[i].second;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                fds_[i] = static_cast<int>(
+                    syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+                if (fds_[i] < 0)
+                {
+                    error = errno;
+                    unavailable += std::string{unavailable.empty() ? "" : ", "} + event_names[i];
+                }
+            }
+            if (!unavailable.empty())
+            {
+                std::cerr << "perf counters unavailable (" << std::strerror(error)
+                          << "): " << unavailable << "\n";
+            }
+#else
+            std::cerr << "perf counters unavailable: only supported on Linux\n";
+#endif
+        }
+
+        event_set(const event_set&) = delete;
+        event_set& operator=(const event_set&) = delete;
+
+        ~event_set()
+        {
+#if defined(__linux__)
+            for (const int fd : fds_)
+            {
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+        [[nodiscard]] bool is_open(const size_t i) const
+        {
+            return fds_[i] >= 0;
+        }
+
+        [[nodiscard]] bool any_open() const
+        {
+            for (size_t i = 0; i < event_count; ++i)
+            {
+                if (is_open(i))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] reading read(const size_t i) const
+        {
+            reading r;
+#if defined(__linux__)
+            if (is_open(i) && ::read(fds_[i], &r, sizeof(r)) != sizeof(r))
+            {
+                r = reading{};
+            }
+#endif
+            return r;
+        }
+
+    private:
+        std::array<int, event_count> fds_;
+    };
+
+    /**
+     * @brief Returns the opened events (or nullptr if they are not requested or none is available)
+     */
+    static const event_set* events()
+    {
+        static const event_set* set = []() -> const event_set* {
+            const char* requested = std::getenv("AARITH_PERF_COUNTERS");
+            if (requested == nullptr || *requested == '\0' || std::string{requested} == "0")
+            {
+                return nullptr;
+            }
+            static const event_set opened;
+            return opened.any_open() ? &opened : nullptr;
+        }();
+        return set;
+    }
+
+    std::array<reading, event_count> start_{};
+};
+
+} // namespace aarith::helpers
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/float.hpp>
+#include <aarith/integer.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+/**
+ * Numbers of an interval whose length is not a power of two (i.e., numbers may be rejected).
+ */
+template <size_t W, class Generator> void uinteger_interval(benchmark::State& state)
+{
+    using I = uinteger<W>;
+    Generator rng;
+    uniform_uinteger_distribution<W> distribution{I{3U}, sub(I::max(), I::max() >> 2U)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution(rng));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+/**
+ * Numbers of the full range (i.e., random bits).
+ */
+template <size_t W, class Generator> void uinteger_full_range(benchmark::State& state)
+{
+    Generator rng;
+    uniform_uinteger_distribution<W> distribution;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution(rng));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void uinteger_batch(benchmark::State& state)
+{
+    using I = uinteger<W>;
+    xoshiro256starstar rng;
+    uniform_uinteger_distribution<W> distribution{I{3U}, sub(I::max(), I::max() >> 2U)};
+    std::vector<I> batch(1024);
+    for (auto _ : state)
+    {
+        distribution.generate(batch.begin(), batch.end(), rng);
+        benchmark::DoNotOptimize(batch.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * batch.size() * W / 8));
+}
+
+/**
+ * Random bits filling the words of a batch in place.
+ */
+template <size_t W, class Generator> void word_array_batch(benchmark::State& state)
+{
+    Generator rng;
+    uniform_word_array_distribution<W> distribution;
+    std::vector<word_array<W>> batch(1024);
+    for (auto _ : state)
+    {
+        distribution.generate(batch.begin(), batch.end(), rng);
+        benchmark::DoNotOptimize(batch.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * batch.size() * W / 8));
+}
+
+template <size_t E, size_t M, class Generator> void float_non_special(benchmark::State& state)
+{
+    Generator rng;
+    floating_point_distribution<E, M> distribution;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distribution(rng));
+    }
+}
+
+/**
+ * Packed IEEE-754 encodings of a batch (e.g., for a fuzzing corpus).
+ */
+template <size_t E, size_t M, FloatGenerationModes Mode>
+void float_packed_batch(benchmark::State& state)
+{
+    xoshiro256starstar rng;
+    floating_point_distribution<E, M, Mode> distribution;
+    std::vector<word_array<1 + E + M>> batch(1024);
+    for (auto _ : state)
+    {
+        distribution.generate_bits(batch.begin(), batch.end(), rng);
+        benchmark::DoNotOptimize(batch.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch.size()));
+}
+
+BENCHMARK_TEMPLATE(uinteger_interval, 32, std::mt19937_64);
+BENCHMARK_TEMPLATE(uinteger_interval, 32, xoshiro256starstar);
+BENCHMARK_TEMPLATE(uinteger_interval, 64, std::mt19937_64);
+BENCHMARK_TEMPLATE(uinteger_interval, 64, xoshiro256starstar);
+BENCHMARK_TEMPLATE(uinteger_interval, 128, std::mt19937_64);
+BENCHMARK_TEMPLATE(uinteger_interval, 128, xoshiro256starstar);
+BENCHMARK_TEMPLATE(uinteger_interval, 256, std::mt19937_64);
+BENCHMARK_TEMPLATE(uinteger_interval, 256, xoshiro256starstar);
+BENCHMARK_TEMPLATE(uinteger_interval, 256, philox4x64);
+
+BENCHMARK_TEMPLATE(uinteger_full_range, 64, xoshiro256starstar);
+BENCHMARK_TEMPLATE(uinteger_full_range, 256, xoshiro256starstar);
+
+BENCHMARK_TEMPLATE(uinteger_batch, 64);
+BENCHMARK_TEMPLATE(uinteger_batch, 256);
+
+BENCHMARK_TEMPLATE(word_array_batch, 256, std::mt19937_64);
+BENCHMARK_TEMPLATE(word_array_batch, 256, xoshiro256starstar);
+BENCHMARK_TEMPLATE(word_array_batch, 256, philox4x64);
+
+BENCHMARK_TEMPLATE(float_non_special, 8, 23, std::mt19937_64);
+BENCHMARK_TEMPLATE(float_non_special, 8, 23, xoshiro256starstar);
+BENCHMARK_TEMPLATE(float_non_special, 8, 23, philox4x64);
+BENCHMARK_TEMPLATE(float_non_special, 11, 52, xoshiro256starstar);
+
+BENCHMARK_TEMPLATE(float_packed_batch, 8, 23, FloatGenerationModes::FullyRandom);
+BENCHMARK_TEMPLATE(float_packed_batch, 8, 23, FloatGenerationModes::NonSpecial);
+BENCHMARK_TEMPLATE(float_packed_batch, 8, 23, FloatGenerationModes::LogUniform);
+BENCHMARK_TEMPLATE(float_packed_batch, 8, 23, FloatGenerationModes::NearTie);
+BENCHMARK_TEMPLATE(float_packed_batch, 11, 52, FloatGenerationModes::NonSpecial);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/core.hpp>
+
+#include <random>
+
+using namespace aarith;
+
+template <size_t W> word_array<W> random_array(const unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    uniform_word_array_distribution<W> dist;
+    return dist(rng);
+}
+
+// shift amounts that are not a multiple of the word width
+constexpr size_t shift_amount = 37;
+
+/**
+ * Shifting by an amount only known at run time.
+ */
+template <size_t W> void runtime_shift_left(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    size_t shift = shift_amount;
+    benchmark::DoNotOptimize(shift);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value << shift);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void runtime_shift_right(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    size_t shift = shift_amount;
+    benchmark::DoNotOptimize(shift);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value >> shift);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void compile_time_shift_left(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(shl<shift_amount>(value));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void compile_time_shift_right(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(shr<shift_amount>(value));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+/**
+ * Shifting and combining with a separate operation (the baseline for the fused operation).
+ */
+template <size_t W> void shift_then_or(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    auto other = random_array<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize((value << shift_amount) | other);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+template <size_t W> void fused_shift_or(benchmark::State& state)
+{
+    auto value = random_array<W>(1);
+    auto other = random_array<W>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(shl_or<shift_amount>(value, other));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * W / 8));
+}
+
+#define AARITH_SHIFT_BENCHMARK(fun)                                                                \
+    BENCHMARK_TEMPLATE(fun, 64);                                                                   \
+    BENCHMARK_TEMPLATE(fun, 128);                                                                  \
+    BENCHMARK_TEMPLATE(fun, 256);                                                                  \
+    BENCHMARK_TEMPLATE(fun, 512);                                                                  \
+    BENCHMARK_TEMPLATE(fun, 1024)
+
+AARITH_SHIFT_BENCHMARK(runtime_shift_left);
+AARITH_SHIFT_BENCHMARK(compile_time_shift_left);
+AARITH_SHIFT_BENCHMARK(runtime_shift_right);
+AARITH_SHIFT_BENCHMARK(compile_time_shift_right);
+AARITH_SHIFT_BENCHMARK(shift_then_or);
+AARITH_SHIFT_BENCHMARK(fused_shift_or);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <aarith/float.hpp>
+
+#include <array>
+#include <random>
+
+using namespace aarith;
+
+constexpr size_t degree = 8;
+
+template <size_t E, size_t M> auto random_coefficients()
+{
+    using F = floating_point<E, M>;
+    std::mt19937 rng{42}; // NOLINT
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+    std::array<F, degree + 1> coefficients;
+    for (auto& c : coefficients)
+    {
+        c = F{dist(rng)};
+    }
+    return coefficients;
+}
+
+/**
+ * Horner evaluation where every operation normalizes and rounds its result.
+ */
+template <size_t E, size_t M> void eager_horner(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    const auto coefficients = random_coefficients<E, M>();
+    const F x{0.75};
+
+    for (auto _ : state)
+    {
+        F result = coefficients[degree];
+        for (size_t i = degree; i > 0; --i)
+        {
+            result = result * x + coefficients[i - 1];
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    // each multiplication and addition rounds
+    state.counters["roundings"] = 2 * degree;
+    state.counters["evaluations"] =
+        benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+/**
+ * Horner evaluation keeping unnormalized intermediates and rounding once at the end.
+ */
+template <size_t E, size_t M, size_t Extra> void lazy_horner(benchmark::State& state)
+{
+    using F = floating_point<E, M>;
+    using L = unnormalized_float<E, M, Extra>;
+    const auto coefficients = random_coefficients<E, M>();
+    const L x{F{0.75}};
+
+    std::array<L, degree + 1> lazy_coefficients{
+        L{coefficients[0]}, L{coefficients[1]}, L{coefficients[2]},
+        L{coefficients[3]}, L{coefficients[4]}, L{coefficients[5]},
+        L{coefficients[6]}, L{coefficients[7]}, L{coefficients[8]}};
+
+    for (auto _ : state)
+    {
+        L result = lazy_coefficients[degree];
+        for (size_t i = degree; i > 0; --i)
+        {
+            result = result * x + lazy_coefficients[i - 1];
+        }
+        F rounded = result;
+        benchmark::DoNotOptimize(rounded);
+    }
+
+    state.counters["roundings"] = 1;
+    state.counters["evaluations"] =
+        benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+// Extra = 4 is the default, Extra = M + 1 keeps products exact (fused multiply-add)
+BENCHMARK_TEMPLATE(eager_horner, 8, 23);
+BENCHMARK_TEMPLATE(lazy_horner, 8, 23, 4);
+BENCHMARK_TEMPLATE(lazy_horner, 8, 23, 24);
+BENCHMARK_TEMPLATE(eager_horner, 11, 52);
+BENCHMARK_TEMPLATE(lazy_horner, 11, 52, 4);
+BENCHMARK_TEMPLATE(lazy_horner, 11, 52, 53);
+BENCHMARK_TEMPLATE(eager_horner, 15, 112);
+BENCHMARK_TEMPLATE(lazy_horner, 15, 112, 4);
+BENCHMARK_TEMPLATE(lazy_horner, 15, 112, 113);
+
+BENCHMARK_MAIN();
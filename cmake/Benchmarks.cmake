@@ -24,4 +24,17 @@ function(add_aarith_benchmark benchname)
     target_link_libraries(${targetname} PRIVATE benchmark::benchmark)
     target_include_directories(${targetname} PRIVATE ${PROJECT_SOURCE_DIR}/lib/benchmark/include)
 
-endfunction(add_aarith_benchmark)
\ No newline at end of file
+endfunction(add_aarith_benchmark)
+# adds the target <benchname>-json running the benchmark <benchname> with repetitions and writing
+# the aggregated results to <benchname>.json in the build directory
+function(add_aarith_benchmark_json benchname)
+
+    add_custom_target(${benchname}-json
+            COMMAND ${benchname}-benchmark
+                    --benchmark_repetitions=5
+                    --benchmark_report_aggregates_only=true
+                    --benchmark_out=${CMAKE_BINARY_DIR}/${benchname}.json
+                    --benchmark_out_format=json
+            USES_TERMINAL)
+
+endfunction(add_aarith_benchmark_json)
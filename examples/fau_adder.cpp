@@ -28,14 +28,15 @@ template <class base_type, size_t N, size_t P> void eval_fau_adder()
             const auto result_correct = expanding_add(a, b);
             const auto result_fau = FAUadder<digits, N, P>(a, b);
 
-            uinteger<digits + 2> difference;
+            uinteger<digits + 2> difference{result_correct};
             if (result_fau < result_correct)
             {
-                difference = expanding_sub(result_correct, result_fau);
+                sub_inplace(difference, result_fau);
             }
             else
             {
-                difference = expanding_sub(result_fau, result_correct);
+                difference = result_fau;
+                sub_inplace(difference, result_correct);
             }
 
             max_diff = std::max(max_diff, difference);
@@ -29,10 +29,10 @@ extract_results(const PPort result)
     static constexpr size_t n_guards = 11 - (WWidth + AWidth);
     static constexpr size_t offset = (WWidth + AWidth) - 1;
 
-    const E a1w1{aarith::bit_range<offset, 0>(result)};
-    const E a2w1{aarith::bit_range<11 + offset, 11>(result)};
-    const E a1w2{aarith::bit_range<22 + offset, 22>(result)};
-    const E a2w2{aarith::bit_range<33 + offset, 33>(result)};
+    const E a1w1{aarith::bit_range_view<offset, 0>(result)};
+    const E a2w1{aarith::bit_range_view<11 + offset, 11>(result)};
+    const E a1w2{aarith::bit_range_view<22 + offset, 22>(result)};
+    const E a2w2{aarith::bit_range_view<33 + offset, 33>(result)};
 
     return {a2w2, a1w2, a2w1, a1w1};
 }
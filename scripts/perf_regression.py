@@ -0,0 +1,510 @@
+#!/usr/bin/env python3
+"""Tracks the performance of aarith against a baseline recorded on the same machine.
+
+The harness runs Google Benchmark targets of a build directory, stores every repetition of every
+benchmark together with a fingerprint of the machine and the build, and compares two such result
+files statistically. It only needs the Python standard library, i.e., it runs offline.
+
+    # record results (e.g., a new baseline)
+    perf_regression.py run --build-dir build --out build/perf-baseline.json
+
+    # compare two result files
+    perf_regression.py compare baseline.json current.json --report report.md
+
+    # run the benchmarks of the baseline and compare the results with it
+    perf_regression.py check --build-dir build
+
+Baselines are not shared: they only describe the machine and the build they were recorded with.
+check uses <build-dir>/perf-baseline.json by default and, if it does not exist yet, records it
+from the current build (exit code 0) so that the next check compares against it.
+
+A benchmark regressed if its time per operation is significantly more than the threshold (5% by
+default) slower than the baseline: the median grew by more than the threshold and the two-sided
+Mann-Whitney U test (or, with --method bootstrap, a bootstrap of the ratio of the medians) of the
+current times and the baseline times scaled by 1 + threshold rejects equal distributions at the
+level alpha (1% by default), after adjusting the p-values for the number of benchmarks with the
+Holm-Bonferroni method. Improvements are tested likewise with the factor 1 - threshold. compare and
+check exit with 1 if any benchmark regressed.
+
+Results of different machines or builds are not comparable; compare and check refuse to compare
+results whose fingerprints differ in the CPU, the number of CPUs, the compiler or the build types
+(exit code 2) unless --force is given.
+"""
+
+import argparse
+import datetime
+import glob
+import hashlib
+import json
+import math
+import os
+import platform
+import random
+import re
+import subprocess
+import sys
+
+FORMAT_VERSION = 1
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_DIR = os.path.dirname(SCRIPT_DIR)
+DEFAULT_BASELINE_NAME = "perf-baseline.json"
+
+# the rows of the default run: the main operations at a few widths and formats
+DEFAULT_SUITE = {
+    "integer-timing": r"^((Add|Sub|SchoolbookMul|KarazubaMul|Div|ShiftLeft|Less)"
+                      r"/uinteger/(64|1024|16384)|ToDecimal/uinteger/(64|1024))$",
+    "float-timing": r"^(Add|Mul|Div)/float(5_10|8_23|11_52|15_112)/(NonSpecial|DenormalizedOnly)$",
+}
+
+# the fields of the fingerprint that have to agree for results to be comparable
+COMPARABLE_FIELDS = ("cpu_model", "logical_cpus", "compiler", "build_type", "library_build_type")
+
+
+def read_file(path):
+    try:
+        with open(path) as f:
+            return f.read()
+    except OSError:
+        return None
+
+
+def cmake_cache(build_dir):
+    entries = {}
+    text = read_file(os.path.join(build_dir, "CMakeCache.txt")) or ""
+    for line in text.splitlines():
+        match = re.match(r"^([A-Za-z0-9_]+):[A-Z]+=(.*)$", line)
+        if match:
+            entries[match.group(1)] = match.group(2)
+    return entries
+
+
+def compiler_of(build_dir):
+    pattern = os.path.join(build_dir, "CMakeFiles", "*", "CMakeCXXCompiler.cmake")
+    for path in sorted(glob.glob(pattern)):
+        text = read_file(path) or ""
+        compiler_id = re.search(r'set\(CMAKE_CXX_COMPILER_ID "([^"]*)"\)', text)
+        version = re.search(r'set\(CMAKE_CXX_COMPILER_VERSION "([^"]*)"\)', text)
+        if compiler_id and version:
+            return "%s %s" % (compiler_id.group(1), version.group(1))
+    return cmake_cache(build_dir).get("CMAKE_CXX_COMPILER", "unknown")
+
+
+def cpu_model():
+    text = read_file("/proc/cpuinfo") or ""
+    match = re.search(r"^model name\s*:\s*(.*)$", text, re.MULTILINE)
+    return match.group(1).strip() if match else (platform.processor() or platform.machine())
+
+
+def git_revision():
+    try:
+        revision = subprocess.run(["git", "-C", SOURCE_DIR, "rev-parse", "HEAD"],
+                                  capture_output=True, text=True, check=True).stdout.strip()
+        status = subprocess.run(["git", "-C", SOURCE_DIR, "status", "--porcelain", "--", "src"],
+                                capture_output=True, text=True, check=True).stdout
+        return revision + ("-dirty" if status.strip() else "")
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def fingerprint(build_dir, context):
+    """Describes the machine and the build the benchmarks ran on"""
+    cache = cmake_cache(build_dir)
+    governor = read_file("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor")
+    result = {
+        "host": platform.node(),
+        "cpu_model": cpu_model(),
+        "logical_cpus": os.cpu_count(),
+        "mhz_per_cpu": context.get("mhz_per_cpu"),
+        "caches": [{key: cache_level.get(key) for key in ("type", "level", "size")}
+                   for cache_level in context.get("caches", [])],
+        "cpu_scaling_enabled": context.get("cpu_scaling_enabled"),
+        "scaling_governor": governor.strip() if governor else None,
+        "system": "%s %s" % (platform.system(), platform.release()),
+        "compiler": compiler_of(build_dir),
+        "build_type": cache.get("CMAKE_BUILD_TYPE", ""),
+        "cxx_flags": cache.get("CMAKE_CXX_FLAGS", ""),
+        "library_build_type": context.get("library_build_type"),
+        "revision": git_revision(),
+    }
+    comparable = json.dumps([result[field] for field in COMPARABLE_FIELDS])
+    result["id"] = hashlib.sha256(comparable.encode()).hexdigest()[:16]
+    return result
+
+
+def run_target(build_dir, target, benchmark_filter, repetitions, min_time):
+    executable = os.path.join(build_dir, "benchmarks", target + "-benchmark")
+    if not os.path.exists(executable):
+        raise RuntimeError("%s does not exist, build the target %s-benchmark first"
+                           % (executable, target))
+
+    out = os.path.join(build_dir, "perf-%s.raw.json" % target)
+    command = [executable,
+               "--benchmark_filter=" + benchmark_filter,
+               "--benchmark_repetitions=%d" % repetitions,
+               "--benchmark_enable_random_interleaving=true",
+               "--benchmark_min_time=%g" % min_time,
+               "--benchmark_out=" + out,
+               "--benchmark_out_format=json"]
+    print("running " + " ".join(command), file=sys.stderr)
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    with open(out) as f:
+        return json.load(f)
+
+
+def collect_samples(raw):
+    """The per-repetition times (in ns per operation) of the benchmarks of a raw result"""
+    scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    benchmarks = {}
+    for row in raw.get("benchmarks", []):
+        if row.get("run_type") == "aggregate" or "error_occurred" in row:
+            continue
+        name = row.get("run_name", row["name"])
+        # the time per iteration divided by the operations per iteration (if counted)
+        items = row.get("items_per_second")
+        if items:
+            time = 1e9 / items
+        else:
+            time = row["cpu_time"] * scale[row.get("time_unit", "ns")]
+        benchmarks.setdefault(name, []).append(time)
+    return benchmarks
+
+
+def run(args):
+    suite = dict(DEFAULT_SUITE)
+    if args.suite_from:
+        with open(args.suite_from) as f:
+            suite = json.load(f)["suite"]
+    if args.target:
+        suite = {target: suite.get(target, ".") for target in args.target}
+    if args.filter:
+        suite = {target: args.filter for target in suite}
+
+    context = {}
+    samples = {}
+    for target, benchmark_filter in sorted(suite.items()):
+        raw = run_target(args.build_dir, target, benchmark_filter, args.repetitions,
+                         args.min_time)
+        context = raw.get("context", context)
+        for name, times in collect_samples(raw).items():
+            samples[target + ":" + name] = times
+
+    result = {
+        "format_version": FORMAT_VERSION,
+        "date": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "fingerprint": fingerprint(args.build_dir, context),
+        "suite": suite,
+        "repetitions": args.repetitions,
+        "unit": "ns per operation",
+        "benchmarks": samples,
+    }
+    out = args.out or os.path.join(
+        args.build_dir, "perf-results",
+        "%s-%s.json" % (datetime.datetime.now().strftime("%Y%m%d-%H%M%S"),
+                        result["fingerprint"]["revision"][:12]))
+    os.makedirs(os.path.dirname(os.path.abspath(out)), exist_ok=True)
+    with open(out, "w") as f:
+        json.dump(result, f, indent=1, sort_keys=True)
+        f.write("\n")
+    print("wrote %d benchmarks to %s" % (len(samples), out), file=sys.stderr)
+    return out
+
+
+def median(values):
+    ordered = sorted(values)
+    n = len(ordered)
+    middle = n // 2
+    return ordered[middle] if n % 2 else (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def ranks(values):
+    """The ranks (starting at 1, ties get the mean rank) and the sizes of the groups of ties"""
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    result = [0.0] * len(values)
+    ties = []
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            result[order[k]] = (i + j) / 2 + 1
+        ties.append(j - i + 1)
+        i = j + 1
+    return result, ties
+
+
+def exact_u_distribution(n1, n2):
+    """The number of arrangements with U = 0, 1, ..., n1 * n2 (without ties)"""
+    # counts[i][j] is the distribution for the sample sizes i and j
+    counts = [[None] * (n2 + 1) for _ in range(n1 + 1)]
+    for i in range(n1 + 1):
+        for j in range(n2 + 1):
+            if i == 0 or j == 0:
+                counts[i][j] = [1]
+                continue
+            # the largest value is either in the first sample (it is larger than all j values of
+            # the second sample) or in the second sample
+            first = [0] * j + counts[i - 1][j]
+            second = counts[i][j - 1]
+            length = i * j + 1
+            counts[i][j] = [(first[u] if u < len(first) else 0) +
+                            (second[u] if u < len(second) else 0) for u in range(length)]
+    return counts[n1][n2]
+
+
+def mann_whitney(a, b):
+    """The two-sided p-value of the Mann-Whitney U test of the samples a and b"""
+    n1, n2 = len(a), len(b)
+    rank, ties = ranks(list(a) + list(b))
+    u1 = sum(rank[:n1]) - n1 * (n1 + 1) / 2
+    u = min(u1, n1 * n2 - u1)
+
+    if all(t == 1 for t in ties) and n1 * n2 <= 2500:
+        distribution = exact_u_distribution(n1, n2)
+        total = sum(distribution)
+        tail = sum(distribution[:int(u) + 1]) / total
+        return min(1.0, 2 * tail)
+
+    # normal approximation with tie and continuity correction
+    n = n1 + n2
+    tie_correction = sum(t ** 3 - t for t in ties) / (n * (n - 1))
+    variance = n1 * n2 / 12 * ((n + 1) - tie_correction)
+    if variance == 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+
+def bootstrap(a, b, resamples=2000, seed=42):
+    """The two-sided p-value of the bootstrapped ratio of the medians of b and a"""
+    rng = random.Random(seed)
+    below = 0
+    above = 0
+    for _ in range(resamples):
+        ratio = (median(rng.choices(b, k=len(b))) / median(rng.choices(a, k=len(a))))
+        below += ratio <= 1.0
+        above += ratio >= 1.0
+    return min(1.0, (2 * min(below, above) + 1) / (resamples + 1))
+
+
+def split_name(name):
+    """The operation and the rest of the name, e.g., Add and uinteger/64"""
+    target, _, benchmark = name.partition(":")
+    operation, _, rest = benchmark.partition("/")
+    return target, operation, rest or "-"
+
+
+def holm(p_values):
+    """The p-values adjusted for multiple comparisons with the Holm-Bonferroni method"""
+    order = sorted(range(len(p_values)), key=lambda i: p_values[i])
+    adjusted = [1.0] * len(p_values)
+    largest = 0.0
+    for position, i in enumerate(order):
+        largest = max(largest, min(1.0, (len(p_values) - position) * p_values[i]))
+        adjusted[i] = largest
+    return adjusted
+
+
+def compare_results(baseline, current, threshold, alpha, method, correct):
+    test = mann_whitney if method == "mannwhitney" else bootstrap
+    rows = []
+    for name in sorted(set(baseline["benchmarks"]) & set(current["benchmarks"])):
+        a = baseline["benchmarks"][name]
+        b = current["benchmarks"][name]
+        change = median(b) / median(a) - 1.0
+        # tests whether the change exceeds the threshold (not just whether there is a change)
+        factor = 1.0 + threshold if change > 0 else 1.0 - threshold
+        p = test([t * factor for t in a], b) if len(a) > 1 and len(b) > 1 else 1.0
+        rows.append({"name": name, "baseline": median(a), "current": median(b),
+                     "change": change, "p": p})
+
+    # many benchmarks are tested at once, without correction some are "significant" by chance
+    if correct:
+        for row, p in zip(rows, holm([row["p"] for row in rows])):
+            row["p"] = p
+
+    for row in rows:
+        if row["p"] < alpha and row["change"] > threshold:
+            row["verdict"] = "REGRESSION"
+        elif row["p"] < alpha and row["change"] < -threshold:
+            row["verdict"] = "improvement"
+        else:
+            row["verdict"] = ""
+    return rows
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.3g %s" % (ns / scale, unit)
+    return "%.3g ns" % ns
+
+
+def report(rows, baseline, current, threshold, alpha, method, correct, markdown):
+    lines = []
+    title = "Performance compared with the baseline"
+    lines.append("# " + title if markdown else title)
+    lines.append("")
+    for label, result in (("baseline", baseline), ("current", current)):
+        fp = result["fingerprint"]
+        lines.append("%s: %s, revision %s, %s, %s, %s %s" % (
+            label, result["date"], fp["revision"], fp["host"], fp["cpu_model"], fp["compiler"],
+            fp["build_type"]))
+    lines.append("%s with alpha = %g, threshold = %g%%%s" % (
+        "Mann-Whitney U test" if method == "mannwhitney" else "bootstrap", alpha,
+        100 * threshold, "" if correct else ", p-values not corrected"))
+    lines.append("")
+
+    groups = {}
+    for row in rows:
+        target, operation, rest = split_name(row["name"])
+        groups.setdefault((target, operation), []).append((rest, row))
+
+    for (target, operation), entries in sorted(groups.items()):
+        header = "%s: %s" % (target, operation)
+        if markdown:
+            lines.append("## " + header)
+            lines.append("")
+            lines.append("| benchmark | baseline | current | change | p | |")
+            lines.append("|---|---:|---:|---:|---:|---|")
+        else:
+            lines.append(header)
+        for rest, row in entries:
+            cells = (rest, format_time(row["baseline"]), format_time(row["current"]),
+                     "%+.1f%%" % (100 * row["change"]), "%.3g" % row["p"], row["verdict"])
+            if markdown:
+                lines.append("| %s |" % " | ".join(cells))
+            else:
+                lines.append("  %-32s %10s %10s %8s %8s  %s" % cells)
+        lines.append("")
+
+    regressions = [row for row in rows if row["verdict"] == "REGRESSION"]
+    improvements = [row for row in rows if row["verdict"] == "improvement"]
+    lines.append("%d benchmarks compared, %d regressions, %d improvements" % (
+        len(rows), len(regressions), len(improvements)))
+    for row in regressions:
+        lines.append("%sregression: %s %+.1f%%" % ("- " if markdown else "  ", row["name"],
+                                                    100 * row["change"]))
+    return "\n".join(lines) + "\n"
+
+
+def record_baseline(args):
+    """Records the default suite as the baseline of check"""
+    build_type = cmake_cache(args.build_dir).get("CMAKE_BUILD_TYPE", "")
+    if build_type != "Release":
+        print("warning: recording a baseline from a %s build, timings of Release builds are "
+              "more meaningful" % (build_type or "default"), file=sys.stderr)
+    args.suite_from = None
+    args.out = args.baseline
+    run(args)
+    print("recorded the baseline %s, later checks compare against it" % args.baseline,
+          file=sys.stderr)
+    return 0
+
+
+def check(args):
+    if not args.baseline:
+        args.baseline = os.path.join(args.build_dir, DEFAULT_BASELINE_NAME)
+    if not os.path.exists(args.baseline):
+        return record_baseline(args)
+    args.suite_from = args.baseline
+    return compare(args, args.baseline, run(args))
+
+
+def compare(args, baseline_path, current_path):
+    with open(baseline_path) as f:
+        baseline = json.load(f)
+    with open(current_path) as f:
+        current = json.load(f)
+
+    differences = ["the %s differs (%s vs. %s)" % (field, baseline["fingerprint"].get(field),
+                                                    current["fingerprint"].get(field))
+                   for field in COMPARABLE_FIELDS
+                   if baseline["fingerprint"].get(field) != current["fingerprint"].get(field)]
+    for difference in differences:
+        print("%s: %s" % ("warning" if args.force else "error", difference), file=sys.stderr)
+    if differences and not args.force:
+        print("error: the results are not comparable, record a new baseline on this machine and "
+              "with this build or pass --force", file=sys.stderr)
+        return 2
+    missing = sorted(set(baseline["benchmarks"]) - set(current["benchmarks"]))
+    if missing:
+        print("warning: %d benchmarks of the baseline were not run, e.g., %s" % (
+            len(missing), missing[0]), file=sys.stderr)
+
+    rows = compare_results(baseline, current, args.threshold, args.alpha, args.method,
+                           not args.no_correction)
+    correct = not args.no_correction
+    print(report(rows, baseline, current, args.threshold, args.alpha, args.method, correct,
+                 False))
+    if args.report:
+        with open(args.report, "w") as f:
+            f.write(report(rows, baseline, current, args.threshold, args.alpha, args.method,
+                           correct, True))
+    return 1 if any(row["verdict"] == "REGRESSION" for row in rows) else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    def add_run_arguments(command):
+        command.add_argument("--build-dir", required=True,
+                             help="build directory configured with BUILD_BENCHMARKS=ON")
+        command.add_argument("--target", action="append",
+                             help="benchmark target without -benchmark, e.g., integer-timing "
+                                  "(repeatable, default: the targets of the suite)")
+        command.add_argument("--filter", help="benchmark filter replacing the one of the suite")
+        command.add_argument("--repetitions", type=int, default=10)
+        command.add_argument("--min-time", type=float, default=0.1,
+                             help="minimal time per repetition in seconds")
+
+    def add_compare_arguments(command):
+        command.add_argument("--threshold", type=float, default=0.05,
+                             help="relative change that counts as regression (default 0.05)")
+        command.add_argument("--alpha", type=float, default=0.01,
+                             help="significance level (default 0.01)")
+        command.add_argument("--method", choices=("mannwhitney", "bootstrap"),
+                             default="mannwhitney")
+        command.add_argument("--no-correction", action="store_true",
+                             help="do not adjust the p-values for multiple comparisons")
+        command.add_argument("--report", help="writes the report as Markdown to this file")
+        command.add_argument("--force", action="store_true",
+                             help="compare even if the machines or builds differ")
+
+    run_command = commands.add_parser("run", help="run the benchmarks and store the results")
+    add_run_arguments(run_command)
+    run_command.add_argument("--suite-from", help="run the suite of this result file")
+    run_command.add_argument("--out", help="result file (default: <build-dir>/perf-results/)")
+
+    compare_command = commands.add_parser("compare", help="compare two result files")
+    compare_command.add_argument("baseline")
+    compare_command.add_argument("current")
+    add_compare_arguments(compare_command)
+
+    check_command = commands.add_parser("check",
+                                        help="run the suite of the baseline and compare with it")
+    add_run_arguments(check_command)
+    check_command.add_argument("--baseline",
+                               help="result file to compare with, recorded if it does not exist "
+                                    "(default: <build-dir>/%s)" % DEFAULT_BASELINE_NAME)
+    check_command.add_argument("--out", help="result file (default: <build-dir>/perf-results/)")
+    add_compare_arguments(check_command)
+
+    args = parser.parse_args()
+    try:
+        if args.command == "run":
+            run(args)
+            return 0
+        if args.command == "compare":
+            return compare(args, args.baseline, args.current)
+        return check(args)
+    except (OSError, RuntimeError, subprocess.CalledProcessError) as error:
+        print("error: %s" % error, file=sys.stderr)
+        return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,16 +1,26 @@
 #pragma once
 
 #include <aarith/core/word_array.hpp>
+#include <aarith/core/word_array_bit_manipulation.hpp>
 #include <aarith/core/word_array_cast_operations.hpp>
 #include <aarith/core/word_array_comparisons.hpp>
 #include <aarith/core/word_array_functional.hpp>
 #include <aarith/core/word_array_logical_operations.hpp>
 #include <aarith/core/word_array_operations.hpp>
 #include <aarith/core/word_array_shift_operations.hpp>
+#include <aarith/core/word_array_view.hpp>
 
 #include <aarith/core/traits.hpp>
 
+#include <aarith/core/limb_arena.hpp>
+#include <aarith/core/limb_operations.hpp>
+
 #include <aarith/core/core_number_utils.hpp>
 #include <aarith/core/core_string_utils.hpp>
 
-#include <aarith/core/word_array_random_generation.hpp>
\ No newline at end of file
+#include <aarith/core/random_engines.hpp>
+#include <aarith/core/word_array_random_generation.hpp>
+
+#include <aarith/core/thread_pool.hpp>
+
+#include <aarith/core/instrumentation.hpp>
\ No newline at end of file
@@ -12,8 +12,9 @@ namespace aarith {
 inline constexpr auto number_of_decimal_digits(size_t n_bits) -> size_t
 {
     // When converted to decimal, an n-bit binary numeral will have at most k*n decimal digits,
-    // rounded up, where k = log_10 2 ~ 0.301.
-    return (n_bits * 301) / 1000 + ((n_bits * 301) % 1000 == 0 ? 0 : 1); // NOLINT
+    // rounded up, where k = log_10 2 ~ 0.30103. (Rounding k down to 0.301 loses a digit for wide
+    // numbers, e.g., 2^4096 - 1 has 1234 digits.)
+    return (n_bits * 30103) / 100000 + ((n_bits * 30103) % 100000 == 0 ? 0 : 1); // NOLINT
 }
 
 /**
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace aarith {
+
+/**
+ * @brief Shifts an array of words to the left (towards the more significant words) in-place
+ *
+ * Every word of the result is assembled from (at most) two words of the input using a funnel
+ * shift. If the target supports AVX2, arrays of at least 512 bits of `uint64_t` words are shifted
+ * four words at a time.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @param words The words to shift
+ * @param count The number of words
+ * @param skip The number of whole words to shift by (must be less than count)
+ * @param shift The number of bits to additionally shift by (must be less than the word width)
+ */
+template <typename WordType>
+constexpr void funnel_shift_left_words(WordType* words, const size_t count, const size_t skip,
+                                       const size_t shift)
+{
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+
+    // the index of the word that has been written last
+    size_t i = count;
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        if (!__builtin_is_constant_evaluated() && count >= 8)
+        {
+            // shifting by 64 bits yields zero, i.e., a shift of zero needs no special treatment
+            const __m128i left = _mm_cvtsi64_si128(static_cast<long long>(shift));
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(word_width - shift));
+            // the words are read before they are overwritten as the loop runs downwards
+            while (i >= skip + 5)
+            {
+                i -= 4;
+                const __m256i high =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + (i - skip)));
+                const __m256i low =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + (i - skip - 1)));
+                const __m256i result =
+                    _mm256_or_si256(_mm256_sll_epi64(high, left), _mm256_srl_epi64(low, right));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i), result);
+            }
+        }
+    }
+#endif
+
+    if (shift == 0)
+    {
+        for (; i > skip; --i)
+        {
+            words[i - 1] = words[i - 1 - skip];
+        }
+    }
+    else
+    {
+        for (; i > skip + 1; --i)
+        {
+            words[i - 1] = static_cast<WordType>(words[i - 1 - skip] << shift) |
+                           static_cast<WordType>(words[i - 2 - skip] >> (word_width - shift));
+        }
+        words[skip] = static_cast<WordType>(words[0] << shift);
+    }
+
+    for (size_t j = 0; j < skip; ++j)
+    {
+        words[j] = WordType{0};
+    }
+}
+
+/**
+ * @brief Shifts an array of words to the right (towards the less significant words) in-place
+ *
+ * @see funnel_shift_left_words
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @param words The words to shift
+ * @param count The number of words
+ * @param skip The number of whole words to shift by (must be less than count)
+ * @param shift The number of bits to additionally shift by (must be less than the word width)
+ */
+template <typename WordType>
+constexpr void funnel_shift_right_words(WordType* words, const size_t count, const size_t skip,
+                                        const size_t shift)
+{
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+
+    // the index of the next word to write
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<WordType, uint64_t>)
+    {
+        if (!__builtin_is_constant_evaluated() && count >= 8)
+        {
+            const __m128i right = _mm_cvtsi64_si128(static_cast<long long>(shift));
+            const __m128i left = _mm_cvtsi64_si128(static_cast<long long>(word_width - shift));
+            // the words are read before they are overwritten as the loop runs upwards
+            while (i + skip + 4 < count)
+            {
+                const __m256i low =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + (i + skip)));
+                const __m256i high =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + (i + skip + 1)));
+                const __m256i result =
+                    _mm256_or_si256(_mm256_srl_epi64(low, right), _mm256_sll_epi64(high, left));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i), result);
+                i += 4;
+            }
+        }
+    }
+#endif
+
+    if (shift == 0)
+    {
+        for (; i + skip < count; ++i)
+        {
+            words[i] = words[i + skip];
+        }
+    }
+    else
+    {
+        for (; i + skip + 1 < count; ++i)
+        {
+            words[i] = static_cast<WordType>(words[i + skip] >> shift) |
+                       static_cast<WordType>(words[i + skip + 1] << (word_width - shift));
+        }
+        words[i] = static_cast<WordType>(words[i + skip] >> shift);
+        ++i;
+    }
+
+    for (; i < count; ++i)
+    {
+        words[i] = WordType{0};
+    }
+}
+
+} // namespace aarith
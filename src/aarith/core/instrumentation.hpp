@@ -0,0 +1,534 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(AARITH_INSTRUMENTATION_TIMERS) && !defined(AARITH_INSTRUMENTATION)
+#define AARITH_INSTRUMENTATION
+#endif
+
+#if defined(AARITH_INSTRUMENTATION)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <tuple>
+#else
+#include <ostream>
+#endif
+
+#if defined(AARITH_INSTRUMENTATION_TIMERS) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+/**
+ * @file instrumentation.hpp
+ *
+ * Optional counters (and timers) of the hot paths of aarith, e.g., to find out how many mantissa
+ * additions, normalizations and limb multiplications a workload performs.
+ *
+ * The instrumentation is disabled by default and then compiles to nothing. Define
+ * `AARITH_INSTRUMENTATION` (or link against `aarith::Instrumented`) to count the calls of the
+ * instrumented operations per operation, width and format. Define `AARITH_INSTRUMENTATION_TIMERS`
+ * to additionally measure the time spent in them (in time stamp counter ticks on x86, in
+ * nanoseconds elsewhere). The times are inclusive, i.e., the time of `normalize` includes the time
+ * of the `rshift_and_round` it calls, and each measurement adds the overhead of reading the time
+ * stamp counter twice.
+ *
+ * Every thread counts on its own, operation_counts() sums up the counts of all threads (including
+ * those that have already finished).
+ *
+ * @note All translation units of a program have to agree on the definitions, otherwise the
+ * operations of one translation unit are used by the others (or not) depending on the linker. For
+ * the same reason, operations taken from the explicit instantiations (see instantiations.hpp) are
+ * only counted if the instantiations were compiled with the instrumentation.
+ *
+ * Without the instrumentation, this header only declares the (empty) scopes and the functions
+ * returning the counts, it does not include the headers the counters need (e.g., <iostream> and
+ * <mutex>).
+ */
+
+namespace aarith {
+
+/**
+ * @brief Whether the calls of the instrumented operations are counted
+ */
+#if defined(AARITH_INSTRUMENTATION)
+constexpr bool instrumentation_enabled = true;
+#else
+constexpr bool instrumentation_enabled = false;
+#endif
+
+/**
+ * @brief Whether the time spent in the instrumented operations is measured
+ */
+#if defined(AARITH_INSTRUMENTATION_TIMERS)
+constexpr bool instrumentation_timers_enabled = true;
+#else
+constexpr bool instrumentation_timers_enabled = false;
+#endif
+
+/**
+ * @brief The number of calls of (and the time spent in) an operation on one width and format
+ */
+struct operation_count
+{
+    /// The name of the operation, e.g., add_
+    std::string operation;
+    /// The width of the operands in bits
+    size_t width;
+    /// The format of floating-point operands (e.g., "floating_point<8, 23>"), empty for integers
+    std::string format;
+    /// The number of calls
+    uint64_t calls;
+    /// The time spent in the operation (zero unless the timers are enabled)
+    uint64_t ticks;
+};
+
+namespace instrumentation {
+
+/**
+ * @brief Declares the tag of an instrumented operation
+ *
+ * Tags identify the operations in the counts, they are types so that every instantiation of an
+ * instrumented function gets its own counter.
+ */
+#define AARITH_INSTRUMENTED_OPERATION(tag)                                                         \
+    struct tag                                                                                     \
+    {                                                                                              \
+        static constexpr const char* name = #tag;                                                  \
+    }
+
+AARITH_INSTRUMENTED_OPERATION(add_);
+AARITH_INSTRUMENTED_OPERATION(normalize);
+AARITH_INSTRUMENTED_OPERATION(round_and_pack);
+AARITH_INSTRUMENTED_OPERATION(round_and_pack_wide);
+AARITH_INSTRUMENTED_OPERATION(rshift_and_round);
+AARITH_INSTRUMENTED_OPERATION(schoolbook_expanding_mul);
+AARITH_INSTRUMENTED_OPERATION(restoring_division);
+AARITH_INSTRUMENTED_OPERATION(anytime_add);
+AARITH_INSTRUMENTED_OPERATION(anytime_sub);
+AARITH_INSTRUMENTED_OPERATION(anytime_mul);
+AARITH_INSTRUMENTED_OPERATION(anytime_div);
+AARITH_INSTRUMENTED_OPERATION(FAU_add);
+AARITH_INSTRUMENTED_OPERATION(FAU_sub);
+AARITH_INSTRUMENTED_OPERATION(FAUadder);
+AARITH_INSTRUMENTED_OPERATION(approx_operation_post_masking);
+AARITH_INSTRUMENTED_OPERATION(approx_operation_pre_masking);
+AARITH_INSTRUMENTED_OPERATION(approx_uint_bitmasking_mul);
+AARITH_INSTRUMENTED_OPERATION(trivial_approx_add);
+
+#undef AARITH_INSTRUMENTED_OPERATION
+
+/**
+ * @brief The unit of the measured times
+ */
+#if defined(AARITH_INSTRUMENTATION_TIMERS) && (defined(__x86_64__) || defined(__i386__))
+constexpr const char* tick_unit = "ticks";
+#else
+constexpr const char* tick_unit = "ns";
+#endif
+
+#if defined(AARITH_INSTRUMENTATION)
+/**
+ * @brief Reads the time stamp counter (or a nanosecond clock if there is none)
+ */
+[[nodiscard]] inline uint64_t ticks()
+{
+#if defined(AARITH_INSTRUMENTATION_TIMERS) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+/**
+ * @brief The counter of one operation on one width and format in one thread
+ *
+ * Only the owning thread writes the counter, the relaxed load and store (instead of an atomic
+ * increment) make reading it from other threads well-defined without slowing down the owner.
+ */
+struct counter
+{
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> ticks{0};
+
+    void count(const uint64_t elapsed = 0)
+    {
+        calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (elapsed != 0)
+        {
+            ticks.store(ticks.load(std::memory_order_relaxed) + elapsed,
+                        std::memory_order_relaxed);
+        }
+    }
+};
+
+class thread_counters;
+
+/**
+ * @brief The counters of all threads and the counts of the threads that have finished
+ */
+struct registry
+{
+    std::mutex mutex;
+    std::vector<thread_counters*> threads;
+    std::vector<operation_count> finished;
+
+    /**
+     * @brief Returns the registry of the program
+     *
+     * The registry is never destroyed as threads may finish after the static objects have been
+     * destroyed.
+     */
+    static registry& global()
+    {
+        static registry* instance = new registry;
+        return *instance;
+    }
+};
+
+/**
+ * @brief Adds the count to the matching count in the list (or appends it)
+ */
+inline void accumulate(std::vector<operation_count>& counts, const operation_count& count)
+{
+    for (operation_count& existing : counts)
+    {
+        if (existing.operation == count.operation && existing.width == count.width &&
+            existing.format == count.format)
+        {
+            existing.calls += count.calls;
+            existing.ticks += count.ticks;
+            return;
+        }
+    }
+    counts.push_back(count);
+}
+
+/**
+ * @brief The counters of one thread
+ */
+class thread_counters
+{
+public:
+    thread_counters()
+    {
+        registry& r = registry::global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        r.threads.push_back(this);
+    }
+
+    thread_counters(const thread_counters&) = delete;
+    thread_counters& operator=(const thread_counters&) = delete;
+
+    ~thread_counters()
+    {
+        registry& r = registry::global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        collect(r.finished);
+        r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+    }
+
+    /**
+     * @brief Returns the counters of the calling thread
+     */
+    static thread_counters& local()
+    {
+        thread_local thread_counters counters;
+        return counters;
+    }
+
+    /**
+     * @brief Returns the counter of the operation on the given width and format (adding it)
+     */
+    counter& get(const char* operation, const size_t width, std::string format)
+    {
+        const std::lock_guard<std::mutex> lock(registry::global().mutex);
+        entries_.emplace_back(operation, width, std::move(format));
+        return entries_.back().value;
+    }
+
+    /**
+     * @brief Adds the counts of this thread to the list (the registry has to be locked)
+     */
+    void collect(std::vector<operation_count>& counts) const
+    {
+        for (const entry& e : entries_)
+        {
+            accumulate(counts, operation_count{e.operation, e.width, e.format,
+                                               e.value.calls.load(std::memory_order_relaxed),
+                                               e.value.ticks.load(std::memory_order_relaxed)});
+        }
+    }
+
+    /**
+     * @brief Sets all counters of this thread to zero (the registry has to be locked)
+     */
+    void reset()
+    {
+        for (entry& e : entries_)
+        {
+            e.value.calls.store(0, std::memory_order_relaxed);
+            e.value.ticks.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct entry
+    {
+        entry(const char* operation_, const size_t width_, std::string format_)
+            : operation(operation_)
+            , width(width_)
+            , format(std::move(format_))
+        {
+        }
+
+        const char* operation;
+        size_t width;
+        std::string format;
+        counter value;
+    };
+
+    // a deque does not move its elements, the instrumented functions keep references to them
+    std::deque<entry> entries_;
+};
+
+/**
+ * @brief Returns the format of floating-point numbers as it is shown in the counts
+ */
+template <size_t E, size_t M> [[nodiscard]] std::string float_format()
+{
+    return "floating_point<" + std::to_string(E) + ", " + std::to_string(M) + ">";
+}
+
+/**
+ * @brief Returns the counter of the calling thread for the operation on the width and format
+ *
+ * @tparam Operation The tag of the operation
+ * @tparam Width The width of the operands in bits
+ * @tparam E The exponent width of floating-point operands (zero for integers)
+ * @tparam M The mantissa width of floating-point operands (zero for integers)
+ */
+template <typename Operation, size_t Width, size_t E = 0, size_t M = 0>
+[[nodiscard]] counter& local_counter()
+{
+    thread_local counter& c = thread_counters::local().get(
+        Operation::name, Width, (E == 0 && M == 0) ? std::string{} : float_format<E, M>());
+    return c;
+}
+
+/**
+ * @brief Returns whether the call is evaluated at runtime (only then the counters can be used)
+ */
+[[nodiscard]] constexpr bool is_runtime()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+#endif
+
+} // namespace instrumentation
+
+/**
+ * @brief Counts (and times) the instrumented operation for as long as it exists
+ *
+ * Declare a scope at the beginning of an instrumented function. If the instrumentation is
+ * disabled, the scope is empty and does nothing.
+ *
+ * @note A scope cannot be used in constexpr functions, use instrumented() there.
+ *
+ * @tparam Operation The tag of the operation (see namespace instrumentation)
+ * @tparam Width The width of the operands in bits
+ * @tparam E The exponent width of floating-point operands (zero for integers)
+ * @tparam M The mantissa width of floating-point operands (zero for integers)
+ */
+#if defined(AARITH_INSTRUMENTATION)
+template <typename Operation, size_t Width, size_t E = 0, size_t M = 0> class operation_scope
+{
+public:
+    operation_scope()
+        : counter_(instrumentation::local_counter<Operation, Width, E, M>())
+    {
+        if constexpr (instrumentation_timers_enabled)
+        {
+            start_ = instrumentation::ticks();
+        }
+    }
+
+    operation_scope(const operation_scope&) = delete;
+    operation_scope& operator=(const operation_scope&) = delete;
+
+    ~operation_scope()
+    {
+        counter_.count(instrumentation_timers_enabled ? instrumentation::ticks() - start_ : 0);
+    }
+
+private:
+    instrumentation::counter& counter_;
+    uint64_t start_ = 0;
+};
+#else
+template <typename Operation, size_t Width, size_t E = 0, size_t M = 0> class operation_scope
+{
+public:
+    constexpr operation_scope() noexcept
+    {
+    }
+};
+#endif
+
+#if defined(AARITH_INSTRUMENTATION)
+namespace instrumentation {
+
+/**
+ * @brief Counts (and times) the call of the function
+ */
+template <typename Operation, size_t Width, size_t E, size_t M, typename Function>
+auto measure(Function&& function) -> decltype(function())
+{
+    const operation_scope<Operation, Width, E, M> scope;
+    return function();
+}
+
+} // namespace instrumentation
+#endif
+
+/**
+ * @brief Evaluates the function, counting (and timing) it as the instrumented operation
+ *
+ * This is the variant of operation_scope for constexpr functions: calls during constant
+ * evaluation are not counted. If the instrumentation is disabled, it simply calls the function.
+ *
+ * @tparam Operation The tag of the operation (see namespace instrumentation)
+ * @tparam Width The width of the operands in bits
+ * @tparam E The exponent width of floating-point operands (zero for integers)
+ * @tparam M The mantissa width of floating-point operands (zero for integers)
+ * @param function The body of the operation
+ * @return The result of the function
+ */
+template <typename Operation, size_t Width, size_t E = 0, size_t M = 0, typename Function>
+constexpr auto instrumented(Function&& function) -> decltype(function())
+{
+#if defined(AARITH_INSTRUMENTATION)
+    if (instrumentation::is_runtime())
+    {
+        return instrumentation::measure<Operation, Width, E, M>(function);
+    }
+#endif
+    return function();
+}
+
+#if defined(AARITH_INSTRUMENTATION)
+/**
+ * @brief Returns the counts of all threads sorted by operation, format and width
+ */
+[[nodiscard]] inline std::vector<operation_count> operation_counts()
+{
+    std::vector<operation_count> counts;
+    {
+        instrumentation::registry& r = instrumentation::registry::global();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        for (const operation_count& count : r.finished)
+        {
+            instrumentation::accumulate(counts, count);
+        }
+        for (const instrumentation::thread_counters* counters : r.threads)
+        {
+            counters->collect(counts);
+        }
+    }
+
+    counts.erase(std::remove_if(counts.begin(), counts.end(),
+                                [](const operation_count& c) { return c.calls == 0; }),
+                 counts.end());
+    std::sort(counts.begin(), counts.end(), [](const operation_count& a, const operation_count& b) {
+        return std::tie(a.operation, a.format, a.width) < std::tie(b.operation, b.format, b.width);
+    });
+    return counts;
+}
+
+/**
+ * @brief Sets the counts of all threads to zero
+ */
+inline void reset_operation_counts()
+{
+    instrumentation::registry& r = instrumentation::registry::global();
+    const std::lock_guard<std::mutex> lock(r.mutex);
+    r.finished.clear();
+    for (instrumentation::thread_counters* counters : r.threads)
+    {
+        counters->reset();
+    }
+}
+
+/**
+ * @brief Writes the counts of all threads as a table (one row per operation, format and width)
+ *
+ * @param out The stream to write the table to
+ */
+inline void dump_operation_counts(std::ostream& out = std::cerr)
+{
+    const std::string unit{instrumentation::tick_unit};
+    out << std::left << std::setw(32) << "operation" << std::setw(24) << "format" << std::right
+        << std::setw(8) << "width" << std::setw(16) << "calls";
+    if constexpr (instrumentation_timers_enabled)
+    {
+        out << std::setw(18) << unit << std::setw(14) << (unit + "/call");
+    }
+    out << '\n';
+
+    for (const operation_count& count : operation_counts())
+    {
+        out << std::left << std::setw(32) << count.operation << std::setw(24)
+            << (count.format.empty() ? "-" : count.format) << std::right << std::setw(8)
+            << count.width << std::setw(16) << count.calls;
+        if constexpr (instrumentation_timers_enabled)
+        {
+            out << std::setw(18) << count.ticks << std::setw(14) << std::fixed
+                << std::setprecision(1)
+                << static_cast<double>(count.ticks) / static_cast<double>(count.calls);
+        }
+        out << '\n';
+    }
+}
+#else
+/**
+ * @brief Returns the counts of all threads, i.e., nothing as the instrumentation is disabled
+ */
+[[nodiscard]] inline std::vector<operation_count> operation_counts()
+{
+    return {};
+}
+
+/**
+ * @brief Does nothing as the instrumentation is disabled
+ */
+inline void reset_operation_counts()
+{
+}
+
+/**
+ * @brief Writes that nothing was counted as the instrumentation is disabled
+ *
+ * @note Unlike with the instrumentation, the stream has to be given (<iostream> is not included).
+ *
+ * @param out The stream to write the note to
+ */
+inline void dump_operation_counts(std::ostream& out)
+{
+    out << "aarith was compiled without AARITH_INSTRUMENTATION, nothing was counted\n";
+}
+#endif
+
+} // namespace aarith
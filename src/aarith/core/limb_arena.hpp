@@ -0,0 +1,326 @@
+#pragma once
+
+#include <aarith/core/limb_operations.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file limb_arena.hpp
+ *
+ * Thread-local scratch memory for the algorithms on wide integers. The intermediate results of,
+ * e.g., the Karazuba multiplication of two `uinteger<65536>` do not fit onto the small stacks of
+ * worker threads. Instead of allocating them on the stack (or with one malloc per operation),
+ * they are taken from an arena that is only rewound once the operation is done.
+ */
+
+namespace aarith {
+
+/**
+ * @brief The width (in bits) from which on the algorithms on wide integers keep their
+ * intermediate results in the limb_arena instead of on the stack
+ *
+ * Define `AARITH_ARENA_SCRATCH_THRESHOLD` to change the width (or set it to zero to never use the
+ * arena).
+ */
+#if defined(AARITH_ARENA_SCRATCH_THRESHOLD)
+constexpr size_t arena_scratch_threshold = AARITH_ARENA_SCRATCH_THRESHOLD;
+#else
+constexpr size_t arena_scratch_threshold = 2048;
+#endif
+
+/**
+ * @brief Returns whether the intermediate results for the given width are kept in the limb_arena
+ */
+template <size_t Width, typename WordType>
+[[nodiscard]] constexpr bool uses_limb_arena()
+{
+    return std::is_same_v<WordType, limb> && arena_scratch_threshold > 0 &&
+           Width >= arena_scratch_threshold;
+}
+
+/**
+ * @brief Bump allocator for limbs
+ *
+ * The arena consists of a list of chunks. Allocating advances a pointer in the current chunk (or
+ * moves to the next chunk), all chunks are kept until the arena is destroyed. Memory is never
+ * freed individually, instead the arena is rewound to a previously taken marker (or reset
+ * entirely) in constant time.
+ *
+ * Use scratch_scope to rewind the arena automatically.
+ */
+class limb_arena
+{
+public:
+    /**
+     * @brief Position in the arena that the arena can be rewound to
+     */
+    struct marker
+    {
+        size_t chunk;
+        size_t used;
+    };
+
+    /**
+     * @brief The number of limbs of the first chunk of the arena
+     */
+    static constexpr size_t initial_chunk_size = 4096;
+
+    limb_arena() = default;
+    limb_arena(const limb_arena&) = delete;
+    limb_arena& operator=(const limb_arena&) = delete;
+
+    /**
+     * @brief Returns the arena of the calling thread
+     */
+    static limb_arena& local()
+    {
+        thread_local limb_arena arena;
+        return arena;
+    }
+
+    /**
+     * @brief Returns uninitialized memory for the given number of limbs
+     *
+     * The memory stays valid until the arena is rewound to a marker taken before this call.
+     */
+    [[nodiscard]] limb* allocate(const size_t count)
+    {
+        while (current < chunks.size() && chunks[current].size - used < count)
+        {
+            // the remainder of a chunk is skipped if the request does not fit
+            ++current;
+            used = 0;
+        }
+        if (current == chunks.size())
+        {
+            const size_t previous = chunks.empty() ? initial_chunk_size / 2 : chunks.back().size;
+            const size_t size = std::max(2 * previous, count);
+            chunks.push_back(chunk{std::make_unique<limb[]>(size), size});
+            used = 0;
+        }
+        limb* result = chunks[current].memory.get() + used;
+        used += count;
+        return result;
+    }
+
+    /**
+     * @brief Returns zero-initialized memory for the given number of limbs
+     */
+    [[nodiscard]] limb* allocate_zeroed(const size_t count)
+    {
+        limb* result = allocate(count);
+        std::fill(result, result + count, limb{0});
+        return result;
+    }
+
+    [[nodiscard]] marker mark() const noexcept
+    {
+        return marker{current, used};
+    }
+
+    /**
+     * @brief Releases all memory allocated after the marker has been taken
+     */
+    void rewind(const marker m) noexcept
+    {
+        current = m.chunk;
+        used = m.used;
+    }
+
+    /**
+     * @brief Releases all allocated memory (but keeps the chunks for further allocations)
+     */
+    void reset() noexcept
+    {
+        current = 0;
+        used = 0;
+    }
+
+    /**
+     * @brief Returns the number of limbs the arena can hold without allocating a new chunk
+     */
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        size_t result = 0;
+        for (const auto& c : chunks)
+        {
+            result += c.size;
+        }
+        return result;
+    }
+
+private:
+    struct chunk
+    {
+        std::unique_ptr<limb[]> memory;
+        size_t size;
+    };
+
+    std::vector<chunk> chunks;
+    size_t current{0};
+    size_t used{0};
+};
+
+/**
+ * @brief Scratch memory that is released when the scope ends
+ *
+ * Scopes have to be nested (which they are when they are local variables): the memory of a
+ * scope is released when the scope ends, including the memory of all scopes opened after it.
+ */
+class scratch_scope
+{
+public:
+    explicit scratch_scope(limb_arena& arena = limb_arena::local())
+        : arena(arena)
+        , start(arena.mark())
+    {
+    }
+
+    scratch_scope(const scratch_scope&) = delete;
+    scratch_scope& operator=(const scratch_scope&) = delete;
+
+    ~scratch_scope()
+    {
+        arena.rewind(start);
+    }
+
+    /**
+     * @brief Returns uninitialized memory for the given number of limbs
+     */
+    [[nodiscard]] limb* allocate(const size_t count)
+    {
+        return arena.allocate(count);
+    }
+
+    /**
+     * @brief Returns zero-initialized memory for the given number of limbs
+     */
+    [[nodiscard]] limb* allocate_zeroed(const size_t count)
+    {
+        return arena.allocate_zeroed(count);
+    }
+
+    /**
+     * @brief Returns a zero-extended (or truncated) copy of the given limbs
+     */
+    [[nodiscard]] limb* copy(const limb* source, const size_t source_count, const size_t count)
+    {
+        limb* result = allocate(count);
+        const size_t copied = std::min(source_count, count);
+        std::copy(source, source + copied, result);
+        std::fill(result + copied, result + count, limb{0});
+        return result;
+    }
+
+    [[nodiscard]] limb_arena& underlying_arena() noexcept
+    {
+        return arena;
+    }
+
+private:
+    limb_arena& arena;
+    limb_arena::marker start;
+};
+
+/**
+ * @brief The number of limbs below which karazuba_limbs uses the schoolbook method
+ */
+constexpr size_t karazuba_limb_threshold = 24;
+
+/**
+ * @brief Computes the full product r = a * b of two numbers of n limbs each using the Karazuba
+ * algorithm
+ *
+ * The intermediate results are taken from the given scratch scope.
+ *
+ * @param r The product (2n limbs), must not alias the factors
+ */
+AARITH_KERNEL void karazuba_limbs(limb* r, const limb* a, const limb* b, const size_t n,
+                                  scratch_scope& scratch);
+
+/**
+ * @brief Converts an unsigned number into its decimal representation
+ *
+ * The number is repeatedly divided by the largest power of ten fitting into a limb, the copy of
+ * the number that is divided is taken from the limb_arena of the calling thread.
+ */
+[[nodiscard]] AARITH_KERNEL std::string limbs_to_decimal(const limb* a, const size_t n);
+
+#if !defined(AARITH_SEPARATE_KERNELS) || defined(AARITH_COMPILING_KERNELS)
+
+AARITH_KERNEL void karazuba_limbs(limb* r, const limb* a, const limb* b, const size_t n,
+                                  scratch_scope& scratch)
+{
+    if (n < karazuba_limb_threshold)
+    {
+        mul_limbs(r, a, n, b, n);
+        return;
+    }
+
+    const size_t low = n / 2;
+    const size_t high = n - low;
+    const size_t sum_count = high + 1;
+
+    scratch_scope level{scratch.underlying_arena()};
+
+    // (a1 + a0) and (b1 + b0)
+    limb* sum_a = level.copy(a + low, high, sum_count);
+    limb* sum_b = level.copy(b + low, high, sum_count);
+    add_into_limbs(sum_a, sum_count, a, low);
+    add_into_limbs(sum_b, sum_count, b, low);
+
+    // r = a0 b0 + a1 b1 B^(2 low)
+    karazuba_limbs(r, a, b, low, level);
+    karazuba_limbs(r + 2 * low, a + low, b + low, high, level);
+
+    // (a1 + a0)(b1 + b0) - a0 b0 - a1 b1 = a1 b0 + a0 b1
+    limb* middle = level.allocate(2 * sum_count);
+    karazuba_limbs(middle, sum_a, sum_b, sum_count, level);
+    sub_from_limbs(middle, 2 * sum_count, r, 2 * low);
+    sub_from_limbs(middle, 2 * sum_count, r + 2 * low, 2 * high);
+
+    // the middle term is less than B^(2 high + 1) and therefore fits into the remaining limbs
+    const size_t middle_count = std::min(2 * sum_count, 2 * n - low);
+    add_into_limbs(r + low, 2 * n - low, middle, middle_count);
+}
+
+AARITH_KERNEL std::string limbs_to_decimal(const limb* a, const size_t n)
+{
+    constexpr limb chunk_divisor = 10'000'000'000'000'000'000U;
+    constexpr size_t chunk_digits = 19;
+
+    scratch_scope scratch;
+    limb* remaining = scratch.copy(a, n, n);
+
+    std::string result;
+    while (true)
+    {
+        limb chunk = div_limbs_by_limb(remaining, remaining, n, chunk_divisor);
+        const bool last = is_zero_limbs(remaining, n);
+        for (size_t i = 0; i < chunk_digits && (!last || chunk != 0U); ++i)
+        {
+            result += static_cast<char>('0' + chunk % 10U);
+            chunk /= 10U;
+        }
+        if (last)
+        {
+            break;
+        }
+    }
+
+    if (result.empty())
+    {
+        result = "0";
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+#endif
+
+} // namespace aarith
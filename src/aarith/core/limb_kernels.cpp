@@ -0,0 +1,11 @@
+/**
+ * @file limb_kernels.cpp
+ *
+ * The single translation unit of the aarith_kernels library: it contains the out-of-line
+ * definitions of the limb kernels declared in limb_operations.hpp and limb_arena.hpp.
+ */
+
+#define AARITH_COMPILING_KERNELS
+
+#include <aarith/core/limb_arena.hpp>
+#include <aarith/core/limb_operations.hpp>
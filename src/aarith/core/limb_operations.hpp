@@ -0,0 +1,565 @@
+#pragma once
+
+#include <aarith/core/funnel_shift.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file limb_operations.hpp
+ *
+ * Width-agnostic arithmetic kernels on spans of 64-bit limbs. The limbs are stored least
+ * significant limb first (like the words of a word_array). The kernels are not templated over
+ * the width, they are shared by all integers whose width is only known at run time.
+ *
+ * Unless noted otherwise, the result may alias any of the operands.
+ *
+ * By default, the kernels are defined inline in this header. If `AARITH_SEPARATE_KERNELS` is
+ * defined, only their declarations are seen and the definitions are compiled once into the
+ * `aarith_kernels` library (build aarith with `-DBUILD_KERNELS=ON` and link against
+ * `aarith::Kernels`, which also defines the macro).
+ */
+
+#if defined(AARITH_SEPARATE_KERNELS)
+#define AARITH_KERNEL
+#else
+#define AARITH_KERNEL inline
+#endif
+
+namespace aarith {
+
+using limb = uint64_t;
+
+constexpr size_t limb_width = sizeof(limb) * CHAR_BIT;
+
+/**
+ * @brief Multiplies two words returning the (high, low) words of the double-width product
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <typename WordType>
+[[nodiscard]] constexpr std::pair<WordType, WordType> mul_word(const WordType a, const WordType b)
+{
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+
+    if constexpr (word_width <= 32)
+    {
+        const uint64_t product = uint64_t{a} * uint64_t{b};
+        return {static_cast<WordType>(product >> word_width), static_cast<WordType>(product)};
+    }
+#if defined(__SIZEOF_INT128__)
+    else if constexpr (word_width == 64)
+    {
+        __extension__ typedef unsigned __int128 uint128;
+        const uint128 product = static_cast<uint128>(a) * b;
+        return {static_cast<WordType>(product >> word_width), static_cast<WordType>(product)};
+    }
+#endif
+    else
+    {
+        constexpr size_t half = word_width / 2;
+        constexpr WordType low_mask = (WordType{1} << half) - 1U;
+
+        const WordType a_low = a & low_mask;
+        const WordType a_high = a >> half;
+        const WordType b_low = b & low_mask;
+        const WordType b_high = b >> half;
+
+        const WordType low_low = a_low * b_low;
+        const WordType low_high = a_low * b_high;
+        const WordType high_low = a_high * b_low;
+        const WordType high_high = a_high * b_high;
+
+        const WordType middle = (low_low >> half) + (low_high & low_mask) + (high_low & low_mask);
+        const WordType low = (middle << half) | (low_low & low_mask);
+        const WordType high = high_high + (low_high >> half) + (high_low >> half) + (middle >> half);
+        return {high, low};
+    }
+}
+
+/**
+ * @brief Returns the number of limbs needed to store the given number of bits
+ */
+[[nodiscard]] inline constexpr size_t limb_count(const size_t width)
+{
+    return (width + limb_width - 1) / limb_width;
+}
+
+/**
+ * @brief Returns the mask of the bits of the most significant limb that are used
+ */
+[[nodiscard]] inline constexpr limb top_limb_mask(const size_t width)
+{
+    const size_t used = width % limb_width;
+    return used == 0 ? ~limb{0} : (limb{1} << used) - 1U;
+}
+
+/**
+ * @brief The width (in bits) from which on the algorithms on word_arrays of limbs call the limb
+ * kernels instead of their fully unrolled inline implementations
+ *
+ * Define `AARITH_KERNEL_WIDTH_THRESHOLD` to change the width.
+ */
+#if defined(AARITH_KERNEL_WIDTH_THRESHOLD)
+constexpr size_t kernel_width_threshold = AARITH_KERNEL_WIDTH_THRESHOLD;
+#else
+constexpr size_t kernel_width_threshold = 256;
+#endif
+
+/**
+ * @brief Returns whether the algorithms on word_arrays of the given width call the limb kernels
+ */
+template <size_t Width, typename WordType>
+[[nodiscard]] constexpr bool uses_limb_kernels()
+{
+    return std::is_same_v<WordType, limb> && Width >= kernel_width_threshold;
+}
+
+/**
+ * @brief Returns whether the limb kernels can be called
+ *
+ * The kernels are not constexpr, during constant evaluation the word_array algorithms fall back
+ * to their (slower) constexpr implementations.
+ */
+[[nodiscard]] constexpr bool use_limb_kernels()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Clears the bits of the most significant limb that are beyond the width
+ */
+AARITH_KERNEL void mask_limbs(limb* r, const size_t width);
+
+/**
+ * @brief Sign-extends the most significant limb beyond the width (i.e. fills the unused bits
+ * with the bit at index width-1)
+ */
+AARITH_KERNEL void sign_extend_limbs(limb* r, const size_t width);
+
+[[nodiscard]] AARITH_KERNEL bool is_zero_limbs(const limb* a, const size_t n);
+
+/**
+ * @brief Computes r = a + b + carry and returns the carry out of the most significant limb
+ */
+AARITH_KERNEL limb add_limbs(limb* r, const limb* a, const limb* b, const size_t n,
+                             limb carry = 0U);
+
+/**
+ * @brief Computes r = a - b and returns the borrow out of the most significant limb
+ */
+AARITH_KERNEL limb sub_limbs(limb* r, const limb* a, const limb* b, const size_t n);
+
+/**
+ * @brief Computes r += a where a has at most as many limbs as r, returns the carry out of r
+ */
+AARITH_KERNEL limb add_into_limbs(limb* r, const size_t r_count, const limb* a,
+                                  const size_t a_count);
+
+/**
+ * @brief Computes r -= a where a has at most as many limbs as r, returns the borrow out of r
+ */
+AARITH_KERNEL limb sub_from_limbs(limb* r, const size_t r_count, const limb* a,
+                                  const size_t a_count);
+
+/**
+ * @brief Computes the full product r = a * b using the schoolbook method
+ *
+ * @param r The product (a_count + b_count limbs), must not alias the factors
+ */
+AARITH_KERNEL void mul_limbs(limb* r, const limb* a, const size_t a_count, const limb* b,
+                             const size_t b_count);
+
+/**
+ * @brief Computes the two's complement r = -a
+ */
+AARITH_KERNEL void negate_limbs(limb* r, const limb* a, const size_t n);
+
+/**
+ * @brief Computes acc = acc + a * b modulo 2^(64 n)
+ *
+ * @warning The accumulator must not alias the factors.
+ */
+AARITH_KERNEL void mul_add_limbs(limb* acc, const limb* a, const limb* b, const size_t n);
+
+/**
+ * @brief Computes r = a << shift (the bits shifted beyond the n limbs are lost)
+ */
+AARITH_KERNEL void shift_left_limbs(limb* r, const limb* a, const size_t n, const size_t shift);
+
+/**
+ * @brief Computes r = a >> shift where the vacated bits are filled with ones if requested
+ *
+ * @note For an arithmetic shift, the limbs must be sign-extended (@see sign_extend_limbs).
+ */
+AARITH_KERNEL void shift_right_limbs(limb* r, const limb* a, const size_t n, const size_t shift,
+                                     const bool fill_ones = false);
+
+/**
+ * @brief Compares two unsigned numbers, returns a negative value, zero or a positive value if a
+ * is less than, equal to or greater than b
+ */
+[[nodiscard]] AARITH_KERNEL int compare_limbs(const limb* a, const limb* b, const size_t n);
+
+/**
+ * @brief Counts the leading zeroes of a number of the given width
+ */
+[[nodiscard]] AARITH_KERNEL size_t count_leading_zeroes_limbs(const limb* a, const size_t width);
+
+/**
+ * @brief Divides a number by a single limb, returns the remainder
+ */
+AARITH_KERNEL limb div_limbs_by_limb(limb* q, const limb* a, const size_t n, const limb d);
+
+/**
+ * @brief Divides two unsigned numbers of the given width using restoring division
+ *
+ * @param q The quotient (n limbs)
+ * @param r The remainder (n limbs)
+ * @param a The numerator
+ * @param b The denominator, must not be zero
+ * @param width The width of the numbers
+ *
+ * @warning Neither the quotient nor the remainder may alias the operands.
+ */
+AARITH_KERNEL void divide_limbs(limb* q, limb* r, const limb* a, const limb* b, const size_t width);
+
+#if !defined(AARITH_SEPARATE_KERNELS) || defined(AARITH_COMPILING_KERNELS)
+
+AARITH_KERNEL void mask_limbs(limb* r, const size_t width)
+{
+    r[limb_count(width) - 1] &= top_limb_mask(width);
+}
+
+AARITH_KERNEL void sign_extend_limbs(limb* r, const size_t width)
+{
+    const size_t used = width % limb_width;
+    if (used == 0)
+    {
+        return;
+    }
+    limb& top = r[limb_count(width) - 1];
+    if ((top >> (used - 1)) & 1U)
+    {
+        top |= ~top_limb_mask(width);
+    }
+    else
+    {
+        top &= top_limb_mask(width);
+    }
+}
+
+AARITH_KERNEL bool is_zero_limbs(const limb* a, const size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (a[i] != 0U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+AARITH_KERNEL limb add_limbs(limb* r, const limb* a, const limb* b, const size_t n, limb carry)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        const limb x = a[i];
+        limb sum = x + b[i];
+        const bool overflow = sum < x;
+        sum += carry;
+        carry = (overflow || sum < carry) ? 1U : 0U;
+        r[i] = sum;
+    }
+    return carry;
+}
+
+AARITH_KERNEL limb sub_limbs(limb* r, const limb* a, const limb* b, const size_t n)
+{
+    limb borrow = 0U;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const limb x = a[i];
+        const limb y = b[i];
+        limb difference = x - y;
+        const bool underflow = x < y;
+        const bool borrow_underflow = difference < borrow;
+        difference -= borrow;
+        borrow = (underflow || borrow_underflow) ? 1U : 0U;
+        r[i] = difference;
+    }
+    return borrow;
+}
+
+AARITH_KERNEL limb add_into_limbs(limb* r, const size_t r_count, const limb* a,
+                                  const size_t a_count)
+{
+    limb carry = add_limbs(r, r, a, a_count);
+    for (size_t i = a_count; i < r_count && carry != 0U; ++i)
+    {
+        r[i] += carry;
+        carry = r[i] == 0U ? 1U : 0U;
+    }
+    return carry;
+}
+
+AARITH_KERNEL limb sub_from_limbs(limb* r, const size_t r_count, const limb* a,
+                                  const size_t a_count)
+{
+    limb borrow = sub_limbs(r, r, a, a_count);
+    for (size_t i = a_count; i < r_count && borrow != 0U; ++i)
+    {
+        borrow = r[i] == 0U ? 1U : 0U;
+        r[i] -= 1U;
+    }
+    return borrow;
+}
+
+AARITH_KERNEL void mul_limbs(limb* r, const limb* a, const size_t a_count, const limb* b,
+                             const size_t b_count)
+{
+    std::fill(r, r + a_count + b_count, limb{0});
+    for (size_t i = 0; i < a_count; ++i)
+    {
+        const limb word_a = a[i];
+        if (word_a == 0U)
+        {
+            continue;
+        }
+        limb carry = 0U;
+        for (size_t j = 0; j < b_count; ++j)
+        {
+            const auto [high, low] = mul_word(word_a, b[j]);
+            limb sum = low + r[i + j];
+            limb next_carry = high + (sum < low ? 1U : 0U);
+            sum += carry;
+            next_carry += (sum < carry ? 1U : 0U);
+            r[i + j] = sum;
+            carry = next_carry;
+        }
+        r[i + b_count] = carry;
+    }
+}
+
+AARITH_KERNEL void negate_limbs(limb* r, const limb* a, const size_t n)
+{
+    limb carry = 1U;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const limb sum = ~a[i] + carry;
+        carry = (sum < carry) ? 1U : 0U;
+        r[i] = sum;
+    }
+}
+
+AARITH_KERNEL void mul_add_limbs(limb* acc, const limb* a, const limb* b, const size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        const limb word_a = a[i];
+        if (word_a == 0U)
+        {
+            continue;
+        }
+
+        limb carry = 0U;
+        for (size_t j = 0; i + j < n; ++j)
+        {
+            const auto [high, low] = mul_word(word_a, b[j]);
+            limb sum = low + acc[i + j];
+            limb next_carry = high + (sum < low ? 1U : 0U);
+            sum += carry;
+            next_carry += (sum < carry ? 1U : 0U);
+            acc[i + j] = sum;
+            carry = next_carry;
+        }
+    }
+}
+
+AARITH_KERNEL void shift_left_limbs(limb* r, const limb* a, const size_t n, const size_t shift)
+{
+    if (r != a)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = a[i];
+        }
+    }
+    if (shift >= n * limb_width)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = 0U;
+        }
+        return;
+    }
+    if (shift > 0)
+    {
+        funnel_shift_left_words(r, n, shift / limb_width, shift % limb_width);
+    }
+}
+
+AARITH_KERNEL void shift_right_limbs(limb* r, const limb* a, const size_t n, const size_t shift,
+                                     const bool fill_ones)
+{
+    if (r != a)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = a[i];
+        }
+    }
+    const limb fill = fill_ones ? ~limb{0} : limb{0};
+    if (shift >= n * limb_width)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            r[i] = fill;
+        }
+        return;
+    }
+    if (shift == 0)
+    {
+        return;
+    }
+
+    funnel_shift_right_words(r, n, shift / limb_width, shift % limb_width);
+
+    if (fill_ones)
+    {
+        const size_t first_bit = n * limb_width - shift;
+        for (size_t i = first_bit / limb_width; i < n; ++i)
+        {
+            limb ones = ~limb{0};
+            if (i * limb_width < first_bit)
+            {
+                ones <<= first_bit - i * limb_width;
+            }
+            r[i] |= ones;
+        }
+    }
+}
+
+AARITH_KERNEL int compare_limbs(const limb* a, const limb* b, const size_t n)
+{
+    for (size_t i = n; i > 0; --i)
+    {
+        if (a[i - 1] != b[i - 1])
+        {
+            return a[i - 1] < b[i - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+AARITH_KERNEL size_t count_leading_zeroes_limbs(const limb* a, const size_t width)
+{
+    const size_t n = limb_count(width);
+    const size_t unused = n * limb_width - width;
+    for (size_t i = n; i > 0; --i)
+    {
+        const limb w = a[i - 1];
+        if (w != 0U)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            const auto zeroes = static_cast<size_t>(__builtin_clzll(w));
+#else
+            size_t zeroes = 0;
+            for (limb mask = limb{1} << (limb_width - 1); (w & mask) == 0U; mask >>= 1U)
+            {
+                ++zeroes;
+            }
+#endif
+            return (n - i) * limb_width + zeroes - unused;
+        }
+    }
+    return width;
+}
+
+AARITH_KERNEL limb div_limbs_by_limb(limb* q, const limb* a, const size_t n, const limb d)
+{
+    limb remainder = 0U;
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    for (size_t i = n; i > 0; --i)
+    {
+        const uint128 current = (static_cast<uint128>(remainder) << limb_width) | a[i - 1];
+        q[i - 1] = static_cast<limb>(current / d);
+        remainder = static_cast<limb>(current % d);
+    }
+#else
+    for (size_t i = n; i > 0; --i)
+    {
+        limb quotient = 0U;
+        limb current = a[i - 1];
+        for (size_t bit = limb_width; bit > 0; --bit)
+        {
+            const bool overflow = (remainder >> (limb_width - 1)) != 0U;
+            remainder = (remainder << 1U) | ((current >> (bit - 1)) & 1U);
+            quotient <<= 1U;
+            if (overflow || remainder >= d)
+            {
+                remainder -= d;
+                quotient |= 1U;
+            }
+        }
+        q[i - 1] = quotient;
+    }
+#endif
+    return remainder;
+}
+
+AARITH_KERNEL void divide_limbs(limb* q, limb* r, const limb* a, const limb* b, const size_t width)
+{
+    const size_t n = limb_count(width);
+    for (size_t i = 0; i < n; ++i)
+    {
+        q[i] = 0U;
+        r[i] = 0U;
+    }
+
+    if (compare_limbs(a, b, n) < 0)
+    {
+        std::copy(a, a + n, r);
+        return;
+    }
+    if (is_zero_limbs(b + 1, n - 1))
+    {
+        r[0] = div_limbs_by_limb(q, a, n, b[0]);
+        return;
+    }
+
+    // the remainder is less than the denominator, the limbs above those of the denominator stay
+    // zero (and the leading zeroes of the numerator only shift zeroes into the remainder)
+    const size_t m = limb_count(width - count_leading_zeroes_limbs(b, width));
+    const size_t significant = width - count_leading_zeroes_limbs(a, width);
+    for (size_t bit = significant; bit > 0; --bit)
+    {
+        limb shifted_in = (a[(bit - 1) / limb_width] >> ((bit - 1) % limb_width)) & 1U;
+        for (size_t i = 0; i < m; ++i)
+        {
+            const limb shifted_out = r[i] >> (limb_width - 1);
+            r[i] = (r[i] << 1U) | shifted_in;
+            shifted_in = shifted_out;
+        }
+        // the bit shifted out of the remainder means that it is larger than the denominator
+        if (shifted_in != 0U || compare_limbs(r, b, m) >= 0)
+        {
+            sub_limbs(r, r, b, m);
+            q[(bit - 1) / limb_width] |= limb{1} << ((bit - 1) % limb_width);
+        }
+    }
+}
+
+#endif
+
+} // namespace aarith
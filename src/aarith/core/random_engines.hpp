@@ -0,0 +1,355 @@
+#pragma once
+
+#include <aarith/core/limb_operations.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace aarith {
+
+/**
+ * @brief The xoshiro256** pseudo-random number generator by Blackman and Vigna
+ *
+ * A fast generator of 64-bit words with a state of 256 bits that satisfies the requirements of a
+ * uniform random bit generator, i.e., it can be used with the distributions of the standard library
+ * and of aarith. Compared to `std::mt19937_64`, the state is much smaller and generating a word
+ * takes a few shifts, rotations and one multiplication.
+ *
+ * @note This generator is not cryptographically secure.
+ */
+class xoshiro256starstar
+{
+public:
+    using result_type = uint64_t;
+
+    static constexpr uint64_t default_seed = 0x853c49e6748fea9bULL;
+
+    /**
+     * @brief Creates the generator by expanding the seed using splitmix64
+     */
+    explicit constexpr xoshiro256starstar(const uint64_t seed_value = default_seed)
+    {
+        seed(seed_value);
+    }
+
+    /**
+     * @brief Creates the generator with the given state, which must not be all zeroes
+     */
+    explicit constexpr xoshiro256starstar(const std::array<uint64_t, 4>& state)
+        : s(state)
+    {
+    }
+
+    constexpr void seed(uint64_t seed_value)
+    {
+        for (auto& word : s)
+        {
+            // splitmix64
+            seed_value += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = seed_value;
+            z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27U)) * 0x94d049bb133111ebULL;
+            word = z ^ (z >> 31U);
+        }
+    }
+
+    [[nodiscard]] static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type operator()()
+    {
+        const uint64_t result = rotl(s[1] * 5U, 7) * 9U;
+        const uint64_t t = s[1] << 17U;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Fills the words [first, last) with random words
+     *
+     * Equivalent to calling the generator for every word but keeps the state in registers.
+     */
+    template <class OutputIt> constexpr void generate(OutputIt first, OutputIt last)
+    {
+        xoshiro256starstar local{*this};
+        for (; first != last; ++first)
+        {
+            *first = local();
+        }
+        s = local.s;
+    }
+
+    constexpr void discard(unsigned long long n)
+    {
+        for (; n > 0; --n)
+        {
+            (*this)();
+        }
+    }
+
+    /**
+     * @brief Advances the generator by 2^128 steps
+     *
+     * Jumping generates up to 2^128 non-overlapping sequences, e.g., one per thread.
+     */
+    constexpr void jump()
+    {
+        constexpr std::array<uint64_t, 4> polynomial{0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                                     0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+        std::array<uint64_t, 4> jumped{0, 0, 0, 0};
+        for (const uint64_t word : polynomial)
+        {
+            for (size_t bit = 0; bit < 64; ++bit)
+            {
+                if ((word >> bit) & 1U)
+                {
+                    for (size_t i = 0; i < jumped.size(); ++i)
+                    {
+                        jumped[i] ^= s[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        s = jumped;
+    }
+
+    friend constexpr bool operator==(const xoshiro256starstar& lhs, const xoshiro256starstar& rhs)
+    {
+        return lhs.s[0] == rhs.s[0] && lhs.s[1] == rhs.s[1] && lhs.s[2] == rhs.s[2] &&
+               lhs.s[3] == rhs.s[3];
+    }
+
+    friend constexpr bool operator!=(const xoshiro256starstar& lhs, const xoshiro256starstar& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::array<uint64_t, 4> s{};
+
+    [[nodiscard]] static constexpr uint64_t rotl(const uint64_t x, const unsigned k)
+    {
+        return (x << k) | (x >> (64U - k));
+    }
+};
+
+/**
+ * @brief The counter-based Philox4x64-10 generator by Salmon et al. (Random123)
+ *
+ * The generator encrypts a 256-bit counter using a key, every counter value yields four 64-bit
+ * words. As the words are a function of the counter, the generator can skip any number of words
+ * in constant time (@see skip) and a seed provides 2^64 independent streams (@see stream) which
+ * can be split into independent substreams (@see substream). They make random numbers
+ * reproducible independently of how the work is distributed among threads: if every block of work
+ * uses its own substream, the numbers do not depend on the thread executing the block (@see
+ * parallel_generate).
+ *
+ * The generator satisfies the requirements of a uniform random bit generator.
+ *
+ * @note This generator is not cryptographically secure.
+ */
+class philox4x64
+{
+public:
+    using result_type = uint64_t;
+    using block_type = std::array<uint64_t, 4>;
+
+    static constexpr uint64_t default_seed = 0x853c49e6748fea9bULL;
+
+    /**
+     * @brief Creates the generator at the beginning of a stream
+     *
+     * @param seed The seed (the first word of the key)
+     * @param stream_id The stream (the second word of the key)
+     */
+    explicit constexpr philox4x64(const uint64_t seed = default_seed, const uint64_t stream_id = 0)
+        : key{seed, stream_id}
+    {
+    }
+
+    [[nodiscard]] static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /**
+     * @brief Returns the generator at the beginning of the given stream of the same seed
+     */
+    [[nodiscard]] constexpr philox4x64 stream(const uint64_t stream_id) const
+    {
+        return philox4x64{key[0], stream_id};
+    }
+
+    /**
+     * @brief Returns the generator at the beginning of a substream of the current position
+     *
+     * The generator itself only counts in the lower half of the counter. A substream counts from
+     * zero in the lower half, its upper half holds `substream_id + 1` and the current block of this
+     * generator. Hence, the substreams are independent of each other and of this generator, also
+     * if they are taken at different positions of the generator (e.g., by subsequent calls of
+     * parallel_generate).
+     *
+     * @note The substreams of a substream are not independent of the substreams of its generator.
+     *
+     * @param substream_id The substream (less than 2^64 - 1)
+     */
+    [[nodiscard]] constexpr philox4x64 substream(const uint64_t substream_id) const
+    {
+        philox4x64 sub{key[0], key[1]};
+        sub.counter[2] = substream_id + 1;
+        sub.counter[3] = counter[0];
+        return sub;
+    }
+
+    constexpr result_type operator()()
+    {
+        if (index == 4)
+        {
+            buffer = encrypt(counter, key);
+            increment(1);
+            index = 0;
+        }
+        return buffer[index++];
+    }
+
+    /**
+     * @brief Fills the words [first, last) with random words
+     *
+     * Equivalent to calling the generator for every word. Whole blocks are encrypted without
+     * buffering them, the encryptions of consecutive blocks are independent of each other.
+     */
+    template <class OutputIt> constexpr void generate(OutputIt first, OutputIt last)
+    {
+        for (; first != last && index != 4; ++first)
+        {
+            *first = (*this)();
+        }
+        if constexpr (std::is_same_v<typename std::iterator_traits<OutputIt>::iterator_category,
+                                     std::random_access_iterator_tag>)
+        {
+            for (; last - first >= 4; first += 4)
+            {
+                const block_type block = encrypt(counter, key);
+                increment(1);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    first[i] = block[i];
+                }
+            }
+        }
+        for (; first != last; ++first)
+        {
+            *first = (*this)();
+        }
+    }
+
+    /**
+     * @brief Skips the given number of words in constant time
+     */
+    constexpr void skip(const uint64_t n)
+    {
+        const uint64_t buffered = 4 - index;
+        if (n < buffered)
+        {
+            index += n;
+            return;
+        }
+
+        // the words of the next n / 4 blocks are skipped, the current block is the last one
+        const uint64_t remaining = n - buffered;
+        increment(remaining / 4);
+        index = 4;
+        if (remaining % 4 != 0)
+        {
+            (*this)();
+            index = remaining % 4;
+        }
+    }
+
+    /**
+     * @brief Equivalent to skip, the name used by the engines of the standard library
+     */
+    constexpr void discard(const unsigned long long n)
+    {
+        skip(n);
+    }
+
+    /**
+     * @brief Returns the four words of the block with the given counter
+     */
+    [[nodiscard]] static constexpr block_type encrypt(block_type ctr,
+                                                      std::array<uint64_t, 2> k)
+    {
+        constexpr uint64_t multiplier0 = 0xD2E7470EE14C6C93ULL;
+        constexpr uint64_t multiplier1 = 0xCA5A826395121157ULL;
+        constexpr uint64_t weyl0 = 0x9E3779B97F4A7C15ULL;
+        constexpr uint64_t weyl1 = 0xBB67AE8584CAA73BULL;
+
+        for (size_t round = 0; round < 10; ++round)
+        {
+            const auto [high0, low0] = mul_word(multiplier0, ctr[0]);
+            const auto [high1, low1] = mul_word(multiplier1, ctr[2]);
+            ctr = {high1 ^ ctr[1] ^ k[0], low1, high0 ^ ctr[3] ^ k[1], low0};
+            k[0] += weyl0;
+            k[1] += weyl1;
+        }
+        return ctr;
+    }
+
+    friend constexpr bool operator==(const philox4x64& lhs, const philox4x64& rhs)
+    {
+        // the buffer is a function of the counter and the key
+        return lhs.key[0] == rhs.key[0] && lhs.key[1] == rhs.key[1] &&
+               lhs.counter[0] == rhs.counter[0] && lhs.counter[1] == rhs.counter[1] &&
+               lhs.counter[2] == rhs.counter[2] && lhs.counter[3] == rhs.counter[3] &&
+               lhs.index == rhs.index;
+    }
+
+    friend constexpr bool operator!=(const philox4x64& lhs, const philox4x64& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::array<uint64_t, 2> key;
+    // the counter of the next block (the upper two words are only used by substreams)
+    block_type counter{0, 0, 0, 0};
+    block_type buffer{0, 0, 0, 0};
+    // the index of the next buffered word, 4 if the buffer is exhausted
+    uint64_t index{4};
+
+    constexpr void increment(const uint64_t n)
+    {
+        counter[0] += n;
+        if (counter[0] < n)
+        {
+            ++counter[1];
+        }
+    }
+};
+
+} // namespace aarith
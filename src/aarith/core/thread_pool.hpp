@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aarith {
+
+/**
+ * @brief A minimal pool of worker threads for data-parallel loops
+ *
+ * The threads are created once and reused for every call of `parallel_for`. The calling thread
+ * participates in the work, i.e., a pool of size one does not create any additional thread.
+ *
+ * @note Calling `parallel_for` from within a task of the same pool is not supported.
+ */
+class thread_pool
+{
+public:
+    /**
+     * @brief Creates a pool that uses the given number of threads (including the calling thread)
+     */
+    explicit thread_pool(const size_t threads = std::max(1U, std::thread::hardware_concurrency()))
+        : thread_count(std::max<size_t>(threads, 1))
+    {
+        for (size_t i = 1; i < thread_count; ++i)
+        {
+            workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        task_available.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Returns the number of threads used (including the calling thread)
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return thread_count;
+    }
+
+    /**
+     * @brief Calls `f(i)` for all `i` in `[0, count)` and waits for all calls to finish
+     *
+     * The indices are distributed dynamically between the threads. If one of the calls throws an
+     * exception, the first exception is rethrown after all threads have finished.
+     *
+     * @param count The number of indices
+     * @param f The function to call for every index
+     */
+    template <class Function> void parallel_for(const size_t count, Function f)
+    {
+        std::atomic<size_t> next{0};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        const auto run = [&]() {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                try
+                {
+                    f(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock{error_mutex};
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        const size_t helpers = std::min(workers.size(), count > 0 ? count - 1 : 0);
+
+        size_t pending = helpers;
+        std::mutex pending_mutex;
+        std::condition_variable finished;
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            for (size_t i = 0; i < helpers; ++i)
+            {
+                tasks.emplace_back([&]() {
+                    run();
+                    std::lock_guard<std::mutex> pending_lock{pending_mutex};
+                    if (--pending == 0)
+                    {
+                        finished.notify_one();
+                    }
+                });
+            }
+        }
+        task_available.notify_all();
+
+        run();
+
+        std::unique_lock<std::mutex> lock{pending_mutex};
+        finished.wait(lock, [&pending]() { return pending == 0; });
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    size_t thread_count;
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable task_available;
+    bool stop{false};
+
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                task_available.wait(lock, [this]() { return stop || !tasks.empty(); });
+                if (stop && tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+/**
+ * @brief Returns a process-wide thread pool using all hardware threads
+ */
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+} // namespace aarith
@@ -13,6 +13,89 @@
 
 namespace aarith {
 
+template <size_t Width, class WordType> class word_array_view;
+
+/**
+ * @brief Reads up to one word of bits starting at an arbitrary bit index of an array of words
+ *
+ * The bits are read using (at most) two word accesses and a funnel shift. Bits outside of the
+ * array are read as zero.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @tparam WordType The type of the words
+ * @param words The array of words
+ * @param word_count The number of words in the array
+ * @param bit_index The index of the first bit to read
+ * @param count The number of bits to read (at most the width of a word)
+ * @return The bits read, stored in the least significant bits
+ */
+template <typename WordType>
+[[nodiscard]] constexpr WordType read_word_bits(const WordType* words, const size_t word_count,
+                                                const size_t bit_index, const size_t count)
+{
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+    const size_t index = bit_index / word_width;
+    const size_t shift = bit_index % word_width;
+
+    if (index >= word_count)
+    {
+        return 0U;
+    }
+
+    auto bits = static_cast<WordType>(words[index] >> shift);
+    if (shift != 0 && shift + count > word_width && index + 1 < word_count)
+    {
+        bits |= static_cast<WordType>(words[index + 1] << (word_width - shift));
+    }
+
+    const auto mask = (count >= word_width)
+                          ? static_cast<WordType>(-1)
+                          : static_cast<WordType>((static_cast<WordType>(1) << count) - 1U);
+    return static_cast<WordType>(bits & mask);
+}
+
+/**
+ * @brief Writes up to one word of bits starting at an arbitrary bit index of an array of words
+ *
+ * Bits that would be written outside of the array are dropped.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @tparam WordType The type of the words
+ * @param words The array of words
+ * @param word_count The number of words in the array
+ * @param bit_index The index of the first bit to write
+ * @param count The number of bits to write (at most the width of a word)
+ * @param value The bits to write, stored in the least significant bits
+ */
+template <typename WordType>
+constexpr void write_word_bits(WordType* words, const size_t word_count, const size_t bit_index,
+                               const size_t count, WordType value)
+{
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+    const size_t index = bit_index / word_width;
+    const size_t shift = bit_index % word_width;
+
+    if (index >= word_count)
+    {
+        return;
+    }
+
+    const auto mask = (count >= word_width)
+                          ? static_cast<WordType>(-1)
+                          : static_cast<WordType>((static_cast<WordType>(1) << count) - 1U);
+    value = static_cast<WordType>(value & mask);
+
+    words[index] = static_cast<WordType>((words[index] & ~(mask << shift)) | (value << shift));
+    if (shift != 0 && shift + count > word_width && index + 1 < word_count)
+    {
+        const size_t written = word_width - shift;
+        words[index + 1] = static_cast<WordType>((words[index + 1] & ~(mask >> written)) |
+                                                 (value >> written));
+    }
+}
+
 template <size_t Width, class WordType = uint64_t> class word_array
 {
 public:
@@ -55,6 +138,19 @@ public:
         }
     }
 
+    /**
+     * @brief Copies the bits referenced by a view
+     */
+    template <size_t V>
+    constexpr word_array(const word_array_view<V, WordType>& view) // NOLINT
+    {
+        static_assert(V <= Width, "Can not create a word_array from larger container");
+        for (size_t i = 0U; i < view.word_count(); ++i)
+        {
+            set_word(i, view.word(i));
+        }
+    }
+
     template <size_t V, typename T>
     constexpr word_array<Width, T>& operator=(const word_array<V, T>& other)
     {
@@ -107,21 +203,37 @@ public:
     }
 
     /**
+     * @brief Overwrites the bits [end, end + V) with the bits of another word_array
+     *
+     * If both word_arrays use the same word type, the bits are written word by word.
      *
-     * @tparam V
-     * @tparam T
-     * @param end
-     * @param other
+     * @tparam V The width of the other word_array
+     * @tparam T The word type of the other word_array
+     * @param end The index of the least significant bit to overwrite
+     * @param other The bits to write
      */
     template <size_t V, typename T> void set_bits(size_t end, const word_array<V, T>& other)
     {
 
         static_assert(V <= Width, "Can not create a word_array from larger container");
 
-        for (size_t i = 0; i < other.width(); i++)
+        if constexpr (std::is_same_v<T, WordType>)
         {
-            const size_t index = i + end;
-            set_bit(index, other.bit(i));
+            for (size_t i = 0; i < other.word_count(); ++i)
+            {
+                const size_t count = std::min(word_width(), V - i * word_width());
+                write_word_bits(words.data(), word_count(), end + i * word_width(), count,
+                                other.word(i));
+            }
+            words[word_count() - 1] &= word_mask(word_count() - 1);
+        }
+        else
+        {
+            for (size_t i = 0; i < other.width(); i++)
+            {
+                const size_t index = i + end;
+                set_bit(index, other.bit(i));
+            }
         }
     }
 
@@ -196,12 +308,23 @@ public:
         return static_cast<bit_type>(masked_bit > 0 ? 1 : 0);
     }
 
-    template <size_t Count> [[nodiscard]] constexpr auto bits(size_t index) const -> word_array<Count, WordType>
+    /**
+     * @brief Returns the bits [index, index + Count)
+     *
+     * The bits are extracted word by word, bits beyond the width are zero.
+     *
+     * @tparam Count The number of bits to extract
+     * @param index The index of the least significant bit to extract
+     * @return The extracted bits
+     */
+    template <size_t Count>
+    [[nodiscard]] constexpr auto bits(size_t index) const -> word_array<Count, WordType>
     {
         word_array<Count, WordType> result;
-        for (auto i = 0U; i < Count; ++i)
+        for (size_t i = 0; i < result.word_count(); ++i)
         {
-            result.set_bit(i, bit(index + i));
+            result.set_word(i, read_word_bits(words.data(), word_count(),
+                                              index + i * word_width(), word_width()));
         }
         return result;
     }
@@ -409,6 +532,24 @@ public:
         return !is_zero();
     }
 
+    /**
+     * @brief Returns a pointer to the underlying words
+     */
+    [[nodiscard]] constexpr const word_type* data() const noexcept
+    {
+        return words.data();
+    }
+
+    /**
+     * @brief Returns a pointer to the underlying words
+     *
+     * @note The bits beyond the width in the most significant word must stay zero.
+     */
+    [[nodiscard]] constexpr word_type* data() noexcept
+    {
+        return words.data();
+    }
+
     [[nodiscard]] constexpr auto begin() const noexcept
     {
         return words.begin();
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+#include <aarith/core/word_array.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <utility>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @file word_array_bit_manipulation.hpp
+ *
+ * Bit manipulation of word_arrays of arbitrary width: extracting and depositing bits selected by
+ * a mask (like the BMI2 instructions PEXT and PDEP), reversing bits and bytes and interleaving
+ * the bits of two word_arrays (Morton order).
+ *
+ * All functions process the word_arrays in chunks of 64 bits, independent of their word type. If
+ * the target supports BMI2, PEXT and PDEP are used for the chunks, otherwise (and during constant
+ * evaluation) portable implementations are used.
+ */
+
+namespace aarith {
+
+/**
+ * @brief Counts the set bits of a 64-bit word
+ */
+[[nodiscard]] constexpr size_t count_ones_word(const uint64_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(w));
+#else
+    size_t ones = 0;
+    for (uint64_t value = w; value != 0; value &= value - 1U)
+    {
+        ++ones;
+    }
+    return ones;
+#endif
+}
+
+/**
+ * @brief Gathers the bits of `w` selected by `mask` into the least significant bits (PEXT)
+ */
+[[nodiscard]] constexpr uint64_t extract_bits_word(const uint64_t w, uint64_t mask)
+{
+#if defined(__BMI2__)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return _pext_u64(w, mask);
+    }
+#endif
+    uint64_t result = 0;
+    for (uint64_t bit = 1; mask != 0; bit <<= 1U)
+    {
+        if ((w & mask & (~mask + 1U)) != 0)
+        {
+            result |= bit;
+        }
+        mask &= mask - 1U;
+    }
+    return result;
+}
+
+/**
+ * @brief Scatters the least significant bits of `w` to the positions selected by `mask` (PDEP)
+ */
+[[nodiscard]] constexpr uint64_t deposit_bits_word(const uint64_t w, uint64_t mask)
+{
+#if defined(__BMI2__)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return _pdep_u64(w, mask);
+    }
+#endif
+    uint64_t result = 0;
+    for (uint64_t bit = 1; mask != 0; bit <<= 1U)
+    {
+        if ((w & bit) != 0)
+        {
+            result |= mask & (~mask + 1U);
+        }
+        mask &= mask - 1U;
+    }
+    return result;
+}
+
+/**
+ * @brief Reverses the order of the bytes of a 64-bit word
+ */
+[[nodiscard]] constexpr uint64_t byte_swap_word(uint64_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(w);
+#else
+    w = ((w >> 8U) & 0x00FF00FF00FF00FFULL) | ((w & 0x00FF00FF00FF00FFULL) << 8U);
+    w = ((w >> 16U) & 0x0000FFFF0000FFFFULL) | ((w & 0x0000FFFF0000FFFFULL) << 16U);
+    return (w >> 32U) | (w << 32U);
+#endif
+}
+
+/**
+ * @brief Reverses the order of the bits of a 64-bit word
+ */
+[[nodiscard]] constexpr uint64_t reverse_bits_word(uint64_t w)
+{
+    w = ((w >> 1U) & 0x5555555555555555ULL) | ((w & 0x5555555555555555ULL) << 1U);
+    w = ((w >> 2U) & 0x3333333333333333ULL) | ((w & 0x3333333333333333ULL) << 2U);
+    w = ((w >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((w & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+    return byte_swap_word(w);
+}
+
+/**
+ * @brief Moves bit i of the lower 32 bits of `w` to bit 2i
+ */
+[[nodiscard]] constexpr uint64_t spread_bits_word(uint64_t w)
+{
+#if defined(__BMI2__)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return _pdep_u64(w, 0x5555555555555555ULL);
+    }
+#endif
+    w &= 0x00000000FFFFFFFFULL;
+    w = (w | (w << 16U)) & 0x0000FFFF0000FFFFULL;
+    w = (w | (w << 8U)) & 0x00FF00FF00FF00FFULL;
+    w = (w | (w << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+    w = (w | (w << 2U)) & 0x3333333333333333ULL;
+    w = (w | (w << 1U)) & 0x5555555555555555ULL;
+    return w;
+}
+
+/**
+ * @brief Moves bit 2i of `w` to bit i (the inverse of spread_bits_word)
+ */
+[[nodiscard]] constexpr uint64_t compact_bits_word(uint64_t w)
+{
+#if defined(__BMI2__)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return _pext_u64(w, 0x5555555555555555ULL);
+    }
+#endif
+    w &= 0x5555555555555555ULL;
+    w = (w | (w >> 1U)) & 0x3333333333333333ULL;
+    w = (w | (w >> 2U)) & 0x0F0F0F0F0F0F0F0FULL;
+    w = (w | (w >> 4U)) & 0x00FF00FF00FF00FFULL;
+    w = (w | (w >> 8U)) & 0x0000FFFF0000FFFFULL;
+    w = (w | (w >> 16U)) & 0x00000000FFFFFFFFULL;
+    return w;
+}
+
+/**
+ * @brief Reads up to 64 bits of a word_array starting at an arbitrary index
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t Width, typename WordType>
+[[nodiscard]] constexpr uint64_t load_bits(const word_array<Width, WordType>& w, const size_t index,
+                                           const size_t count)
+{
+    constexpr size_t word_width = word_array<Width, WordType>::word_width();
+    if constexpr (word_width >= 64)
+    {
+        return static_cast<uint64_t>(read_word_bits(w.data(), w.word_count(), index, count));
+    }
+    else
+    {
+        uint64_t result = 0;
+        for (size_t done = 0; done < count; done += word_width)
+        {
+            const auto part = read_word_bits(w.data(), w.word_count(), index + done,
+                                             std::min(word_width, count - done));
+            result |= static_cast<uint64_t>(part) << done;
+        }
+        return result;
+    }
+}
+
+/**
+ * @brief Writes up to 64 bits of a word_array starting at an arbitrary index
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t Width, typename WordType>
+constexpr void store_bits(word_array<Width, WordType>& w, const size_t index, const size_t count,
+                          const uint64_t bits)
+{
+    constexpr size_t word_width = word_array<Width, WordType>::word_width();
+    for (size_t done = 0; done < count; done += word_width)
+    {
+        write_word_bits(w.data(), w.word_count(), index + done, std::min(word_width, count - done),
+                        static_cast<WordType>(bits >> done));
+    }
+}
+
+/**
+ * @brief Gathers the bits selected by the mask into the least significant bits of the result
+ *
+ * This is the arbitrary-width version of the BMI2 instruction PEXT, e.g.,
+ * `extract_bits(0b1011'0110, 0b1111'0000) == 0b1011`.
+ *
+ * @tparam W The type of the word_array
+ * @param value The bits to extract from
+ * @param mask The positions of the bits to extract
+ * @return The extracted bits (in the order of their position)
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr W<Width, WordType> extract_bits(const W<Width, WordType>& value,
+                                                        const word_array<Width, WordType>& mask)
+{
+    W<Width, WordType> result;
+    size_t position = 0;
+    for (size_t i = 0; i < Width; i += 64)
+    {
+        const size_t count = std::min<size_t>(64, Width - i);
+        const uint64_t m = load_bits(mask, i, count);
+        if (m != 0)
+        {
+            const size_t ones = count_ones_word(m);
+            store_bits(result, position, ones, extract_bits_word(load_bits(value, i, count), m));
+            position += ones;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Scatters the least significant bits of the value to the positions selected by the mask
+ *
+ * This is the arbitrary-width version of the BMI2 instruction PDEP, e.g.,
+ * `deposit_bits(0b1011, 0b1111'0000) == 0b1011'0000`.
+ *
+ * @tparam W The type of the word_array
+ * @param value The bits to deposit
+ * @param mask The positions to deposit the bits to
+ * @return The deposited bits, all bits not selected by the mask are zero
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr W<Width, WordType> deposit_bits(const W<Width, WordType>& value,
+                                                        const word_array<Width, WordType>& mask)
+{
+    W<Width, WordType> result;
+    size_t position = 0;
+    for (size_t i = 0; i < Width; i += 64)
+    {
+        const size_t count = std::min<size_t>(64, Width - i);
+        const uint64_t m = load_bits(mask, i, count);
+        if (m != 0)
+        {
+            const size_t ones = count_ones_word(m);
+            store_bits(result, i, count, deposit_bits_word(load_bits(value, position, ones), m));
+            position += ones;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Reverses the order of the bits, i.e., bit i becomes bit Width-1-i
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr W<Width, WordType> reverse_bits(const W<Width, WordType>& value)
+{
+    W<Width, WordType> result;
+    for (size_t i = 0; i < Width; i += 64)
+    {
+        const size_t count = std::min<size_t>(64, Width - i);
+        const uint64_t reversed = reverse_bits_word(load_bits(value, i, count)) >> (64 - count);
+        store_bits(result, Width - i - count, count, reversed);
+    }
+    return result;
+}
+
+/**
+ * @brief Reverses the order of the bytes, i.e., byte i becomes byte Width/8-1-i
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr W<Width, WordType> byte_swap(const W<Width, WordType>& value)
+{
+    static_assert(Width % CHAR_BIT == 0, "Only whole bytes can be swapped");
+
+    W<Width, WordType> result;
+    for (size_t i = 0; i < Width; i += 64)
+    {
+        const size_t count = std::min<size_t>(64, Width - i);
+        const uint64_t swapped = byte_swap_word(load_bits(value, i, count)) >> (64 - count);
+        store_bits(result, Width - i - count, count, swapped);
+    }
+    return result;
+}
+
+/**
+ * @brief Interleaves the bits of two word_arrays (Morton order)
+ *
+ * Bit i of `even` becomes bit 2i and bit i of `odd` becomes bit 2i+1 of the result.
+ *
+ * @param even The bits stored at the even positions
+ * @param odd The bits stored at the odd positions
+ * @return The interleaved bits
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr W<2 * Width, WordType> interleave_bits(const W<Width, WordType>& even,
+                                                               const W<Width, WordType>& odd)
+{
+    W<2 * Width, WordType> result;
+    for (size_t i = 0; i < Width; i += 32)
+    {
+        const size_t count = std::min<size_t>(32, Width - i);
+        const uint64_t bits = spread_bits_word(load_bits(even, i, count)) |
+                              (spread_bits_word(load_bits(odd, i, count)) << 1U);
+        store_bits(result, 2 * i, 2 * count, bits);
+    }
+    return result;
+}
+
+/**
+ * @brief Splits the bits at even and odd positions (the inverse of interleave_bits)
+ *
+ * @param value The interleaved bits
+ * @return Pair of <bits at even positions, bits at odd positions>
+ */
+template <template <size_t, typename> class W, size_t Width, typename WordType>
+[[nodiscard]] constexpr std::pair<W<Width / 2, WordType>, W<Width / 2, WordType>>
+deinterleave_bits(const W<Width, WordType>& value)
+{
+    static_assert(Width % 2 == 0, "Only an even number of bits can be deinterleaved");
+
+    W<Width / 2, WordType> even;
+    W<Width / 2, WordType> odd;
+    for (size_t i = 0; i < Width; i += 64)
+    {
+        const size_t count = std::min<size_t>(64, Width - i);
+        const uint64_t bits = load_bits(value, i, count);
+        store_bits(even, i / 2, count / 2, compact_bits_word(bits));
+        store_bits(odd, i / 2, count / 2, compact_bits_word(bits >> 1U));
+    }
+    return std::make_pair(even, odd);
+}
+
+} // namespace aarith
@@ -2,6 +2,7 @@
 
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
+#include <aarith/core/word_array_shift_operations.hpp>
 
 namespace aarith {
 
@@ -203,7 +204,7 @@ template <size_t Left, size_t Right, template <size_t, typename> class W, size_t
 
     if constexpr (Right > 0)
     {
-        right_expanded <<= Right;
+        right_expanded = shl<Right>(right_expanded);
     }
 
     return right_expanded;
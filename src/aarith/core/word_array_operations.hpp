@@ -1,5 +1,6 @@
 #pragma once
 
+#include <aarith/core/limb_operations.hpp>
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
 #include <aarith/core/word_array_cast_operations.hpp>
@@ -7,8 +8,59 @@
 
 namespace aarith {
 
+/**
+ * @brief Counts the number of leading zeroes in a single word
+ *
+ * Uses the compiler intrinsics if available and falls back to a binary search otherwise.
+ *
+ * @tparam WordType The type of the word
+ * @param w The word to count the leading zeroes in
+ * @return The number of leading zeroes (the word width if w is zero)
+ */
+template <typename WordType> constexpr size_t count_leading_zeroes_word(const WordType w)
+{
+    static_assert(::aarith::is_unsigned_int<WordType>);
+
+    constexpr size_t word_width = sizeof(WordType) * CHAR_BIT;
+
+    if (w == 0)
+    {
+        return word_width;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(WordType) <= sizeof(unsigned int))
+    {
+        constexpr size_t padding = sizeof(unsigned int) * CHAR_BIT - word_width;
+        return static_cast<size_t>(__builtin_clz(static_cast<unsigned int>(w))) - padding;
+    }
+    else
+    {
+        constexpr size_t padding = sizeof(unsigned long long) * CHAR_BIT - word_width; // NOLINT
+        return static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(w))) - // NOLINT
+               padding;
+    }
+#else
+    size_t zeroes = 0;
+    WordType value = w;
+    for (size_t half = word_width / 2; half > 0; half /= 2)
+    {
+        if ((value >> (word_width - half)) == 0)
+        {
+            zeroes += half;
+            value = static_cast<WordType>(value << half);
+        }
+    }
+    return zeroes;
+#endif
+}
+
 /**
  * @brief  Counts the number of bits set to zero before the first one appears (from MSB to LSB)
+ *
+ * The counting is done word by word, i.e. only the word containing the first one is inspected
+ * bitwise.
+ *
  * @tparam Width Width of the word_array
  * @param value The word to count the leading zeroes in
  * @return
@@ -16,11 +68,24 @@ namespace aarith {
 template <size_t Width, typename WordType>
 constexpr size_t count_leading_zeroes(const word_array<Width, WordType>& value)
 {
-    for (auto i = Width; i > 0; --i)
+    using W = word_array<Width, WordType>;
+    constexpr size_t unused_bits = W::word_count() * W::word_width() - Width;
+
+    if constexpr (uses_limb_kernels<Width, WordType>())
     {
-        if (value.bit(i - 1))
+        if (use_limb_kernels())
         {
-            return (Width - i);
+            return count_leading_zeroes_limbs(value.data(), Width);
+        }
+    }
+
+    for (auto i = W::word_count(); i > 0; --i)
+    {
+        const WordType w = value.word(i - 1);
+        if (w != 0)
+        {
+            return (W::word_count() - i) * W::word_width() + count_leading_zeroes_word(w) -
+                   unused_bits;
         }
     }
     return Width;
@@ -35,16 +100,59 @@ constexpr size_t count_leading_zeroes(const word_array<Width, WordType>& value)
 template <size_t Width, typename WordType>
 constexpr size_t count_leading_ones(const word_array<Width, WordType>& value)
 {
-    for (auto i = Width; i > 0; --i)
+    using W = word_array<Width, WordType>;
+    constexpr size_t unused_bits = W::word_count() * W::word_width() - Width;
+
+    for (auto i = W::word_count(); i > 0; --i)
     {
-        if (!value.bit(i - 1))
+        const auto inverted = static_cast<WordType>(~value.word(i - 1)) & W::word_mask(i - 1);
+        if (inverted != 0)
         {
-            return (Width - i);
+            return (W::word_count() - i) * W::word_width() +
+                   count_leading_zeroes_word(static_cast<WordType>(inverted)) - unused_bits;
         }
     }
     return Width;
 }
 
+/**
+ * @brief Tests whether any bit below the given index is set to one
+ *
+ * This is the "sticky bit" known from floating-point rounding: it is set if and only if any bit
+ * that is shifted out beyond the round bit is set. The test is performed word by word.
+ *
+ * @tparam Width Width of the word_array
+ * @param value The word_array to test
+ * @param index Bits with an index strictly smaller than this are tested
+ * @return True iff any of the bits value[index-1..0] is set
+ */
+template <size_t Width, typename WordType>
+[[nodiscard]] constexpr bool any_set_bit_below(const word_array<Width, WordType>& value,
+                                               const size_t index)
+{
+    using W = word_array<Width, WordType>;
+
+    const size_t bits = std::min(index, Width);
+    const size_t full_words = bits / W::word_width();
+
+    for (size_t i = 0; i < full_words; ++i)
+    {
+        if (value.word(i) != 0)
+        {
+            return true;
+        }
+    }
+
+    const size_t remaining = bits % W::word_width();
+    if (remaining > 0)
+    {
+        const WordType mask = static_cast<WordType>((WordType{1} << remaining) - 1U);
+        return (value.word(full_words) & mask) != 0;
+    }
+
+    return false;
+}
+
 /**
  * @brief Computes the position of the first set bit (i.e. a bit set to one) in the word_array from
  * MSB to LSB and returns an empty optional if the word_array contains zeroes only.
@@ -126,7 +234,7 @@ bit_range(const word_array<W, WordType>& w)
     static_assert(S < W, "Range must start within the word");
     static_assert(E <= S, "Range must be positive (i.e. this method will not reverse the word");
 
-    return width_cast<(S - E) + 1>(w >> E);
+    return w.template bits<(S - E) + 1>(E);
 }
 
 /**
@@ -162,7 +270,7 @@ split(const word_array<W, WordType>& w)
 {
     static_assert(S < W - 1 && S >= 0);
 
-    const word_array<W - (S + 1), WordType> lhs{width_cast<W - (S + 1)>(w >> (S + 1))};
+    const word_array<W - (S + 1), WordType> lhs = w.template bits<W - (S + 1)>(S + 1);
 
     const word_array<S + 1, WordType> rhs = width_cast<S + 1>(w);
 
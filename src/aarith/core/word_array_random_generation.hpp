@@ -1,10 +1,179 @@
 #pragma once
 
+#include <aarith/core/random_engines.hpp>
+#include <aarith/core/thread_pool.hpp>
+#include <aarith/core/word_array.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <random>
 #include <stdexcept>
+#include <type_traits>
 
 namespace aarith {
 
+/**
+ * @brief Returns the number of random bits produced per call of a uniform random bit generator
+ *
+ * Returns zero if the generator does not produce all values of [0, 2^n) for some n, e.g., for
+ * `std::minstd_rand`.
+ */
+template <class Generator> [[nodiscard]] constexpr size_t generator_bits()
+{
+    using result_type = typename Generator::result_type;
+    if constexpr (!std::is_unsigned_v<result_type>)
+    {
+        return 0;
+    }
+    else
+    {
+        if (Generator::min() != 0)
+        {
+            return 0;
+        }
+        size_t bits = 0;
+        for (auto max = Generator::max(); max & 1U; max >>= 1U)
+        {
+            ++bits;
+        }
+        // all bits of max below the highest one have to be set
+        const bool complete =
+            bits == std::numeric_limits<result_type>::digits || (Generator::max() >> bits) == 0;
+        return complete ? bits : 0;
+    }
+}
+
+/**
+ * @brief Draws a uniformly distributed random word
+ *
+ * The bits of generators producing all values of [0, 2^n), like `std::mt19937_64` or
+ * `xoshiro256starstar`, are used directly (combining several calls for words wider than n bits).
+ * Words from other generators are drawn using `std::uniform_int_distribution`.
+ *
+ * @tparam WordType The type of the word
+ * @param g The uniform random bit generator
+ * @return A random word
+ */
+template <typename WordType, class Generator> [[nodiscard]] WordType random_word(Generator& g)
+{
+    constexpr size_t bits = generator_bits<Generator>();
+    constexpr size_t word_width = std::numeric_limits<WordType>::digits;
+    if constexpr (bits >= word_width)
+    {
+        return static_cast<WordType>(g());
+    }
+    else if constexpr (bits > 0)
+    {
+        WordType word = static_cast<WordType>(g());
+        for (size_t shift = bits; shift < word_width; shift += bits)
+        {
+            word |= static_cast<WordType>(static_cast<WordType>(g()) << shift);
+        }
+        return word;
+    }
+    else
+    {
+        return std::uniform_int_distribution<WordType>{std::numeric_limits<WordType>::min(),
+                                                       std::numeric_limits<WordType>::max()}(g);
+    }
+}
+
+namespace detail {
+template <class Generator, typename = void> struct has_block_generation : std::false_type
+{
+};
+
+template <class Generator>
+struct has_block_generation<Generator, std::void_t<decltype(std::declval<Generator&>().generate(
+                                           std::declval<uint64_t*>(), std::declval<uint64_t*>()))>>
+    : std::true_type
+{
+};
+} // namespace detail
+
+/**
+ * @brief Fills the words of [first, last) with random bits
+ *
+ * The elements are word_arrays (or unsigned and signed integers) of 64-bit words. The words of each
+ * element are generated in one call of the block generation of the generator if it has one (like
+ * philox4x64 and xoshiro256starstar), i.e., the result is the same as calling the generator for
+ * every word.
+ *
+ * @param first The first element to fill
+ * @param last The element after the last element to fill
+ * @param g The uniform random bit generator
+ */
+template <class ForwardIt, class Generator>
+void fill_random(ForwardIt first, ForwardIt last, Generator& g)
+{
+    using T = typename std::iterator_traits<ForwardIt>::value_type;
+    using word_type = typename T::word_type;
+
+    std::array<word_type, T::word_count()> words{};
+    for (; first != last; ++first)
+    {
+        if constexpr (std::is_same_v<word_type, uint64_t> &&
+                      detail::has_block_generation<Generator>::value)
+        {
+            g.generate(words.data(), words.data() + words.size());
+        }
+        else
+        {
+            for (auto& word : words)
+            {
+                word = random_word<word_type>(g);
+            }
+        }
+        for (size_t i = 0; i < words.size(); ++i)
+        {
+            first->set_word(i, words[i]);
+        }
+    }
+}
+
+/**
+ * @brief Fills [first, last) with samples of a distribution using the threads of a pool
+ *
+ * The i-th block of `block_size` samples is generated using substream i of the generator (at its
+ * current position, @see philox4x64::substream), so the samples do not depend on the number of
+ * threads: the result is the same, bit for bit, as generating the blocks one after the other.
+ * Afterwards, the generator is advanced by one block so the next call yields other samples.
+ *
+ * @note The samples differ from those of `distribution.generate(first, last, rng)`, which draws
+ * all of them from the generator itself.
+ *
+ * @param pool The threads to use
+ * @param distribution The distribution (every block uses a copy)
+ * @param first The first sample to generate
+ * @param last The sample after the last sample to generate
+ * @param rng The generator whose substreams are used
+ * @param block_size The number of samples per substream
+ */
+template <class Distribution, class RandomIt>
+void parallel_generate(thread_pool& pool, const Distribution& distribution, RandomIt first,
+                       RandomIt last, philox4x64& rng, const size_t block_size = 4096)
+{
+    if (block_size == 0)
+    {
+        throw std::invalid_argument("The block size must be positive");
+    }
+    const auto count = static_cast<size_t>(std::distance(first, last));
+    const size_t blocks = (count + block_size - 1) / block_size;
+    pool.parallel_for(blocks, [&](const size_t block) {
+        Distribution block_distribution{distribution};
+        philox4x64 block_rng = rng.substream(block);
+        const auto block_first = first + static_cast<std::ptrdiff_t>(block * block_size);
+        const auto block_last =
+            first + static_cast<std::ptrdiff_t>(std::min(count, (block + 1) * block_size));
+        block_distribution.generate(block_first, block_last, block_rng);
+    });
+    // skipping the words of a block always moves the counter to the next block
+    rng.skip(4);
+}
+
 /**
  * Implements random number generation interface similar to std::uniform_int_distribution.
  */
@@ -18,19 +187,23 @@ public:
         result_type array;
         for (auto i = 0U; i < array.word_count(); ++i)
         {
-            array.set_word(i, random_word(g));
+            array.set_word(i, random_word<WordType>(g));
         }
         return array;
     }
 
-    virtual void reset()
+    /**
+     * @brief Fills [first, last) with random word_arrays
+     */
+    template <class ForwardIt, class Generator>
+    void generate(ForwardIt first, ForwardIt last, Generator& g)
     {
-        random_word.reset();
+        fill_random(first, last, g);
     }
 
-private:
-    std::uniform_int_distribution<WordType> random_word{std::numeric_limits<WordType>::min(),
-                                                        std::numeric_limits<WordType>::max()};
+    virtual void reset()
+    {
+    }
 };
 
 } // namespace aarith
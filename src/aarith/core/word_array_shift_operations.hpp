@@ -1,8 +1,15 @@
 #pragma once
 
+#include <aarith/core/funnel_shift.hpp>
+#include <aarith/core/limb_operations.hpp>
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
 
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 namespace aarith {
 
 /**
@@ -13,7 +20,7 @@ namespace aarith {
  * @return The shifted word_container
  */
 template <typename W, typename = std::enable_if_t<is_word_array_v<W>>>
-constexpr W logical_left_shift(W& lhs, const size_t rhs)
+constexpr W& logical_left_shift(W& lhs, const size_t rhs)
 {
     static_assert(::aarith::is_word_array_v<W>);
 
@@ -30,28 +37,21 @@ constexpr W logical_left_shift(W& lhs, const size_t rhs)
         return lhs;
     }
 
-    const auto skip_words = rhs / lhs.word_width();
-    const auto shift_word_left = rhs - skip_words * lhs.word_width();
-    const auto shift_word_right = lhs.word_width() - shift_word_left;
-    for (auto counter = lhs.word_count(); counter > 0; --counter)
+    if constexpr (uses_limb_kernels<width, word_type>())
     {
-        if (counter + skip_words < lhs.word_count())
+        if (use_limb_kernels())
         {
-            word_type new_word = lhs.word(counter) << shift_word_left;
-            if (shift_word_right < lhs.word_width())
-            {
-                new_word = new_word | (lhs.word(counter - 1) >> shift_word_right);
-            }
-            lhs.set_word(counter + skip_words, new_word);
+            shift_left_limbs(lhs.data(), lhs.data(), lhs.word_count(), rhs);
+            lhs.set_word(lhs.word_count() - 1, lhs.word(lhs.word_count() - 1));
+            return lhs;
         }
     }
-    word_type new_word = lhs.word(0) << shift_word_left;
-    lhs.set_word(skip_words, new_word);
 
-    for (size_t i = 0; i < skip_words; ++i)
-    {
-        lhs.set_word(i, word_type{0});
-    }
+    funnel_shift_left_words(lhs.data(), lhs.word_count(), rhs / lhs.word_width(),
+                            rhs % lhs.word_width());
+
+    // bits shifted beyond the width have to be removed from the most significant word
+    lhs.set_word(lhs.word_count() - 1, lhs.word(lhs.word_count() - 1));
 
     return lhs;
 }
@@ -64,7 +64,7 @@ constexpr W logical_left_shift(W& lhs, const size_t rhs)
  * @return The shifted word_container
  */
 template <typename W, typename = std::enable_if_t<is_word_array_v<W>>>
-constexpr W operator<<=(W& lhs, const size_t rhs)
+constexpr W& operator<<=(W& lhs, const size_t rhs)
 {
     return logical_left_shift(lhs, rhs);
 }
@@ -95,7 +95,7 @@ template <typename W, typename = std::enable_if_t<is_word_array_v<W>>>
  */
 template <typename W, typename U,
           typename = std::enable_if_t<is_word_array_v<W> && is_unsigned_v<U>>>
-constexpr W operator<<=(W& lhs, const U& rhs)
+constexpr W& operator<<=(W& lhs, const U& rhs)
 {
     return logical_left_shift(lhs, static_cast<size_t>(rhs));
 }
@@ -127,7 +127,7 @@ template <typename W, typename U,
  * @return The shifted word_array
  */
 template <typename W, typename = std::enable_if_t<is_word_array_v<W>>>
-auto constexpr logical_right_shift(W& lhs, const size_t rhs) -> W
+auto constexpr logical_right_shift(W& lhs, const size_t rhs) -> W&
 {
 
     static_assert(::aarith::is_word_array_v<W>);
@@ -145,32 +145,18 @@ auto constexpr logical_right_shift(W& lhs, const size_t rhs) -> W
         return lhs;
     }
 
-    const auto skip_words = rhs / lhs.word_width();
-    const auto shift_word_right = rhs - skip_words * lhs.word_width();
-    const auto shift_word_left = lhs.word_width() - shift_word_right;
-
-    using word_type = typename W::word_type;
-
-    for (auto counter = skip_words; counter < lhs.word_count(); ++counter)
+    if constexpr (uses_limb_kernels<width, word_type>())
     {
-        word_type new_word = lhs.word(counter) >> shift_word_right;
-        if (shift_word_left < lhs.word_width() && counter + 1 < lhs.word_count())
+        if (use_limb_kernels())
         {
-            new_word = new_word | (lhs.word(counter + 1) << shift_word_left);
+            shift_right_limbs(lhs.data(), lhs.data(), lhs.word_count(), rhs);
+            return lhs;
         }
-        lhs.set_word(counter - skip_words, new_word);
     }
 
-    if (skip_words > 0)
-    {
-        word_type new_word = lhs.word(lhs.word_count() - 1) >> shift_word_right;
-        lhs.set_word(lhs.word_count() - skip_words - 1, new_word);
+    funnel_shift_right_words(lhs.data(), lhs.word_count(), rhs / lhs.word_width(),
+                             rhs % lhs.word_width());
 
-        for (size_t i = lhs.word_count() - skip_words; i < lhs.word_count(); ++i)
-        {
-            lhs.set_word(i, word_type{0});
-        }
-    }
     return lhs;
 }
 
@@ -182,7 +168,7 @@ auto constexpr logical_right_shift(W& lhs, const size_t rhs) -> W
  * @return The shifted word_array
  */
 template <typename W, typename = std::enable_if_t<is_word_array_v<W> || is_unsigned_v<W>>>
-auto constexpr operator>>=(W& lhs, const size_t rhs) -> W
+auto constexpr operator>>=(W& lhs, const size_t rhs) -> W&
 {
     return logical_right_shift(lhs, rhs);
 }
@@ -243,43 +229,271 @@ auto constexpr arithmetic_right_shift(W& lhs, const size_t rhs) -> W&
         return lhs;
     }
 
-    const auto skip_words = rhs / lhs.word_width();
-    const auto shift_word_right = rhs - skip_words * lhs.word_width();
-    const auto shift_word_left = lhs.word_width() - shift_word_right;
+    logical_right_shift(lhs, rhs);
 
-    for (auto counter = skip_words; counter < lhs.word_count(); ++counter)
+    if (lhs_was_negative)
     {
-        WordType new_word = (lhs.word(counter) >> shift_word_right);
-        if (shift_word_left < lhs.word_width() && counter + 1 < lhs.word_count())
+        // fill the bits [Width - rhs, Width) with ones
+        constexpr size_t word_width = W::word_width();
+        const size_t first_bit = Width - rhs;
+        for (size_t i = first_bit / word_width; i < lhs.word_count(); ++i)
         {
-            new_word = new_word | (lhs.word(counter + 1) << shift_word_left);
+            auto fill = std::numeric_limits<WordType>::max();
+            if (i * word_width < first_bit)
+            {
+                fill = static_cast<WordType>(fill << (first_bit - i * word_width));
+            }
+            lhs.set_word(i, lhs.word(i) | fill);
         }
-
-        lhs.set_word(counter - skip_words, new_word);
     }
 
-    if (skip_words > 0)
+    return lhs;
+}
+
+/**
+ * @brief Shifts a word_array to the left by N bits and applies an operation to every word
+ *
+ * The number of skipped words and the shift within the words are resolved at compile time and
+ * the words are assembled without any branches. The word with index `i` of the result is
+ * `op(w, i)` where `w` is the word with index `i` of `x << N`.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t N, typename W, typename Op>
+[[nodiscard]] constexpr W shl_transform(const W& x, Op op)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t word_width = W::word_width();
+    constexpr size_t word_count = W::word_count();
+    constexpr size_t skip = N >= W::width() ? word_count : N / word_width;
+    constexpr size_t shift = N % word_width;
+
+    W result{};
+    for (size_t i = 0; i < skip; ++i)
+    {
+        result.set_word(i, op(word_type{0}, i));
+    }
+    if constexpr (skip < word_count)
     {
-        WordType new_word = (lhs.word(lhs.word_count() - 1) >> shift_word_right);
-        lhs.set_word(lhs.word_count() - skip_words - 1, new_word);
+        result.set_word(skip, op(static_cast<word_type>(x.word(0) << shift), skip));
+        for (size_t i = skip + 1; i < word_count; ++i)
+        {
+            if constexpr (shift == 0)
+            {
+                result.set_word(i, op(x.word(i - skip), i));
+            }
+            else
+            {
+                const auto w =
+                    static_cast<word_type>(static_cast<word_type>(x.word(i - skip) << shift) |
+                                           (x.word(i - skip - 1) >> (word_width - shift)));
+                result.set_word(i, op(w, i));
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Shifts a word_array to the right by N bits and applies an operation to every word
+ *
+ * @see shl_transform
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t N, typename W, typename Op>
+[[nodiscard]] constexpr W shr_transform(const W& x, Op op)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t word_width = W::word_width();
+    constexpr size_t word_count = W::word_count();
+    constexpr size_t skip = N >= W::width() ? word_count : N / word_width;
+    constexpr size_t shift = N % word_width;
 
-        for (size_t i = lhs.word_count() - skip_words; i < lhs.word_count(); ++i)
+    W result{};
+    if constexpr (skip < word_count)
+    {
+        for (size_t i = 0; i + skip + 1 < word_count; ++i)
         {
-            const auto fill_word =
-                lhs.is_negative() ? std::numeric_limits<WordType>::max() : WordType{0};
-            lhs.set_word(i, fill_word);
+            if constexpr (shift == 0)
+            {
+                result.set_word(i, op(x.word(i + skip), i));
+            }
+            else
+            {
+                const auto w = static_cast<word_type>(
+                    (x.word(i + skip) >> shift) |
+                    static_cast<word_type>(x.word(i + skip + 1) << (word_width - shift)));
+                result.set_word(i, op(w, i));
+            }
         }
+        constexpr size_t last = word_count - skip - 1;
+        result.set_word(last, op(static_cast<word_type>(x.word(word_count - 1) >> shift), last));
+    }
+    for (size_t i = word_count - skip; i < word_count; ++i)
+    {
+        result.set_word(i, op(word_type{0}, i));
     }
+    return result;
+}
 
-    if (lhs_was_negative)
+/**
+ * @brief Logical left shift by a number of bits known at compile time
+ *
+ * In contrast to `<<`, the number of skipped words and the shift within the words are resolved
+ * at compile time, resulting in straight-line code for small word_arrays.
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @return The shifted word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shl(const W& x)
+{
+    if constexpr (N == 0)
     {
-        for (size_t i = (Width - 1); i >= (Width - rhs); --i)
+        return x;
+    }
+    else
+    {
+        using word_type = typename W::word_type;
+        return shl_transform<N>(x, [](const word_type w, size_t) { return w; });
+    }
+}
+
+/**
+ * @brief Logical right shift by a number of bits known at compile time
+ *
+ * @see shl
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @return The shifted word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shr(const W& x)
+{
+    if constexpr (N == 0)
+    {
+        return x;
+    }
+    else
+    {
+        using word_type = typename W::word_type;
+        return shr_transform<N>(x, [](const word_type w, size_t) { return w; });
+    }
+}
+
+/**
+ * @brief Arithmetic right shift by a number of bits known at compile time
+ *
+ * The most significant bit is shifted in (see `arithmetic_right_shift`).
+ *
+ * @see shl
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @return The shifted word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W sar(const W& x)
+{
+    using word_type = typename W::word_type;
+    constexpr size_t word_width = W::word_width();
+
+    if constexpr (N == 0)
+    {
+        return x;
+    }
+    else
+    {
+        // the bits [first_bit, Width) are filled with the sign
+        constexpr size_t first_bit = N >= W::width() ? 0 : W::width() - N;
+        if (!x.msb())
         {
-            lhs.set_bit(i);
+            return shr<N>(x);
         }
+        return shr_transform<N>(x, [](const word_type w, const size_t i) {
+            if ((i + 1) * word_width <= first_bit)
+            {
+                return w;
+            }
+            auto fill = std::numeric_limits<word_type>::max();
+            if (i * word_width < first_bit)
+            {
+                fill = static_cast<word_type>(fill << (first_bit - i * word_width));
+            }
+            return static_cast<word_type>(w | fill);
+        });
     }
+}
 
-    return lhs;
+/**
+ * @brief Computes `(x << N) | y` in a single pass without creating temporaries
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @param y The word_array the shifted value is combined with
+ * @return The combined word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shl_or(const W& x, const W& y)
+{
+    using word_type = typename W::word_type;
+    return shl_transform<N>(x, [&y](const word_type w, const size_t i) {
+        return static_cast<word_type>(w | y.word(i));
+    });
+}
+
+/**
+ * @brief Computes `(x >> N) | y` in a single pass without creating temporaries
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @param y The word_array the shifted value is combined with
+ * @return The combined word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shr_or(const W& x, const W& y)
+{
+    using word_type = typename W::word_type;
+    return shr_transform<N>(x, [&y](const word_type w, const size_t i) {
+        return static_cast<word_type>(w | y.word(i));
+    });
+}
+
+/**
+ * @brief Computes `(x << N) & mask` in a single pass without creating temporaries
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @param mask The mask applied to the shifted value
+ * @return The masked word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shl_and(const W& x, const W& mask)
+{
+    using word_type = typename W::word_type;
+    return shl_transform<N>(x, [&mask](const word_type w, const size_t i) {
+        return static_cast<word_type>(w & mask.word(i));
+    });
+}
+
+/**
+ * @brief Computes `(x >> N) & mask` in a single pass without creating temporaries
+ *
+ * @tparam N The number of bits to shift
+ * @param x The word_array to be shifted
+ * @param mask The mask applied to the shifted value
+ * @return The masked word_array
+ */
+template <size_t N, typename W, typename = std::enable_if_t<is_word_array_v<W>>>
+[[nodiscard]] constexpr W shr_and(const W& x, const W& mask)
+{
+    using word_type = typename W::word_type;
+    return shr_transform<N>(x, [&mask](const word_type w, const size_t i) {
+        return static_cast<word_type>(w & mask.word(i));
+    });
 }
 
 /**
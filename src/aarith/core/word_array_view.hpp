@@ -0,0 +1,305 @@
+#pragma once
+
+#include <aarith/core/word_array.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace aarith {
+
+/**
+ * @brief Read-only view of a range of bits of a word_array
+ *
+ * The view refers to the bits of an existing word_array without copying them. Every word of the
+ * view is read from (at most) two words of the referenced array using a funnel shift.
+ *
+ * The view can be used wherever a word_array, uinteger or integer of the same width can be
+ * constructed from, e.g., `uinteger<8>{view}` only reads the eight referenced bits instead of
+ * shifting and truncating the entire array.
+ *
+ * @warning The view must not outlive the referenced word_array.
+ *
+ * @tparam Width The number of bits in the view
+ * @tparam WordType The word type of the referenced word_array
+ */
+template <size_t Width, class WordType = uint64_t> class word_array_view
+{
+public:
+    using word_type = WordType;
+
+    /**
+     * @brief Creates a view of the bits [offset, offset + Width) of the given words
+     *
+     * @param words The referenced words
+     * @param source_word_count The number of referenced words
+     * @param offset The index of the least significant bit of the view
+     */
+    constexpr word_array_view(const WordType* words, const size_t source_word_count,
+                              const size_t offset)
+        : words(words)
+        , source_word_count(source_word_count)
+        , offset(offset)
+    {
+    }
+
+    [[nodiscard]] static constexpr size_t width() noexcept
+    {
+        return Width;
+    }
+
+    [[nodiscard]] static constexpr size_t word_width() noexcept
+    {
+        return word_array<Width, WordType>::word_width();
+    }
+
+    [[nodiscard]] static constexpr size_t word_count() noexcept
+    {
+        return word_array<Width, WordType>::word_count();
+    }
+
+    /**
+     * @brief Returns the word with the given index (as if the bits were stored in a word_array)
+     */
+    [[nodiscard]] constexpr word_type word(const size_t index) const
+    {
+        const size_t count = std::min(word_width(), Width - index * word_width());
+        return read_word_bits(words, source_word_count, offset + index * word_width(), count);
+    }
+
+    [[nodiscard]] constexpr word_type bit(const size_t index) const
+    {
+        return read_word_bits(words, source_word_count, offset + index, 1);
+    }
+
+    [[nodiscard]] constexpr word_type msb() const
+    {
+        return bit(Width - 1);
+    }
+
+    [[nodiscard]] constexpr bool is_zero() const
+    {
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            if (word(i) != 0U)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    const WordType* words;
+    size_t source_word_count;
+    size_t offset;
+};
+
+/**
+ * @brief Mutable view of a range of bits of a word_array
+ *
+ * In addition to reading (like a word_array_view), assigning to a bit span overwrites the
+ * referenced bits word by word. Bits of the span beyond the width of the referenced word_array are
+ * not written, i.e., the unused bits of its most significant word stay zero.
+ *
+ * @warning The span must not outlive the referenced word_array.
+ *
+ * @tparam Width The number of bits in the span
+ * @tparam WordType The word type of the referenced word_array
+ */
+template <size_t Width, class WordType = uint64_t> class bit_span
+{
+public:
+    using word_type = WordType;
+
+    /**
+     * @brief Creates a span of the bits [offset, offset + Width) of the given words
+     *
+     * @param words The referenced words
+     * @param source_width The number of referenced bits (not words)
+     * @param offset The index of the least significant bit of the span
+     */
+    constexpr bit_span(WordType* words, const size_t source_width, const size_t offset)
+        : words(words)
+        , source_width(source_width)
+        , offset(offset)
+    {
+    }
+
+    constexpr bit_span(const bit_span&) = default;
+
+    /**
+     * @brief Copies the bits referenced by the other span into the bits referenced by this span
+     */
+    constexpr bit_span& operator=(const bit_span& other) // NOLINT
+    {
+        return *this = word_array<Width, WordType>{word_array_view<Width, WordType>{other}};
+    }
+
+    constexpr bit_span& operator=(const word_array<Width, WordType>& value)
+    {
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            const size_t position = offset + i * word_width();
+            if (position >= source_width)
+            {
+                break;
+            }
+            const size_t count = std::min(
+                {word_width(), Width - i * word_width(), source_width - position});
+            write_word_bits(words, source_word_count(), position, count, value.word(i));
+        }
+        return *this;
+    }
+
+    constexpr bit_span& operator=(const word_array_view<Width, WordType>& view)
+    {
+        // the view might overlap with the span
+        return *this = word_array<Width, WordType>{view};
+    }
+
+    constexpr operator word_array_view<Width, WordType>() const // NOLINT
+    {
+        return word_array_view<Width, WordType>{words, source_word_count(), offset};
+    }
+
+    [[nodiscard]] static constexpr size_t width() noexcept
+    {
+        return Width;
+    }
+
+    [[nodiscard]] static constexpr size_t word_width() noexcept
+    {
+        return word_array<Width, WordType>::word_width();
+    }
+
+    [[nodiscard]] static constexpr size_t word_count() noexcept
+    {
+        return word_array<Width, WordType>::word_count();
+    }
+
+    [[nodiscard]] constexpr word_type word(const size_t index) const
+    {
+        return word_array_view<Width, WordType>{*this}.word(index);
+    }
+
+    [[nodiscard]] constexpr word_type bit(const size_t index) const
+    {
+        return read_word_bits(words, source_word_count(), offset + index, 1);
+    }
+
+    constexpr void set_bit(const size_t index, const bool value = true)
+    {
+        if (offset + index < source_width)
+        {
+            write_word_bits(words, source_word_count(), offset + index, 1,
+                            static_cast<WordType>(value ? 1U : 0U));
+        }
+    }
+
+private:
+    [[nodiscard]] constexpr size_t source_word_count() const
+    {
+        return (source_width + word_width() - 1) / word_width();
+    }
+
+    WordType* words;
+    size_t source_width;
+    size_t offset;
+};
+
+/**
+ * @brief Returns a view of the range [E, S] of a word_array (see `bit_range`)
+ *
+ * @tparam S Starting index (inclusive, from left to right)
+ * @tparam E Ending index (inclusive, from left to right)
+ * @param w Word container the view refers to
+ * @return View of word[S,E] inclusive
+ */
+template <size_t S, size_t E, size_t W, typename WordType>
+[[nodiscard]] constexpr word_array_view<(S - E) + 1, WordType>
+bit_range_view(const word_array<W, WordType>& w)
+{
+    static_assert(S < W, "Range must start within the word");
+    static_assert(E <= S, "Range must be positive (i.e. this method will not reverse the word");
+
+    return word_array_view<(S - E) + 1, WordType>{w.data(), w.word_count(), E};
+}
+
+/**
+ * @brief Returns a mutable span of the range [E, S] of a word_array
+ *
+ * @tparam S Starting index (inclusive, from left to right)
+ * @tparam E Ending index (inclusive, from left to right)
+ * @param w Word container the span refers to
+ * @return Span of word[S,E] inclusive
+ */
+template <size_t S, size_t E, size_t W, typename WordType>
+[[nodiscard]] constexpr bit_span<(S - E) + 1, WordType> bit_range_span(word_array<W, WordType>& w)
+{
+    static_assert(S < W, "Range must start within the word");
+    static_assert(E <= S, "Range must be positive (i.e. this method will not reverse the word");
+
+    return bit_span<(S - E) + 1, WordType>{w.data(), W, E};
+}
+
+/**
+ * @brief Returns a view of the bits [index, index + Count) of a word_array
+ *
+ * @note No bounds checking is performed, bits beyond the word_array are read as zero.
+ */
+template <size_t Count, size_t W, typename WordType>
+[[nodiscard]] constexpr word_array_view<Count, WordType> bits_view(const word_array<W, WordType>& w,
+                                                                   const size_t index)
+{
+    return word_array_view<Count, WordType>{w.data(), w.word_count(), index};
+}
+
+/**
+ * @brief Returns a mutable span of the bits [index, index + Count) of a word_array
+ *
+ * @note No bounds checking is performed, bits beyond the width of the word_array (including the
+ * unused bits of its most significant word) are read as zero and never written.
+ */
+template <size_t Count, size_t W, typename WordType>
+[[nodiscard]] constexpr bit_span<Count, WordType> bits_span(word_array<W, WordType>& w,
+                                                            const size_t index)
+{
+    return bit_span<Count, WordType>{w.data(), W, index};
+}
+
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr bool operator==(const word_array_view<W, WordType>& a,
+                                        const word_array_view<W, WordType>& b)
+{
+    for (size_t i = 0; i < a.word_count(); ++i)
+    {
+        if (a.word(i) != b.word(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr bool operator==(const word_array_view<W, WordType>& a,
+                                        const word_array<W, WordType>& b)
+{
+    for (size_t i = 0; i < a.word_count(); ++i)
+    {
+        if (a.word(i) != b.word(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr bool operator==(const word_array<W, WordType>& a,
+                                        const word_array_view<W, WordType>& b)
+{
+    return b == a;
+}
+
+} // namespace aarith
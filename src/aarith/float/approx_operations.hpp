@@ -33,6 +33,9 @@ template <size_t E, size_t M>
         return anytime_sub(lhs, swap_sign, bits);
     }
 
+    // counted once the operands are ordered, i.e., as the operation that is actually performed
+    const operation_scope<instrumentation::anytime_add, 1 + E + M, E, M> scope;
+
     const auto exponent_delta =
         sub(width_cast<E + 1>(lhs.get_exponent()), width_cast<E + 1>(rhs.get_exponent()));
 
@@ -76,6 +79,9 @@ template <size_t E, size_t M>
         return anytime_add(lhs, swap_sign, bits);
     }
 
+    // counted once the operands are ordered, i.e., as the operation that is actually performed
+    const operation_scope<instrumentation::anytime_sub, 1 + E + M, E, M> scope;
+
     const auto exponent_delta = sub(lhs.get_exponent(), rhs.get_exponent());
     const auto new_mantissa = rhs.get_full_mantissa() >> exponent_delta.word(0);
     const auto mantissa_sum =
@@ -104,6 +110,8 @@ template <size_t E, size_t M>
 [[nodiscard]] auto anytime_mul(const floating_point<E, M> lhs, const floating_point<E, M> rhs,
                                const unsigned int bits = 2 * M) -> floating_point<E, M>
 {
+    const operation_scope<instrumentation::anytime_mul, 1 + E + M, E, M> scope;
+
     if (lhs.is_nan())
     {
         return lhs.make_quiet_nan();
@@ -136,7 +144,7 @@ template <size_t E, size_t M>
 
     auto mproduct = approx_expanding_mul_post_masking(lhs.get_full_mantissa(),
                                                       rhs.get_full_mantissa(), bits + 1);
-    mproduct = mproduct >> (M);
+    mproduct = shr<M>(mproduct);
 
     // check for over or underflow and break
     if (underflow || overflow)
@@ -183,6 +191,8 @@ template <size_t E, size_t M>
 [[nodiscard]] auto anytime_div(const floating_point<E, M> lhs, const floating_point<E, M> rhs,
                                const unsigned int bits = M + 1) -> floating_point<E, M>
 {
+    const operation_scope<instrumentation::anytime_div, 1 + E + M, E, M> scope;
+
     auto dividend = width_cast<2 * (M + 1) + 3>(lhs.get_full_mantissa());
     auto divisor = width_cast<2 * (M + 1) + 3>(rhs.get_full_mantissa());
     dividend = dividend << (M + 1) + 3;
@@ -218,6 +228,7 @@ template <size_t E, size_t M, size_t LSP, size_t SHARED>
 [[nodiscard]] auto FAU_add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
+    const operation_scope<instrumentation::FAU_add, 1 + E + M, E, M> scope;
     return add_<E, M>(lhs, rhs, FAUadder<M + 1, LSP, SHARED>, FAU_sub<M + 1, LSP, SHARED>);
 }
 
@@ -237,6 +248,7 @@ template <size_t E, size_t M, size_t LSP, size_t SHARED>
 [[nodiscard]] auto FAU_sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
+    const operation_scope<instrumentation::FAU_sub, 1 + E + M, E, M> scope;
     return sub_<E, M>(lhs, rhs, FAUadder<M + 1, LSP, SHARED>, FAU_sub<M + 1, LSP, SHARED>);
 }
 
@@ -1,10 +1,301 @@
 #pragma once
 
 #include <aarith/core/traits.hpp>
+#include <aarith/float/float_policies.hpp>
 #include <aarith/float/floating_point.hpp>
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <utility>
+
 namespace aarith {
 
+/**
+ * @brief Right-shifts a mantissa and collects the guard, round and sticky bit.
+ *
+ * Only the three bits are kept of everything that is shifted out: the guard bit (the first bit
+ * shifted out), the round bit (the second one) and the sticky bit (the or of all the remaining
+ * bits). This is sufficient to correctly round the result of an addition or subtraction.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @tparam MW Width of the mantissa
+ * @param m The mantissa to be shifted
+ * @param shift_by The number of bits to shift
+ * @return Pair of the shifted mantissa and the bits shifted out packed as 0bGRS
+ */
+template <size_t MW, typename WordType>
+[[nodiscard]] constexpr std::pair<uinteger<MW, WordType>, unsigned int>
+rshift_grs(const uinteger<MW, WordType>& m, const size_t shift_by)
+{
+    if (shift_by == 0)
+    {
+        return {m, 0U};
+    }
+
+    if (shift_by > MW + 1)
+    {
+        // guard and round are zero, so the whole mantissa ends up in the sticky bit
+        return {uinteger<MW, WordType>::zero(), m.is_zero() ? 0U : 1U};
+    }
+
+    const unsigned int guard = (shift_by - 1 < MW) ? m.bit(shift_by - 1) : 0U;
+    const unsigned int round = (shift_by >= 2 && shift_by - 2 < MW) ? m.bit(shift_by - 2) : 0U;
+    const unsigned int sticky = (shift_by >= 3 && any_set_bit_below(m, shift_by - 2)) ? 1U : 0U;
+
+    return {m >> shift_by, (guard << 2U) | (round << 1U) | sticky};
+}
+
+/**
+ * @brief Returns the result of an operation that overflowed
+ *
+ * Depending on the rounding mode and the special-value policy, this is either infinity or the
+ * largest finite number.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t E, size_t M, typename WordType = uint64_t, class Rounding = round_to_nearest_even,
+          class Special = ieee_special_values>
+[[nodiscard]] constexpr auto overflow_value(const bool sign) -> floating_point<E, M, WordType>
+{
+    using F = floating_point<E, M, WordType>;
+
+    if (Special::handle_nan_inf && Rounding::overflow_to_infinity(sign))
+    {
+        return sign ? F::neg_infinity() : F::pos_infinity();
+    }
+
+    uinteger<E, WordType> largest_exponent{uinteger<E, WordType>::all_ones()};
+    largest_exponent.set_bit(0, false);
+    return F{sign, largest_exponent, uinteger<M + 1, WordType>::all_ones()};
+}
+
+/**
+ * @brief Normalizes, rounds and packs the result of an addition.
+ *
+ * The unnormalized result is given as a mantissa that might have overflown into an additional
+ * carry bit (bit M+1) and the guard, round and sticky bits. If the leading one is too far to the
+ * right, the mantissa is shifted to the left until it is normalized or the minimal exponent is
+ * reached (resulting in a subnormal number). The parameter `predicted_shift` allows to use an
+ * (under-)estimation of the left shift, e.g. from a leading-zero anticipator.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
+ * @param sign The sign of the result
+ * @param exponent The biased exponent of the result (at least one, also for subnormal numbers)
+ * @param sum The unnormalized mantissa (including the carry bit)
+ * @param grs The guard, round and sticky bits packed as 0bGRS
+ * @param predicted_shift A lower bound on the number of bits the result has to be shifted left
+ * @return The normalized and rounded floating-point number
+ */
+template <size_t E, size_t M, typename WordType = uint64_t, class Rounding = round_to_nearest_even,
+          class Special = ieee_special_values>
+[[nodiscard]] auto round_and_pack(const bool sign, size_t exponent,
+                                  const uinteger<M + 2, WordType>& sum, unsigned int grs,
+                                  const size_t predicted_shift = 0)
+    -> floating_point<E, M, WordType>
+{
+    const operation_scope<instrumentation::round_and_pack, 1 + E + M, E, M> scope;
+
+    using F = floating_point<E, M, WordType>;
+    using Mantissa = uinteger<M + 1, WordType>;
+
+    Mantissa mantissa;
+
+    if (sum.bit(M + 1))
+    {
+        // carry out of the mantissa: shift everything to the right by one
+        grs = (static_cast<unsigned int>(sum.bit(0)) << 2U) | ((grs >> 1U) & 2U) |
+              (((grs & 3U) != 0) ? 1U : 0U);
+        mantissa = width_cast<M + 1>(sum >> 1);
+        ++exponent;
+    }
+    else
+    {
+        mantissa = width_cast<M + 1>(sum);
+
+        if (!mantissa.msb())
+        {
+            // shift to the left, shifting in the guard, round and sticky bits, but do not shift
+            // below the minimal exponent
+            uinteger<M + 4, WordType> extended{mantissa};
+            extended <<= 3;
+            extended = extended | uinteger<M + 4, WordType>{grs};
+
+            const size_t max_shift = exponent - 1;
+            size_t shift = std::min(predicted_shift, max_shift);
+            extended <<= shift;
+            if (!extended.msb() && shift < max_shift)
+            {
+                const size_t correction =
+                    std::min(count_leading_zeroes(extended), max_shift - shift);
+                extended <<= correction;
+                shift += correction;
+            }
+
+            const unsigned int sticky = grs & 1U;
+            mantissa = width_cast<M + 1>(extended >> 3);
+            grs = static_cast<unsigned int>(extended.word(0) & 7U) | (shift > 0 ? sticky : 0U);
+            exponent -= shift;
+        }
+    }
+
+    if (Rounding::round_up(sign, mantissa.bit(0) == 1, grs))
+    {
+        const auto rounded = expanding_add(mantissa, Mantissa::one());
+        if (rounded.msb())
+        {
+            mantissa = width_cast<M + 1>(rounded >> 1);
+            ++exponent;
+        }
+        else
+        {
+            mantissa = width_cast<M + 1>(rounded);
+        }
+    }
+
+    if (mantissa.is_zero())
+    {
+        return sign ? F::neg_zero() : F::zero();
+    }
+
+    constexpr size_t max_exponent = (size_t{1} << E) - 1;
+    if (exponent >= max_exponent)
+    {
+        return overflow_value<E, M, WordType, Rounding, Special>(sign);
+    }
+
+    if constexpr (Special::flush_subnormals)
+    {
+        if (!mantissa.msb())
+        {
+            return sign ? F::neg_zero() : F::zero();
+        }
+    }
+
+    // subnormal numbers are stored with a zero exponent
+    const uinteger<E, WordType> biased_exponent{
+        static_cast<WordType>(mantissa.msb() ? exponent : 0U)};
+
+    return F{sign, biased_exponent, mantissa};
+}
+
+/**
+ * @brief Normalizes, rounds and packs an arbitrarily wide, exact result
+ *
+ * The value of the result is `(-1)^sign * mantissa * 2^exponent`. Bits that have been lost before
+ * calling this method can be accounted for by jamming them into the least significant bit (which,
+ * in this case, should not be one of the M+3 most significant bits).
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
+ * @param sign The sign of the result
+ * @param exponent The (unbiased) exponent of the least significant bit of the mantissa
+ * @param mantissa The unnormalized mantissa
+ * @return The normalized and rounded floating-point number
+ */
+template <size_t E, size_t M, typename WordType = uint64_t, class Rounding = round_to_nearest_even,
+          class Special = ieee_special_values, size_t W>
+[[nodiscard]] auto round_and_pack_wide(const bool sign, const int64_t exponent,
+                                       const uinteger<W, WordType>& mantissa)
+    -> floating_point<E, M, WordType>
+{
+    const operation_scope<instrumentation::round_and_pack_wide, 1 + E + M, E, M> scope;
+
+    using F = floating_point<E, M, WordType>;
+
+    if (mantissa.is_zero())
+    {
+        return sign ? F::neg_zero() : F::zero();
+    }
+
+    constexpr auto bias = static_cast<int64_t>(F::bias.word(0));
+    constexpr auto max_exponent = static_cast<int64_t>((size_t{1} << E) - 1);
+
+    const auto bits = static_cast<int64_t>(W - count_leading_zeroes(mantissa));
+
+    // the exponent of the leading one and the number of bits to shift to the right to obtain an
+    // M+1 bit mantissa (negative values indicate a shift to the left)
+    int64_t biased_exponent = exponent + bits - 1 + bias;
+    int64_t shift = bits - static_cast<int64_t>(M + 1);
+
+    if (biased_exponent < 1)
+    {
+        // subnormal result
+        shift += 1 - biased_exponent;
+        biased_exponent = 1;
+    }
+    if (biased_exponent >= max_exponent)
+    {
+        return overflow_value<E, M, WordType, Rounding, Special>(sign);
+    }
+
+    uinteger<M + 2, WordType> sum;
+    unsigned int grs = 0U;
+    if (shift > 0)
+    {
+        const auto [shifted, shifted_out] = rshift_grs(mantissa, static_cast<size_t>(shift));
+        sum = width_cast<M + 2>(shifted);
+        grs = shifted_out;
+    }
+    else
+    {
+        sum = width_cast<M + 2>(width_cast<M + 1>(mantissa) << static_cast<size_t>(-shift));
+    }
+
+    return round_and_pack<E, M, WordType, Rounding, Special>(
+        sign, static_cast<size_t>(biased_exponent), sum, grs);
+}
+
+/**
+ * @brief Replaces subnormal numbers by zero (keeping the sign)
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] constexpr auto flush_subnormal(const floating_point<E, M, WordType>& f)
+    -> floating_point<E, M, WordType>
+{
+    if (f.is_denormalized())
+    {
+        return f.get_sign() ? floating_point<E, M, WordType>::neg_zero()
+                            : floating_point<E, M, WordType>::zero();
+    }
+    return f;
+}
+
+/**
+ * @brief Returns the biased exponent of a floating-point number as it is used in computations
+ *
+ * Subnormal numbers have the exponent one (instead of the stored zero).
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] constexpr size_t effective_exponent(const floating_point<E, M, WordType>& f)
+{
+    const auto exponent = static_cast<size_t>(f.get_exponent().word(0));
+    return exponent == 0 ? 1 : exponent;
+}
+
+/**
+ * @brief Compares the absolute values of two finite floating-point numbers
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] constexpr bool magnitude_less(const floating_point<E, M, WordType>& lhs,
+                                            const floating_point<E, M, WordType>& rhs)
+{
+    const auto lhs_exp = lhs.get_exponent();
+    const auto rhs_exp = rhs.get_exponent();
+    return lhs_exp < rhs_exp ||
+           (lhs_exp == rhs_exp && lhs.get_full_mantissa() < rhs.get_full_mantissa());
+}
+
 /**
  * @brief Generic addition of two `floating_point` values
  *
@@ -12,60 +303,103 @@ namespace aarith {
  * and `fun_sub` to compute the new mantissa. This generic function allows to easily implement
  * own adders, e.g. to develop new hardware implementations.
  *
+ * The datapath is structured like that of a typical hardware floating-point unit:
+ *  - The far path handles effective additions and effective subtractions with an exponent
+ *    difference of at least two. The smaller operand is aligned keeping only the guard, round and
+ *    sticky bits. The result needs to be shifted by at most one bit.
+ *  - The near path handles effective subtractions with an exponent difference of at most one. No
+ *    sticky bit is needed here but massive cancellation can happen. The normalization shift is
+ *    predicted by a leading-zero anticipator.
+ *
+ * Both paths round according to the rounding policy (to nearest, ties to even by default). The
+ * functions `fun_add` and `fun_sub` always operate on the (aligned) full mantissae, the guard,
+ * round and sticky bits are handled separately.
+ *
  * @note As an end-user of aarith, you will, most likely, never need to call this function.
  *
  * @tparam E Exponent width
  * @tparam M Mantissa width
  * @tparam Function_add Function object type for  performing an addition
  * @tparam Function_sub Function object fype for performing a subtraction
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @param lhs Left-hand side argument of the usm
  * @param rhs Right-hand side argument of the sum
  * @param fun_add Function performing the addition of the mantissae
  * @param fun_sub Function performing the subtraction of the mantissae
  * @return The sum of lhs + rhs using the provided functions
  */
-template <size_t E, size_t M, class Function_add, class Function_sub>
+template <size_t E, size_t M, class Function_add, class Function_sub,
+          class Rounding = round_to_nearest_even, class Special = ieee_special_values>
 [[nodiscard]] auto add_(const floating_point<E, M> lhs, const floating_point<E, M> rhs,
                         Function_add fun_add, Function_sub fun_sub) -> floating_point<E, M>
 {
-    // order operands
-    if (abs(lhs) < abs(rhs))
-    {
-        return add_(rhs, lhs, fun_add, fun_sub);
-    }
+    static_assert(E < sizeof(size_t) * CHAR_BIT, "Exponent does not fit into size_t");
+    const operation_scope<instrumentation::add_, 1 + E + M, E, M> scope;
+
+    using Mantissa = uinteger<M + 1>;
+    using Sum = uinteger<M + 2>;
+
+    // order operands, the larger one determines the sign of the result
+    const bool swap = magnitude_less(lhs, rhs);
+    const floating_point<E, M>& larger = swap ? rhs : lhs;
+    const floating_point<E, M>& smaller = swap ? lhs : rhs;
+
+    const size_t exponent = effective_exponent(larger);
+    const size_t exponent_delta = exponent - effective_exponent(smaller);
+
+    const Mantissa larger_mantissa = larger.get_full_mantissa();
+    const Mantissa smaller_mantissa = smaller.get_full_mantissa();
 
-    // sub if 2nd operand is negative
-    if (lhs.get_sign() != rhs.get_sign())
+    const auto [aligned, grs] = rshift_grs(smaller_mantissa, exponent_delta);
+
+    if (lhs.get_sign() == rhs.get_sign())
     {
-        auto swap_sign = rhs;
-        swap_sign.set_sign(~swap_sign.get_sign());
-        return sub_(lhs, swap_sign, fun_add, fun_sub);
+        // far path, effective addition: the guard, round and sticky bits are not affected
+        const Sum sum{fun_add(larger_mantissa, aligned)};
+        return round_and_pack<E, M, uint64_t, Rounding, Special>(larger.get_sign(), exponent, sum,
+                                                                 grs);
     }
 
-    const auto exponent_delta =
-        sub(width_cast<E + 1>(lhs.get_exponent()), width_cast<E + 1>(rhs.get_exponent()));
+    // effective subtraction: borrow from the mantissa if any bit of the smaller operand was
+    // shifted out
+    const unsigned int borrow = (grs != 0) ? 1U : 0U;
+    const Mantissa subtrahend = add(aligned, Mantissa{borrow});
+    const Sum difference{width_cast<M + 1>(fun_sub(larger_mantissa, subtrahend))};
+    const unsigned int difference_grs = (8U - grs) & 7U;
 
-    auto extra_shift = 0U;
-    if (lhs.is_normalized() && !rhs.is_normalized())
+    if (difference.is_zero() && difference_grs == 0)
     {
-        extra_shift = 1;
+        // exact cancellation results in +0 (unless rounding toward negative infinity)
+        return Rounding::negative_exact_zero ? floating_point<E, M>::neg_zero()
+                                             : floating_point<E, M>::zero();
     }
 
-    const auto new_mantissa = rhs.get_full_mantissa() >> (exponent_delta.word(0) - extra_shift);
-    const auto mantissa_sum = fun_add(lhs.get_full_mantissa(), new_mantissa);
+    if (exponent_delta > 1)
+    {
+        // far path: at most a single bit is lost due to cancellation
+        return round_and_pack<E, M, uint64_t, Rounding, Special>(larger.get_sign(), exponent,
+                                                                 difference, difference_grs);
+    }
 
-    floating_point<E, mantissa_sum.width() - 1> sum(lhs.get_sign(), lhs.get_exponent(),
-                                                    mantissa_sum);
+    // near path: the operands are exact within M+2 bits (mantissa and guard bit), predict the
+    // leading zeroes from the operands
+    const Sum minuend = Sum{larger_mantissa} << 1;
+    const Sum near_subtrahend = Sum{smaller_mantissa} << (1 - exponent_delta);
+    const size_t predicted_shift = leading_zero_anticipation(minuend, near_subtrahend);
 
-    return normalize<E, mantissa_sum.width() - 1, M>(sum);
+    return round_and_pack<E, M, uint64_t, Rounding, Special>(
+        larger.get_sign(), exponent, difference, difference_grs, predicted_shift);
 }
 
 /**
  * @brief Generic subtraction of two `floating_point` values
  *
- * This method computes the difference of two floating-point values using the provided functions `fun_add`
- * and `fun_sub` to compute the new mantissa. This generic function allows to easily implement
- * own adders, e.g. to develop new hardware implementations.*
+ * This method computes the difference of two floating-point values using the provided functions
+ * `fun_add` and `fun_sub` to compute the new mantissa. This generic function allows to easily
+ * implement own adders, e.g. to develop new hardware implementations.*
+ *
+ * @see add_ for a description of the datapath
  *
  * @note As an end-user of aarith, you will, most likely, never need to call this function.
  *
@@ -73,353 +407,374 @@ template <size_t E, size_t M, class Function_add, class Function_sub>
  * @tparam M Mantissa width
  * @tparam Function_add Function object type for  performing an addition
  * @tparam Function_sub Function object fype for performing a subtraction
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @param lhs Left-hand side argument of the usm
  * @param rhs Right-hand side argument of the sum
  * @param fun_add Function performing the addition of the mantissae
  * @param fun_sub Function performing the subtraction of the mantissae
  * @return The sum of lhs + rhs using the provided functions
  */
-template <size_t E, size_t M, class Function_add, class Function_sub>
+template <size_t E, size_t M, class Function_add, class Function_sub,
+          class Rounding = round_to_nearest_even, class Special = ieee_special_values>
 [[nodiscard]] auto sub_(const floating_point<E, M> lhs, const floating_point<E, M> rhs,
                         Function_add fun_add, Function_sub fun_sub) -> floating_point<E, M>
 {
-    if (abs(lhs) < abs(rhs))
-    {
-        auto swap = rhs;
-        swap.set_sign(~swap.get_sign());
-        return add(swap, lhs);
-    }
-
-    if (lhs.get_sign() != rhs.get_sign())
-    {
-        auto swap_sign = rhs;
-        swap_sign.set_sign(~swap_sign.get_sign());
-        return add_(lhs, swap_sign, fun_add, fun_sub);
-    }
-
-    const auto exponent_delta = sub(lhs.get_exponent(), rhs.get_exponent());
-    auto extra_shift = 0U;
-    if (lhs.is_normalized() && !rhs.is_normalized())
-    {
-        extra_shift = 1;
-    }
-
-    const auto new_mantissa = rhs.get_full_mantissa() >> (exponent_delta.word(0) - extra_shift);
-    const auto mantissa_sum = fun_sub(lhs.get_full_mantissa(), new_mantissa);
-
-    floating_point<E, mantissa_sum.width() - 1> sum(lhs.get_sign(), lhs.get_exponent(),
-                                                    mantissa_sum);
+    auto negated = rhs;
+    negated.set_sign(~negated.get_sign());
+    return add_<E, M, Function_add, Function_sub, Rounding, Special>(lhs, negated, fun_add,
+                                                                     fun_sub);
+}
 
-    return normalize<E, mantissa_sum.width() - 1, M>(sum);
+/**
+ * @brief Returns the exponent of the least significant bit of the full mantissa
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] constexpr int64_t lsb_exponent(const floating_point<E, M, WordType>& f)
+{
+    return static_cast<int64_t>(effective_exponent(f)) -
+           static_cast<int64_t>(floating_point<E, M, WordType>::bias.word(0)) -
+           static_cast<int64_t>(M);
 }
 
 /**
- * @brief Adds two `floating_point` values
+ * @brief Adds two `floating_point` values using the given rounding and special-value policies
  *
  * @param lhs The first number that is to be summed up
  * @param rhs The second number that is to be summed up
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @tparam E Width of exponent
  * @tparam M Width of mantissa including the leading 1
  *
  * @return The sum
  *
  */
-template <size_t E, size_t M>
+template <class Rounding, class Special = ieee_special_values, size_t E, size_t M>
 [[nodiscard]] auto add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
-    if (lhs.is_nan())
+    if constexpr (Special::handle_nan_inf)
     {
-        return lhs.make_quiet_nan();
-    }
+        if (lhs.is_nan())
+        {
+            return lhs.make_quiet_nan();
+        }
 
-    if (rhs.is_nan())
-    {
-        return rhs.make_quiet_nan();
-    }
+        if (rhs.is_nan())
+        {
+            return rhs.make_quiet_nan();
+        }
 
-    if ((lhs.is_nan() || rhs.is_nan()) || (lhs.is_neg_inf() && rhs.is_pos_inf()) ||
-        (lhs.is_pos_inf() && rhs.is_neg_inf()))
-    {
-        return floating_point<E, M>::NaN();
+        if ((lhs.is_neg_inf() && rhs.is_pos_inf()) || (lhs.is_pos_inf() && rhs.is_neg_inf()))
+        {
+            return floating_point<E, M>::NaN();
+        }
+
+        if (lhs.is_inf())
+        {
+            return lhs;
+        }
+        if (rhs.is_inf())
+        {
+            return rhs;
+        }
     }
 
-    if (lhs.is_inf())
+    using Function_add = uinteger<M + 2, uint64_t> (*)(const uinteger<M + 1, uint64_t>&,
+                                                        const uinteger<M + 1, uint64_t>&);
+    using Function_sub = uinteger<M + 1, uint64_t> (*)(const uinteger<M + 1, uint64_t>&,
+                                                        const uinteger<M + 1, uint64_t>&);
+
+    if constexpr (Special::flush_subnormals)
     {
-        return lhs;
+        return add_<E, M, Function_add, Function_sub, Rounding, Special>(
+            flush_subnormal(lhs), flush_subnormal(rhs),
+            expanding_add<uinteger<M + 1>, uinteger<M + 1>>,
+            expanding_sub<uinteger<M + 1>, uinteger<M + 1>>);
     }
-    if (rhs.is_inf())
+    else
     {
-        return rhs;
+        return add_<E, M, Function_add, Function_sub, Rounding, Special>(
+            lhs, rhs, expanding_add<uinteger<M + 1>, uinteger<M + 1>>,
+            expanding_sub<uinteger<M + 1>, uinteger<M + 1>>);
     }
+}
 
-
-    return add_<
-        E, M,
-        class aarith::uinteger<M + 2, uint64_t> (*)(const aarith::uinteger<M + 1, uint64_t>&,
-                                                    const aarith::uinteger<M + 1, uint64_t>&),
-        class aarith::uinteger<M + 1, uint64_t> (*)(const aarith::uinteger<M + 1, uint64_t>&,
-                                                    const aarith::uinteger<M + 1, uint64_t>&)>(
-        lhs, rhs, expanding_add<uinteger<M + 1>, uinteger<M + 1>>,
-        expanding_sub<uinteger<M + 1>, uinteger<M + 1>>);
+/**
+ * @brief Adds two `floating_point` values
+ *
+ * @param lhs The first number that is to be summed up
+ * @param rhs The second number that is to be summed up
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The sum
+ *
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto add(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return add<round_to_nearest_even, ieee_special_values>(lhs, rhs);
 }
 
 /**
- * @brief Subtract two `floating_point` values
+ * @brief Subtract two `floating_point` values using the given rounding and special-value policies
  *
  * @param lhs The minuend
  * @param rhs The subtrahend
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @tparam E Width of exponent
  * @tparam M Width of mantissa including the leading 1
  *
  * @return The difference lhs-rhs
  *
  */
-template <size_t E, size_t M>
+template <class Rounding, class Special = ieee_special_values, size_t E, size_t M>
 [[nodiscard]] auto sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
     -> floating_point<E, M>
 {
-    if (lhs.is_nan())
+    if constexpr (Special::handle_nan_inf)
     {
-        return lhs.make_quiet_nan();
-    }
+        // the payload of NaNs has to be retained (without flipping the sign)
+        if (lhs.is_nan())
+        {
+            return lhs.make_quiet_nan();
+        }
 
-    if (rhs.is_nan())
-    {
-        return rhs.make_quiet_nan();
+        if (rhs.is_nan())
+        {
+            return rhs.make_quiet_nan();
+        }
     }
 
-    if ((lhs.is_nan() || rhs.is_nan()) || (lhs.is_pos_inf() && rhs.is_pos_inf()) ||
-        (lhs.is_neg_inf() && rhs.is_neg_inf()))
-    {
-        return floating_point<E, M>::NaN();
-    }
+    return add<Rounding, Special>(lhs, negate(rhs));
+}
 
-    return sub_<
-        E, M,
-        class aarith::uinteger<M + 2, uint64_t> (*)(const aarith::uinteger<M + 1, uint64_t>&,
-                                                    const aarith::uinteger<M + 1, uint64_t>&),
-        class aarith::uinteger<M + 1, uint64_t> (*)(const aarith::uinteger<M + 1, uint64_t>&,
-                                                    const aarith::uinteger<M + 1, uint64_t>&)>(
-        lhs, rhs, expanding_add<uinteger<M + 1>, uinteger<M + 1>>,
-        expanding_sub<uinteger<M + 1>, uinteger<M + 1>>);
+/**
+ * @brief Subtract two `floating_point` values
+ *
+ * @param lhs The minuend
+ * @param rhs The subtrahend
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The difference lhs-rhs
+ *
+ */
+template <size_t E, size_t M>
+[[nodiscard]] auto sub(const floating_point<E, M> lhs, const floating_point<E, M> rhs)
+    -> floating_point<E, M>
+{
+    return sub<round_to_nearest_even, ieee_special_values>(lhs, rhs);
 }
 
 /**
- * @brief Multiplies two `floating_point` numbers
+ * @brief Multiplies two `floating_point` numbers using the given rounding and special-value
+ * policies
+ *
+ * The product of the mantissae is computed exactly and rounded only once.
  *
  * @param lhs The multiplicand
  * @param rhs The multiplicator
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @tparam E Width of exponent
  * @tparam M Width of mantissa including the leading 1
  *
  * @return The product lhs*rhs
  *
  */
-template <size_t E, size_t M, typename WordType>
+template <class Rounding, class Special = ieee_special_values, size_t E, size_t M,
+          typename WordType>
 [[nodiscard]] auto mul(const floating_point<E, M, WordType> lhs,
                        const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
 {
-    if (lhs.is_nan())
-    {
-        return lhs.make_quiet_nan();
-    }
-
-    if (rhs.is_nan())
-    {
-        return rhs.make_quiet_nan();
-    }
-
-    if ((lhs.is_nan() || rhs.is_nan()) || (lhs.is_zero() && rhs.is_inf()) ||
-        (lhs.is_inf() && rhs.is_zero()))
-    {
-        return floating_point<E, M>::NaN();
-    }
+    using F = floating_point<E, M, WordType>;
 
-    // compute sign
-    auto sign = lhs.get_sign() ^ rhs.get_sign();
+    const bool sign = lhs.get_sign() ^ rhs.get_sign();
 
-    if (lhs.is_inf() || rhs.is_inf())
+    if constexpr (Special::handle_nan_inf)
     {
-        return sign ? floating_point<E, M>::neg_infinity() : floating_point<E, M>::pos_infinity();
-    }
-
-    // compute exponent
-    auto ext_esum = expanding_add(lhs.get_exponent(), rhs.get_exponent());
-    bool overflow = ext_esum.bit(E) == 1;
-    ext_esum = sub(ext_esum, width_cast<E + 1>(lhs.bias));
-    bool underflow = (not overflow) and ext_esum.bit(E) == 1;
-    overflow = overflow and ext_esum.bit(E) == 1;
+        if (lhs.is_nan())
+        {
+            return lhs.make_quiet_nan();
+        }
 
-    // compute mantissa
-    auto mproduct = schoolbook_expanding_mul(lhs.get_full_mantissa(), rhs.get_full_mantissa());
-    mproduct = mproduct >> M;
+        if (rhs.is_nan())
+        {
+            return rhs.make_quiet_nan();
+        }
 
-    // check for over or underflow and break
-    if (underflow || overflow)
-    {
-        floating_point<E, M> product;
-        product.set_sign(sign);
-        if (overflow)
+        if ((lhs.is_zero() && rhs.is_inf()) || (lhs.is_inf() && rhs.is_zero()))
         {
-            product.set_exponent(uinteger<E>::all_ones());
+            return F::NaN();
         }
-        else
+
+        if (lhs.is_inf() || rhs.is_inf())
         {
-            ext_esum = ~ext_esum;
-            ext_esum = add(ext_esum, uinteger<ext_esum.width()>(2));
-            if (ext_esum < uinteger<64>(M + 1)) // TODO remove this number? it should bit bit-width of size_t?
-            {
-                mproduct = mproduct >> ext_esum.word(0);
-                product.set_full_mantissa(width_cast<M + 1>(mproduct));
-            }
+            return sign ? F::neg_infinity() : F::pos_infinity();
         }
-        // return normalize<E, M, M>(product);
-        return product;
     }
 
-    auto esum = width_cast<E>(ext_esum);
+    F l{lhs};
+    F r{rhs};
+    if constexpr (Special::flush_subnormals)
+    {
+        l = flush_subnormal(lhs);
+        r = flush_subnormal(rhs);
+    }
 
-    floating_point<E, mproduct.width() - 1> product(sign, esum, mproduct);
+    // the explicit template arguments add the format to the counts of the instrumentation
+    const auto product = schoolbook_expanding_mul<M + 1, M + 1, WordType, E, M>(
+        l.get_full_mantissa(), r.get_full_mantissa());
 
-    return normalize<E, mproduct.width() - 1, M>(product);
+    return round_and_pack_wide<E, M, WordType, Rounding, Special>(
+        sign, lsb_exponent(l) + lsb_exponent(r), product);
 }
 
 /**
- * @brief Division with floating_points: lhs/rhs.
+ * @brief Multiplies two `floating_point` numbers
+ *
+ * @param lhs The multiplicand
+ * @param rhs The multiplicator
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ *
+ * @return The product lhs*rhs
+ *
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto mul(const floating_point<E, M, WordType> lhs,
+                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+{
+    return mul<round_to_nearest_even, ieee_special_values>(lhs, rhs);
+}
+
+/**
+ * @brief Division with floating_points using the given rounding and special-value policies
+ *
+ * The mantissae are normalized and divided such that the quotient has enough bits to round
+ * correctly. A non-zero remainder is accounted for as the sticky bit.
  *
  * @param lhs The dividend
  * @param rhs The divisor
+ * @tparam Rounding The rounding policy (see float_policies.hpp)
+ * @tparam Special The special-value policy (see float_policies.hpp)
  * @tparam E Width of exponent
  * @tparam M Width of mantissa including the leading 1
  * @tparam WordType The word type used to internally store the data
  * @return The quotient lhs/rhs
  *
  */
-template <size_t E, size_t M, typename WordType>
+template <class Rounding, class Special = ieee_special_values, size_t E, size_t M,
+          typename WordType>
 [[nodiscard]] auto div(const floating_point<E, M, WordType> lhs,
                        const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
 {
+    using F = floating_point<E, M, WordType>;
 
-    /*=================================
-     * 7.2. Invalid Operation
-     */
-    // TODO (keszocze) make this calls use the corresponding 754 std function once the branch is
-    // merged
-    if (lhs.is_nan())
-    {
-        return lhs.make_quiet_nan();
-    }
-
-    if (rhs.is_nan())
-    {
-        return rhs.make_quiet_nan();
-    }
+    const bool result_is_negative = lhs.get_sign() ^ rhs.get_sign();
 
-    if ((lhs.is_zero() && rhs.is_zero()) || (lhs.is_inf() && rhs.is_inf()))
+    F l{lhs};
+    F r{rhs};
+    if constexpr (Special::flush_subnormals)
     {
-        return floating_point<E, M>::NaN();
+        l = flush_subnormal(lhs);
+        r = flush_subnormal(rhs);
     }
-    //==========================================
 
-    const auto result_is_negative = lhs.get_sign() ^ rhs.get_sign();
-
-    if (rhs.is_zero())
+    if constexpr (Special::handle_nan_inf)
     {
-        return result_is_negative ? floating_point<E, M>::neg_infinity()
-                                  : floating_point<E, M>::pos_infinity();
-    }
+        /*=================================
+         * 7.2. Invalid Operation
+         */
+        if (l.is_nan())
+        {
+            return l.make_quiet_nan();
+        }
 
-    if (lhs.is_inf())
-    {
-        // due to the checks above, we already know that rhs is finite
-        return result_is_negative ? floating_point<E, M>::neg_zero() : floating_point<E, M>::zero();
-    }
+        if (r.is_nan())
+        {
+            return r.make_quiet_nan();
+        }
 
-    if (rhs.is_inf() || lhs.is_zero())
-    {
-        return result_is_negative ? floating_point<E, M>::neg_zero() : floating_point<E, M>::zero();
-    }
+        if ((l.is_zero() && r.is_zero()) || (l.is_inf() && r.is_inf()))
+        {
+            return F::NaN();
+        }
+        //==========================================
 
-    size_t denorm_exponent_lhs = 0;
-    const bool lhs_is_denormal = !lhs.is_normalized();
-    if (lhs_is_denormal)
-    {
-        // more precision of the computation with denormal numbers
-        //        denorm_exponent_lhs = M - find_leading_one(lhs.get_full_mantissa());
+        if (r.is_zero() || l.is_inf())
+        {
+            return result_is_negative ? F::neg_infinity() : F::pos_infinity();
+        }
 
-        denorm_exponent_lhs = [&lhs]() {
-            const std::optional<size_t> one_at = first_set_bit(lhs.get_full_mantissa());
-            if (one_at)
-            {
-                return size_t(M - (*one_at));
-            }
-            else
-            {
-                return size_t(0);
-            }
-        }();
+        if (r.is_inf())
+        {
+            return result_is_negative ? F::neg_zero() : F::zero();
+        }
     }
-    auto dividend = width_cast<2 * M + 1>(lhs.get_full_mantissa());
-    auto divisor = width_cast<2 * M + 1>(rhs.get_full_mantissa());
-    // shift to use integer division for producing 1,M
-    dividend = dividend << M + denorm_exponent_lhs;
-    auto mquotient = div(dividend, divisor);
-
-    auto exponent_tmp = expanding_add(lhs.get_exponent(), lhs.bias);
-    if (lhs_is_denormal)
+    else
     {
-        denorm_exponent_lhs -= 1U;
-        exponent_tmp = sub(exponent_tmp, uinteger<E + 1>(denorm_exponent_lhs));
+        // there is no infinity to return, but the integer division must not be called
+        if (r.is_zero())
+        {
+            return overflow_value<E, M, WordType, Rounding, Special>(result_is_negative);
+        }
     }
 
-    bool overflow = exponent_tmp.bit(E) == 1;
-
-    exponent_tmp = sub(exponent_tmp, width_cast<E + 1>(rhs.get_exponent()));
-    uinteger<E + 1> denorm_exponent_correction{1U};
-    if (!rhs.is_normalized())
+    if (l.is_zero())
     {
-        exponent_tmp = sub(exponent_tmp, denorm_exponent_correction);
+        return result_is_negative ? F::neg_zero() : F::zero();
     }
 
-    auto esum = width_cast<E>(exponent_tmp);
-    overflow &= exponent_tmp.bit(E) == 1;
-    const bool underflow = !overflow && exponent_tmp.bit(E) == 1;
+    // normalize the (possibly subnormal) mantissae such that the quotient has at least M+4 bits
+    constexpr size_t quotient_width = 2 * M + 5;
+    const auto dividend_mantissa = l.get_full_mantissa();
+    const auto divisor_mantissa = r.get_full_mantissa();
+    const size_t dividend_shift = count_leading_zeroes(dividend_mantissa);
+    const size_t divisor_shift = count_leading_zeroes(divisor_mantissa);
 
-    // check for over or underflow and break
-    if (underflow || overflow)
-    {
-        floating_point<E, M> quotient;
-        quotient.set_sign(result_is_negative);
-        // apparently float div does not produce -0
-        if (overflow)
-        {
-            quotient.set_exponent(uinteger<E>::all_ones());
-        }
-        else
-        {
-            // shift mantissa of subnormal number
-            // in case some part of the mantissa can be expressed as subnormal number
-            exponent_tmp = ~exponent_tmp;
-            exponent_tmp = add(exponent_tmp, uinteger<exponent_tmp.width()>(2));
-            if (exponent_tmp < uinteger<sizeof(M) * 8>(M + 1)) // TODO where does the 8 come from?
-            {
-                mquotient = rshift_and_round(mquotient, exponent_tmp.word(0));
-                quotient.set_full_mantissa(width_cast<M + 1>(mquotient));
-            }
-        }
-        return quotient;
-    }
-    else if (esum == uinteger<esum.width()>::zero())
+    const auto dividend =
+        shl<M + 4>(width_cast<quotient_width>(dividend_mantissa << dividend_shift));
+    const auto divisor = divisor_mantissa << divisor_shift;
+
+    auto [quotient, remainder] =
+        restoring_division<quotient_width, M + 1, WordType, E, M>(dividend, divisor);
+    if (!remainder.is_zero())
     {
-        floating_point<E, M> quotient{result_is_negative, esum,
-                                      width_cast<M + 1>(rshift_and_round(mquotient, 1))};
-        return quotient;
+        quotient.set_bit(0, true);
     }
 
-    floating_point<E, mquotient.width() - 1> quotient(result_is_negative, esum, mquotient);
+    const int64_t exponent = lsb_exponent(l) - static_cast<int64_t>(dividend_shift) -
+                             lsb_exponent(r) + static_cast<int64_t>(divisor_shift) -
+                             static_cast<int64_t>(M + 4);
 
-    return normalize<E, mquotient.width() - 1, M>(quotient);
+    return round_and_pack_wide<E, M, WordType, Rounding, Special>(result_is_negative, exponent,
+                                                                  quotient);
+}
+
+/**
+ * @brief Division with floating_points: lhs/rhs.
+ *
+ * @param lhs The dividend
+ * @param rhs The divisor
+ * @tparam E Width of exponent
+ * @tparam M Width of mantissa including the leading 1
+ * @tparam WordType The word type used to internally store the data
+ * @return The quotient lhs/rhs
+ *
+ */
+template <size_t E, size_t M, typename WordType>
+[[nodiscard]] auto div(const floating_point<E, M, WordType> lhs,
+                       const floating_point<E, M, WordType> rhs) -> floating_point<E, M, WordType>
+{
+    return div<round_to_nearest_even, ieee_special_values>(lhs, rhs);
 }
 
 /**
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @file float_policies.hpp
+ *
+ * Compile-time policies for the arithmetic operations on `floating_point` numbers.
+ *
+ * A rounding policy decides whether a result has to be rounded up (in magnitude) based on the
+ * sign, the least significant bit of the truncated mantissa and the guard, round and sticky bits
+ * (packed as 0bGRS). A special-value policy decides which checks for NaN, infinity and subnormal
+ * numbers are performed. As the policies are evaluated using `if constexpr`, unused checks do not
+ * make it into the generated code.
+ *
+ * @code
+ * auto c = add<round_toward_zero>(a, b);
+ * auto d = mul<round_to_nearest_even, finite_only>(a, b);
+ * @endcode
+ */
+
+namespace aarith {
+
+/**
+ * @brief Round to nearest, ties to even (the IEEE 754 default)
+ */
+struct round_to_nearest_even
+{
+    [[nodiscard]] static constexpr bool round_up(bool /*sign*/, bool lsb, unsigned int grs)
+    {
+        return (grs & 4U) != 0 && ((grs & 3U) != 0 || lsb);
+    }
+
+    [[nodiscard]] static constexpr bool overflow_to_infinity(bool /*sign*/)
+    {
+        return true;
+    }
+
+    static constexpr bool negative_exact_zero = false;
+};
+
+/**
+ * @brief Round toward zero, i.e., truncate
+ */
+struct round_toward_zero
+{
+    [[nodiscard]] static constexpr bool round_up(bool /*sign*/, bool /*lsb*/, unsigned int /*grs*/)
+    {
+        return false;
+    }
+
+    [[nodiscard]] static constexpr bool overflow_to_infinity(bool /*sign*/)
+    {
+        return false;
+    }
+
+    static constexpr bool negative_exact_zero = false;
+};
+
+/**
+ * @brief Round toward positive infinity
+ */
+struct round_toward_positive
+{
+    [[nodiscard]] static constexpr bool round_up(bool sign, bool /*lsb*/, unsigned int grs)
+    {
+        return !sign && grs != 0;
+    }
+
+    [[nodiscard]] static constexpr bool overflow_to_infinity(bool sign)
+    {
+        return !sign;
+    }
+
+    static constexpr bool negative_exact_zero = false;
+};
+
+/**
+ * @brief Round toward negative infinity
+ */
+struct round_toward_negative
+{
+    [[nodiscard]] static constexpr bool round_up(bool sign, bool /*lsb*/, unsigned int grs)
+    {
+        return sign && grs != 0;
+    }
+
+    [[nodiscard]] static constexpr bool overflow_to_infinity(bool sign)
+    {
+        return sign;
+    }
+
+    static constexpr bool negative_exact_zero = true;
+};
+
+/**
+ * @brief Small and fast xorshift random number generator
+ *
+ * This generator is by no means suitable for anything but generating random bits for stochastic
+ * rounding. It fulfills the requirements of a UniformRandomBitGenerator.
+ */
+class xorshift64_engine
+{
+public:
+    using result_type = uint64_t;
+
+    explicit constexpr xorshift64_engine(const uint64_t seed = 0x9E3779B97F4A7C15ULL)
+        : state(seed == 0 ? 1 : seed)
+    {
+    }
+
+    constexpr void seed(const uint64_t seed)
+    {
+        state = (seed == 0) ? 1 : seed;
+    }
+
+    [[nodiscard]] static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type operator()()
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    }
+
+private:
+    uint64_t state;
+};
+
+/**
+ * @brief Stochastic rounding
+ *
+ * The result is rounded up with a probability proportional to the distance to the truncated
+ * result. The distance is only known with the precision of the guard, round and sticky bits,
+ * i.e., the probabilities are multiples of 1/8.
+ *
+ * Every thread uses its own instance of the random number generator which can be reseeded
+ * using `seed` to get reproducible results.
+ *
+ * @tparam Engine The random bit generator to use
+ */
+template <class Engine = xorshift64_engine> struct round_stochastic
+{
+    static Engine& engine()
+    {
+        thread_local Engine engine_;
+        return engine_;
+    }
+
+    static void seed(const typename Engine::result_type s)
+    {
+        engine().seed(s);
+    }
+
+    [[nodiscard]] static bool round_up(bool /*sign*/, bool /*lsb*/, unsigned int grs)
+    {
+        const auto random_bits = static_cast<unsigned int>(engine()() & 7U);
+        return random_bits < grs;
+    }
+
+    [[nodiscard]] static constexpr bool overflow_to_infinity(bool /*sign*/)
+    {
+        return true;
+    }
+
+    static constexpr bool negative_exact_zero = false;
+};
+
+/**
+ * @brief Describes which special values have to be dealt with
+ *
+ * @tparam HandleNaNInf Whether NaN and infinity are checked for. If false, the inputs are assumed
+ * to be finite and overflowing results saturate at the largest finite value.
+ * @tparam FlushSubnormals Whether subnormal inputs and outputs are replaced by zero
+ */
+template <bool HandleNaNInf, bool FlushSubnormals> struct special_value_policy
+{
+    static constexpr bool handle_nan_inf = HandleNaNInf;
+    static constexpr bool flush_subnormals = FlushSubnormals;
+};
+
+/// Full IEEE 754 semantics (the default)
+using ieee_special_values = special_value_policy<true, false>;
+
+/// Inputs are never NaN or infinite, overflows saturate
+using finite_only = special_value_policy<false, false>;
+
+/// IEEE 754 semantics but subnormal inputs and results are flushed to zero
+using flush_to_zero = special_value_policy<true, true>;
+
+/// Inputs are never NaN or infinite, overflows saturate and subnormals are flushed to zero
+using finite_only_flush_to_zero = special_value_policy<false, true>;
+
+} // namespace aarith
@@ -2,6 +2,7 @@
 
 #include <aarith/integer.hpp>
 
+#include <algorithm>
 #include <random>
 #include <stdexcept>
 
@@ -54,12 +55,41 @@ enum class FloatGenerationModes
     /**
      * @brief Generates +/- inf and NaNs only
      */
-    Special
+    Special,
+
+    /**
+     * @brief Generates normalized numbers whose magnitudes are distributed log-uniformly
+     *
+     * Every binade of a range of (biased) exponents is equally likely, by default the binades of
+     * all normalized numbers.
+     */
+    LogUniform,
+
+    /**
+     * @brief Generates numbers at most a given number of ULPs away from a given number
+     *
+     * The neighbourhood extends across binades and zero. It is clamped to +/- infinity, i.e., no
+     * NaNs are generated.
+     */
+    UlpNeighbourhood,
+
+    /**
+     * @brief Generates normalized numbers close to the ties of rounding to fewer mantissa bits
+     *
+     * The lowest bits of the mantissa are the halfway pattern 10...0 or one ULP below or above it,
+     * i.e., rounding away these bits (e.g., when casting to a smaller format) has to break a tie or
+     * is one ULP away from a tie.
+     */
+    NearTie
 };
 
 /**
  * Implements random number generation interface. There is absolutely no guarantee on the type of
  * the distribution whatsoever!
+ *
+ * The bit pattern of a number is constructed directly: the sign and the mantissa are random bits
+ * and only the exponent is drawn from an interval (without rejecting and redrawing whole numbers).
+ * Batches of numbers can be generated as floating_points or as their packed IEEE-754 encodings.
  */
 template <size_t E, size_t M, FloatGenerationModes Mode = FloatGenerationModes::NonSpecial,
           typename WordType = uint64_t>
@@ -69,56 +99,243 @@ public:
     using F = floating_point<E, M, WordType>;
     using IntExp = typename F::IntegerExp;
     using IntFrac = typename F::IntegerFrac;
+    using result_type = F;
+    /**
+     * @brief The IEEE-754 encoding of the numbers (sign, exponent and fraction)
+     */
+    using bits_type = word_array<1 + E + M, WordType>;
 
-    explicit floating_point_distribution() = default;
+    explicit floating_point_distribution()
+        : exponents(min_exponent(), max_exponent())
+    {
+        static_assert(Mode != FloatGenerationModes::UlpNeighbourhood,
+                      "The neighbourhood of a number has to be given");
+        if constexpr (Mode == FloatGenerationModes::NearTie)
+        {
+            static_assert(M >= 2, "Ties require at least two mantissa bits");
+            tie_bits = std::clamp<size_t>(M / 2, 2, 64);
+        }
+    }
+
+    /**
+     * @brief Creates a distribution of the numbers between two binades
+     *
+     * @param min_exponent The (biased) exponent of the smallest binade
+     * @param max_exponent The (biased) exponent of the largest binade
+     */
+    template <FloatGenerationModes Mode_ = Mode,
+              typename = std::enable_if_t<Mode_ == FloatGenerationModes::LogUniform>>
+    explicit floating_point_distribution(const IntExp& min_exponent, const IntExp& max_exponent)
+        : exponents(min_exponent, max_exponent)
+    {
+        if (min_exponent == IntExp::zero() || max_exponent == IntExp::max())
+        {
+            throw std::invalid_argument("The binades have to be binades of normalized numbers");
+        }
+    }
+
+    /**
+     * @brief Creates a distribution of the numbers at most the given number of ULPs away from a
+     * number
+     *
+     * @param center The number in the middle of the neighbourhood (must not be NaN)
+     * @param ulps The maximal distance (less than 2^62)
+     */
+    template <FloatGenerationModes Mode_ = Mode,
+              typename = std::enable_if_t<Mode_ == FloatGenerationModes::UlpNeighbourhood>>
+    explicit floating_point_distribution(const F& center, const uint64_t ulps)
+        : exponents(IntExp::zero(), IntExp::zero())
+        , offsets(uinteger<64, WordType>::zero(), uinteger<64, WordType>{2U * ulps})
+        , ulps(ulps)
+        , center_key(to_key(as_word_array(center)))
+    {
+        if (isNaN(center))
+        {
+            throw std::invalid_argument("The neighbourhood of NaN is not defined");
+        }
+        if (ulps >= (uint64_t{1} << 62U))
+        {
+            throw std::invalid_argument("The neighbourhood must be smaller than 2^62 ULPs");
+        }
+    }
+
+    /**
+     * @brief Creates a distribution of numbers close to the ties of rounding away tie_bits bits
+     *
+     * @param tie_bits The number of (lowest) mantissa bits that are rounded away (2 to 64)
+     */
+    template <FloatGenerationModes Mode_ = Mode,
+              typename = std::enable_if_t<Mode_ == FloatGenerationModes::NearTie>>
+    explicit floating_point_distribution(const size_t tie_bits)
+        : exponents(min_exponent(), max_exponent())
+        , tie_bits(tie_bits)
+    {
+        if (tie_bits < 2 || tie_bits > std::min<size_t>(M, 64))
+        {
+            throw std::invalid_argument("The number of tie bits must be in [2, min(M, 64)]");
+        }
+    }
 
     template <typename Generator> auto operator()(Generator& g) -> F
     {
+        const bits_type bits = random_bits(g);
+        const bool sign = bits.msb();
+        const IntExp exponent{bit_range_view<E + M - 1, M>(bits)};
+        const IntFrac fraction{bit_range_view<M - 1, 0>(bits)};
+        return F{sign, exponent, fraction};
+    }
+
+    /**
+     * @brief Returns the IEEE-754 encoding of a random number
+     */
+    template <typename Generator> auto random_bits(Generator& g) -> bits_type
+    {
+        if constexpr (Mode == FloatGenerationModes::UlpNeighbourhood)
+        {
+            const auto offset = static_cast<int64_t>(load_bits(offsets(g), 0, 64)) -
+                                static_cast<int64_t>(ulps);
+            return from_key(add(center_key, key_type{offset}));
+        }
+        else
+        {
+            // the sign and the fraction are random bits
+            bits_type bits;
+            fill_random(&bits, &bits + 1, g);
 
-        IntExp e{IntExp::zero()};
+            if constexpr (Mode == FloatGenerationModes::DenormalizedOnly)
+            {
+                set_exponent(bits, IntExp::zero());
+            }
+            else if constexpr (Mode == FloatGenerationModes::Special)
+            {
+                set_exponent(bits, IntExp::max());
+            }
+            else if constexpr (Mode != FloatGenerationModes::FullyRandom)
+            {
+                set_exponent(bits, exponents(g));
+            }
 
+            if constexpr (Mode == FloatGenerationModes::NearTie)
+            {
+                // the halfway pattern, one ULP below or one ULP above it
+                const uint64_t halfway = uint64_t{1} << (tie_bits - 1);
+                const uint64_t offset = load_bits(tie_offsets(g), 0, 2);
+                store_bits(bits, 0, tie_bits, halfway + offset - 1U);
+            }
+
+            return bits;
+        }
+    }
+
+    /**
+     * @brief Fills [first, last) with random floating-point numbers
+     */
+    template <class OutputIt, class Generator>
+    void generate(OutputIt first, OutputIt last, Generator& g)
+    {
+        for (; first != last; ++first)
+        {
+            *first = (*this)(g);
+        }
+    }
+
+    /**
+     * @brief Fills [first, last) with the IEEE-754 encodings of random floating-point numbers
+     *
+     * In the mode FullyRandom, the encodings are random bits that are generated in bulk.
+     */
+    template <class ForwardIt, class Generator>
+    void generate_bits(ForwardIt first, ForwardIt last, Generator& g)
+    {
         if constexpr (Mode == FloatGenerationModes::FullyRandom)
         {
-            e = random_exp(g);
+            fill_random(first, last, g);
         }
-        else if constexpr (Mode == FloatGenerationModes::NormalizedOnly)
+        else
         {
-            e = random_norm_non_special_exp(g);
+            for (; first != last; ++first)
+            {
+                *first = random_bits(g);
+            }
         }
-        else if constexpr (Mode == FloatGenerationModes::NonSpecial)
+    }
+
+    void reset()
+    {
+    }
+
+private:
+    // wide enough for the signed magnitudes of all numbers and all offsets
+    using key_type = integer<std::max<size_t>(E + M + 2, 66), WordType>;
+
+    uniform_uinteger_distribution<E, WordType> exponents;
+    uniform_uinteger_distribution<64, WordType> offsets;
+    uniform_uinteger_distribution<2, WordType> tie_offsets{uinteger<2, WordType>::zero(),
+                                                           uinteger<2, WordType>{2U}};
+    uint64_t ulps{0};
+    key_type center_key;
+    size_t tie_bits{0};
+
+    [[nodiscard]] static constexpr IntExp min_exponent()
+    {
+        if constexpr (Mode == FloatGenerationModes::NonSpecial)
         {
-            e = random_non_special_exp(g);
+            return IntExp::zero();
         }
-        else if constexpr (Mode == FloatGenerationModes::NormalizedAndSpecial)
+        else
         {
-            e = random_norm_exp(g);
+            return IntExp::one();
         }
-        else if constexpr (Mode == FloatGenerationModes::Special)
+    }
+
+    [[nodiscard]] static constexpr IntExp max_exponent()
+    {
+        if constexpr (Mode == FloatGenerationModes::NormalizedAndSpecial)
         {
-            e = IntExp::all_ones();
+            return IntExp::max();
         }
         else
         {
-            // Mode == FloatGenerationModes::DenormalizedOnly
-            // nothing needs to be done here as e already is zero
+            return sub(IntExp::max(), IntExp::one());
         }
+    }
 
-        IntFrac m = random_mant(g);
-        bool sign = random_sign(g);
+    static void set_exponent(bits_type& bits, const IntExp& exponent)
+    {
+        if constexpr (E <= 64)
+        {
+            store_bits(bits, M, E, load_bits(exponent, 0, E));
+        }
+        else
+        {
+            for (size_t i = 0; i < E; ++i)
+            {
+                bits.set_bit(M + i, exponent.bit(i));
+            }
+        }
+    }
 
-        return F{sign, e, m};
+    /**
+     * Maps the encodings to integers in the order of the numbers (both zeroes are mapped to zero)
+     */
+    [[nodiscard]] static key_type to_key(const bits_type& bits)
+    {
+        const key_type magnitude{width_cast<E + M>(bits)};
+        return bits.msb() ? sub(key_type::zero(), magnitude) : magnitude;
     }
 
-private:
-    static constexpr IntExp exp_almost_max = sub(IntExp::max(), IntExp::one());
-
-    uniform_uinteger_distribution<E, WordType> random_norm_non_special_exp{IntExp::one(),
-                                                                           exp_almost_max};
-    uniform_uinteger_distribution<E, WordType> random_non_special_exp{IntExp::zero(),
-                                                                      exp_almost_max};
-    uniform_uinteger_distribution<E, WordType> random_norm_exp{IntExp::one(), IntExp::max()};
-    uniform_uinteger_distribution<E, WordType> random_exp{IntExp::zero(), IntExp::max()};
-    uniform_uinteger_distribution<M, WordType> random_mant;
-    std::bernoulli_distribution random_sign;
+    [[nodiscard]] static bits_type from_key(key_type key)
+    {
+        const key_type infinity{width_cast<E + M>(as_word_array(F::pos_infinity()))};
+        const bool negative = key.is_negative();
+        key_type magnitude = negative ? sub(key_type::zero(), key) : key;
+        if (infinity < magnitude)
+        {
+            magnitude = infinity;
+        }
+        bits_type bits{width_cast<1 + E + M>(magnitude)};
+        bits.set_bit(E + M, negative);
+        return bits;
+    }
 };
-} // namespace aarith
\ No newline at end of file
+} // namespace aarith
@@ -204,10 +204,10 @@ public:
 
     explicit constexpr floating_point(const word_array<1 + E + M>& w)
         : sign_neg(w.msb())
-        , exponent(bit_range<(E + M) - 1, M>(w))
+        , exponent(bit_range_view<(E + M) - 1, M>(w))
         , mantissa(exponent == IntegerExp::all_zeroes()
-                       ? IntegerMant{bit_range<M - 1, 0>(w)}
-                       : msb_one(IntegerMant{bit_range<M - 1, 0>(w)}))
+                       ? IntegerMant{bit_range_view<M - 1, 0>(w)}
+                       : msb_one(IntegerMant{bit_range_view<M - 1, 0>(w)}))
     {
     }
 
@@ -1019,6 +1019,8 @@ template <size_t M, typename WordType = uint64_t>
 auto rshift_and_round(const uinteger<M, WordType>& m, const size_t shift_by)
     -> uinteger<M, WordType>
 {
+    const operation_scope<instrumentation::rshift_and_round, M> scope;
+
     if (shift_by == 0)
     {
         return m;
@@ -1029,35 +1031,17 @@ auto rshift_and_round(const uinteger<M, WordType>& m, const size_t shift_by)
         return uinteger<M, WordType>(0U);
     }
 
-    auto round = 0U;
-
-    if (m.bit(shift_by - 1) == 1)
-    {
-        bool on_border = true;
-        for (auto c = shift_by - 1; c > 0; --c)
-        {
-            if (m.bit(c - 1) == 1)
-            {
-                on_border = false;
-                break;
-            }
-        }
-        if (on_border)
-        {
-            round = 0U;
-        }
-        else
-        {
-            round = 1U;
-        }
-    }
+    // round up if the first bit shifted out is set and it is not the only one (i.e. ties are
+    // truncated)
+    const bool round = m.bit(shift_by - 1) == 1 && any_set_bit_below(m, shift_by - 1);
 
-    return add((m >> shift_by), uinteger<M>(round));
+    return add((m >> shift_by), uinteger<M, WordType>(round ? 1U : 0U));
 }
 
 template <size_t E, size_t M1, size_t M2 = M1, typename WordType = uint64_t>
 auto normalize(const floating_point<E, M1, WordType>& num) -> floating_point<E, M2, WordType>
 {
+    const operation_scope<instrumentation::normalize, 1 + E + M1, E, M1> scope;
 
     auto exponent = width_cast<E + 1>(num.get_exponent());
     auto mantissa = num.get_full_mantissa();
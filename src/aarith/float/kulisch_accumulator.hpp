@@ -0,0 +1,333 @@
+#pragma once
+
+#include <aarith/core/thread_pool.hpp>
+#include <aarith/float/float_operations.hpp>
+#include <aarith/float/floating_point.hpp>
+#include <aarith/integer_no_operators.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace aarith {
+
+/**
+ * @brief Exact accumulator (Kulisch accumulator, quire) for sums and dot products
+ *
+ * The accumulator is a fixed-point register in two's complement that is wide enough to hold the
+ * product of any two finite `floating_point<E, M>` numbers exactly. Products and values are added
+ * without any rounding, only the final result is rounded (once) into the desired target format.
+ *
+ * Adding a value only touches the words of the register that the (shifted) mantissa covers; the
+ * carry is only propagated as far as necessary. This is much cheaper than a floating-point
+ * addition that has to align, normalize and round in every step.
+ *
+ * An additional 64 carry bits allow to sum up at least 2^63 products of maximal magnitude without
+ * overflowing.
+ *
+ * @tparam E Width of exponent of the values that are accumulated
+ * @tparam M Width of mantissa of the values that are accumulated
+ */
+template <size_t E, size_t M> class kulisch_accumulator
+{
+public:
+    using Float = floating_point<E, M>;
+
+    static constexpr size_t word_width = 64;
+    static constexpr size_t carry_bits = 64;
+
+    /// The exponent of the least significant bit of the register
+    static constexpr int64_t lsb_exponent = 2 * (1 - static_cast<int64_t>(Float::bias.word(0)) -
+                                                 static_cast<int64_t>(M));
+
+    /// The width of the register: everything from the smallest to the largest product plus carry
+    static constexpr size_t width = 2 * static_cast<size_t>(Float::bias.word(0) + 1) +
+                                    static_cast<size_t>(-lsb_exponent) + carry_bits;
+
+    using Register = uinteger<width, uint64_t>;
+
+    /**
+     * @brief Adds the exact product of two numbers
+     */
+    void accumulate_product(const Float& a, const Float& b)
+    {
+        const bool sign = a.get_sign() ^ b.get_sign();
+        if (a.is_nan() || b.is_nan() || a.is_inf() || b.is_inf())
+        {
+            // NaN, infinity times zero or a properly signed infinity
+            const bool invalid = a.is_nan() || b.is_nan() || a.is_zero() || b.is_zero();
+            accumulate_special(invalid ? Float::NaN()
+                                       : (sign ? Float::neg_infinity() : Float::pos_infinity()));
+            return;
+        }
+
+        const auto product = mantissa_product(a.get_full_mantissa(), b.get_full_mantissa());
+        add_shifted(product, aarith::lsb_exponent(a) + aarith::lsb_exponent(b), sign);
+    }
+
+    /**
+     * @brief Adds a number
+     */
+    void accumulate(const Float& a)
+    {
+        if (a.is_nan() || a.is_inf())
+        {
+            accumulate_special(a);
+            return;
+        }
+
+        add_shifted(a.get_full_mantissa(), aarith::lsb_exponent(a), a.get_sign());
+    }
+
+    /**
+     * @brief Adds the value stored in another accumulator
+     *
+     * This is used to merge the partial results of parallel reductions.
+     */
+    void merge(const kulisch_accumulator& other)
+    {
+        add_inplace(accumulator, other.accumulator);
+        nan = nan || other.nan || (pos_inf && other.neg_inf) || (neg_inf && other.pos_inf);
+        pos_inf = pos_inf || other.pos_inf;
+        neg_inf = neg_inf || other.neg_inf;
+    }
+
+    /**
+     * @brief Resets the accumulator to zero
+     */
+    void clear()
+    {
+        accumulator = Register::zero();
+        nan = false;
+        pos_inf = false;
+        neg_inf = false;
+    }
+
+    /**
+     * @brief Rounds the accumulated value into a floating-point number
+     *
+     * @note An exact zero is always returned as +0.
+     *
+     * @tparam ET Width of exponent of the target format
+     * @tparam MT Width of mantissa of the target format
+     * @tparam Rounding The rounding policy (see float_policies.hpp)
+     * @return The rounded value
+     */
+    template <size_t ET = E, size_t MT = M, class Rounding = round_to_nearest_even>
+    [[nodiscard]] floating_point<ET, MT> round() const
+    {
+        using Target = floating_point<ET, MT>;
+
+        if (nan || (pos_inf && neg_inf))
+        {
+            return Target::NaN();
+        }
+        if (pos_inf || neg_inf)
+        {
+            return pos_inf ? Target::pos_infinity() : Target::neg_infinity();
+        }
+
+        const bool negative = accumulator.msb();
+        const Register magnitude = negative ? sub(Register::zero(), accumulator) : accumulator;
+
+        return round_and_pack_wide<ET, MT, uint64_t, Rounding>(negative, lsb_exponent, magnitude);
+    }
+
+    /**
+     * @brief Returns the raw two's complement register
+     */
+    [[nodiscard]] const Register& get_register() const
+    {
+        return accumulator;
+    }
+
+private:
+    Register accumulator{Register::zero()};
+    bool nan{false};
+    bool pos_inf{false};
+    bool neg_inf{false};
+
+    void accumulate_special(const Float& f)
+    {
+        nan = nan || f.is_nan() || (f.is_pos_inf() && neg_inf) || (f.is_neg_inf() && pos_inf);
+        pos_inf = pos_inf || f.is_pos_inf();
+        neg_inf = neg_inf || f.is_neg_inf();
+    }
+
+    /**
+     * @brief Computes the exact product of two mantissae using native multiplication if possible
+     */
+    static uinteger<2 * (M + 1), uint64_t> mantissa_product(const uinteger<M + 1, uint64_t>& a,
+                                                            const uinteger<M + 1, uint64_t>& b)
+    {
+        if constexpr (2 * (M + 1) <= word_width)
+        {
+            return uinteger<2 * (M + 1), uint64_t>{a.word(0) * b.word(0)};
+        }
+#if defined(__SIZEOF_INT128__)
+        else if constexpr (M + 1 <= word_width)
+        {
+            __extension__ typedef unsigned __int128 uint128;
+            const uint128 product = static_cast<uint128>(a.word(0)) * b.word(0);
+            uinteger<2 * (M + 1), uint64_t> result;
+            result.set_word(0, static_cast<uint64_t>(product));
+            result.set_word(1, static_cast<uint64_t>(product >> word_width));
+            return result;
+        }
+#endif
+        else
+        {
+            return schoolbook_expanding_mul(a, b);
+        }
+    }
+
+    /**
+     * @brief Adds (or subtracts) `m * 2^exponent` to the register touching only the words needed
+     */
+    template <size_t W>
+    void add_shifted(const uinteger<W, uint64_t>& m, int64_t exponent, bool sign)
+    {
+        if (m.is_zero())
+        {
+            return;
+        }
+
+        const auto position = static_cast<size_t>(exponent - lsb_exponent);
+        const size_t first_word = position / word_width;
+
+        // the mantissa aligned to the word boundary
+        const auto aligned = width_cast<W + word_width>(m) << (position % word_width);
+
+        bool carry = false;
+        size_t index = first_word;
+        for (size_t i = 0; i < aligned.word_count() && index < accumulator.word_count();
+             ++i, ++index)
+        {
+            carry = add_word(index, aligned.word(i), carry, sign);
+        }
+        for (; carry && index < accumulator.word_count(); ++index)
+        {
+            carry = add_word(index, 0U, carry, sign);
+        }
+    }
+
+    /**
+     * @brief Adds/subtracts a single word including carry/borrow and returns the new carry/borrow
+     */
+    bool add_word(const size_t index, const uint64_t w, const bool carry, const bool subtract)
+    {
+        const uint64_t current = accumulator.word(index);
+        uint64_t result;
+        bool next_carry;
+        if (subtract)
+        {
+            result = current - w - (carry ? 1U : 0U);
+            next_carry = (current < w) || (carry && current == w);
+        }
+        else
+        {
+            result = current + w + (carry ? 1U : 0U);
+            next_carry = (result < current) || (carry && result == current);
+        }
+        accumulator.set_word(index, result);
+        return next_carry;
+    }
+};
+
+/**
+ * @brief The minimal number of elements per thread for which parallel_accumulate uses threads
+ *
+ * Shorter inputs are accumulated by the calling thread as handing them to the pool costs more
+ * than accumulating them.
+ */
+constexpr size_t kulisch_min_length_per_thread = 1024;
+
+/**
+ * @brief Splits a range of indices between the threads of a pool that each use their own
+ * accumulator
+ *
+ * The partial results are merged afterwards. As the accumulation is exact, the result does not
+ * depend on the number of threads. Ranges with fewer than `kulisch_min_length_per_thread`
+ * elements per thread use fewer threads (only the calling thread if the range is short).
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @param length The number of elements to accumulate
+ * @param pool The threads to use
+ * @param accumulate_element Function that adds the element with the given index to an accumulator
+ * @return The accumulator holding the merged result
+ */
+template <size_t E, size_t M, class Function>
+[[nodiscard]] kulisch_accumulator<E, M>
+parallel_accumulate(const size_t length, thread_pool& pool, Function accumulate_element)
+{
+    const size_t chunks =
+        std::max<size_t>(1, std::min(pool.size(), length / kulisch_min_length_per_thread));
+
+    std::vector<kulisch_accumulator<E, M>> partials(chunks);
+
+    const auto accumulate_chunk = [&](const size_t chunk) {
+        const size_t begin = length * chunk / chunks;
+        const size_t end = length * (chunk + 1) / chunks;
+        for (size_t i = begin; i < end; ++i)
+        {
+            accumulate_element(partials[chunk], i);
+        }
+    };
+
+    if (chunks == 1)
+    {
+        accumulate_chunk(0);
+        return partials[0];
+    }
+
+    pool.parallel_for(chunks, accumulate_chunk);
+    for (size_t chunk = 1; chunk < chunks; ++chunk)
+    {
+        partials[0].merge(partials[chunk]);
+    }
+    return partials[0];
+}
+
+/**
+ * @brief Computes the exactly accumulated dot product of two ranges
+ *
+ * @param first1 Begin of the first range
+ * @param last1 End of the first range
+ * @param first2 Begin of the second range
+ * @param pool The threads to use
+ * @return The accumulator holding the exact dot product
+ */
+template <size_t E, size_t M, class RandomIt1, class RandomIt2>
+[[nodiscard]] kulisch_accumulator<E, M>
+exact_dot_product(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+                  thread_pool& pool = default_thread_pool())
+{
+    const auto length = static_cast<size_t>(std::distance(first1, last1));
+    return parallel_accumulate<E, M>(length, pool,
+                                     [&](kulisch_accumulator<E, M>& acc, const size_t i) {
+                                         acc.accumulate_product(first1[i], first2[i]);
+                                     });
+}
+
+/**
+ * @brief Computes the exactly accumulated sum of a range
+ *
+ * @param first Begin of the range
+ * @param last End of the range
+ * @param pool The threads to use
+ * @return The accumulator holding the exact sum
+ */
+template <size_t E, size_t M, class RandomIt>
+[[nodiscard]] kulisch_accumulator<E, M> exact_sum(RandomIt first, RandomIt last,
+                                                  thread_pool& pool = default_thread_pool())
+{
+    const auto length = static_cast<size_t>(std::distance(first, last));
+    return parallel_accumulate<E, M>(length, pool,
+                                     [&](kulisch_accumulator<E, M>& acc, const size_t i) {
+                                         acc.accumulate(first[i]);
+                                     });
+}
+
+} // namespace aarith
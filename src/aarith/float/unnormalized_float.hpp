@@ -0,0 +1,346 @@
+#pragma once
+
+#include <aarith/float/float_operations.hpp>
+#include <aarith/float/floating_point.hpp>
+#include <aarith/integer_no_operators.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace aarith {
+
+/**
+ * @brief Extended, lazily normalized intermediate for chains of floating-point operations
+ *
+ * Every operation on `floating_point` normalizes and rounds its result. When the result is
+ * immediately fed into the next operation (e.g. in `a*b + c*d - e`), this is wasted work and
+ * introduces an additional rounding error per operation.
+ *
+ * An `unnormalized_float` stores the value as `(-1)^sign * mantissa * 2^exponent` with a mantissa
+ * of M+1+Extra bits and an unbounded (64 bit) exponent. Intermediate results are never rounded:
+ * bits that do not fit into the mantissa are only collected in a sticky bit that is jammed into
+ * the least significant bit. The value is rounded exactly once (to nearest, ties to even) when it
+ * is converted back into a `floating_point<E, M>`.
+ *
+ * The default of four extra bits (guard, round, sticky and one bit for cancellation) suffices to
+ * round every single operation exactly like `floating_point` does. With `Extra = M + 3` products
+ * are kept exactly and their sums keep a guard and a round bit, i.e., `a*b + c` becomes a fused
+ * multiply-add. (With `Extra = M + 1`, the product is exact but the sum may be rounded
+ * incorrectly when the addend is larger and cancels the leading bit of the product.)
+ *
+ * As this changes the rounding semantics (results usually are *more* accurate than the chain of
+ * individually rounded operations but they are not bit-identical), this has to be used
+ * explicitly:
+ *
+ * @code
+ * using L = unnormalized_float<8, 23>;
+ * floating_point<8, 23> r = L{a} * L{b} + L{c} * L{d} - L{e};
+ * @endcode
+ *
+ * @tparam E Width of exponent of the floating-point type that is being rounded to
+ * @tparam M Width of mantissa of the floating-point type that is being rounded to
+ * @tparam Extra Number of additional mantissa bits kept in the intermediate results
+ * @tparam WordType The word type used to internally store the data
+ */
+template <size_t E, size_t M, size_t Extra = 4, typename WordType = uint64_t>
+class unnormalized_float
+{
+public:
+    static constexpr size_t width = M + 1 + Extra;
+
+    using Float = floating_point<E, M, WordType>;
+    using Mantissa = uinteger<width, WordType>;
+
+    static_assert(Extra >= 4, "At least four extra bits are needed to round correctly");
+
+    /**
+     * @brief Creates the intermediate representation of an (exactly representable) float
+     */
+    explicit constexpr unnormalized_float(const Float& f)
+        : sign_neg(f.get_sign())
+        , exponent(0)
+        , mantissa(shl<Extra>(Mantissa{f.get_full_mantissa()}))
+        , inf(f.is_inf())
+        , nan(f.is_nan())
+    {
+        const auto biased = static_cast<int64_t>(f.get_exponent().word(0));
+        exponent = std::max(biased, int64_t{1}) - static_cast<int64_t>(Float::bias.word(0)) -
+                   static_cast<int64_t>(M + Extra);
+    }
+
+    /**
+     * @brief Creates an intermediate value from its components
+     *
+     * @param sign The sign of the value (true iff negative)
+     * @param exp The exponent of the least significant bit of the mantissa
+     * @param m The (not necessarily normalized) mantissa
+     */
+    constexpr unnormalized_float(const bool sign, const int64_t exp, const Mantissa& m)
+        : sign_neg(sign)
+        , exponent(exp)
+        , mantissa(m)
+        , inf(false)
+        , nan(false)
+    {
+    }
+
+    [[nodiscard]] static constexpr unnormalized_float NaN()
+    {
+        unnormalized_float result{false, 0, Mantissa::zero()};
+        result.nan = true;
+        return result;
+    }
+
+    [[nodiscard]] static constexpr unnormalized_float infinity(const bool sign)
+    {
+        unnormalized_float result{sign, 0, Mantissa::zero()};
+        result.inf = true;
+        return result;
+    }
+
+    [[nodiscard]] constexpr bool get_sign() const
+    {
+        return sign_neg;
+    }
+
+    [[nodiscard]] constexpr int64_t get_exponent() const
+    {
+        return exponent;
+    }
+
+    [[nodiscard]] constexpr const Mantissa& get_mantissa() const
+    {
+        return mantissa;
+    }
+
+    [[nodiscard]] constexpr bool is_nan() const
+    {
+        return nan;
+    }
+
+    [[nodiscard]] constexpr bool is_inf() const
+    {
+        return inf;
+    }
+
+    [[nodiscard]] constexpr bool is_zero() const
+    {
+        return !nan && !inf && mantissa.is_zero();
+    }
+
+    /**
+     * @brief Returns the value with the opposite sign
+     */
+    [[nodiscard]] constexpr unnormalized_float negated() const
+    {
+        unnormalized_float result{*this};
+        result.sign_neg = !sign_neg;
+        return result;
+    }
+
+    /**
+     * @brief Normalizes and rounds (to nearest, ties to even) the value into a `floating_point`
+     *
+     * This is the only place where rounding happens.
+     *
+     * @return The rounded floating-point value
+     */
+    [[nodiscard]] Float round() const
+    {
+        if (nan)
+        {
+            return Float::NaN();
+        }
+        if (inf)
+        {
+            return sign_neg ? Float::neg_infinity() : Float::pos_infinity();
+        }
+        return round_and_pack_wide<E, M, WordType>(sign_neg, exponent, mantissa);
+    }
+
+    /**
+     * @brief Rounds the value when assigning it back to a `floating_point`
+     */
+    // NOLINTNEXTLINE
+    operator Float() const
+    {
+        return round();
+    }
+
+private:
+    bool sign_neg;
+    int64_t exponent;
+    Mantissa mantissa;
+    bool inf;
+    bool nan;
+};
+
+/**
+ * @brief Cuts an expanded mantissa down to the width of an `unnormalized_float`
+ *
+ * The value is shifted such that the leading one becomes the most significant bit. The bits
+ * shifted out are jammed into the least significant bit, no rounding takes place.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <size_t E, size_t M, size_t Extra, typename WordType, size_t W>
+[[nodiscard]] constexpr unnormalized_float<E, M, Extra, WordType>
+jam_to_width(const bool sign, int64_t exponent, const uinteger<W, WordType>& m)
+{
+    using U = unnormalized_float<E, M, Extra, WordType>;
+    constexpr size_t width = U::width;
+
+    const size_t bits = W - count_leading_zeroes(m);
+    if (bits <= width)
+    {
+        return U{sign, exponent, width_cast<width>(m)};
+    }
+
+    const size_t shift = bits - width;
+    auto mantissa = width_cast<width>(m >> shift);
+    if (any_set_bit_below(m, shift))
+    {
+        mantissa.set_bit(0, true);
+    }
+    return U{sign, exponent + static_cast<int64_t>(shift), mantissa};
+}
+
+/**
+ * @brief Multiplies two intermediate values without rounding the result
+ */
+template <size_t E, size_t M, size_t Extra, typename WordType>
+[[nodiscard]] constexpr unnormalized_float<E, M, Extra, WordType>
+mul(const unnormalized_float<E, M, Extra, WordType>& lhs,
+    const unnormalized_float<E, M, Extra, WordType>& rhs)
+{
+    using U = unnormalized_float<E, M, Extra, WordType>;
+
+    const bool sign = lhs.get_sign() ^ rhs.get_sign();
+
+    if (lhs.is_nan() || rhs.is_nan() || (lhs.is_inf() && rhs.is_zero()) ||
+        (lhs.is_zero() && rhs.is_inf()))
+    {
+        return U::NaN();
+    }
+    if (lhs.is_inf() || rhs.is_inf())
+    {
+        return U::infinity(sign);
+    }
+
+    const auto product = expanding_mul(lhs.get_mantissa(), rhs.get_mantissa());
+    return jam_to_width<E, M, Extra>(sign, lhs.get_exponent() + rhs.get_exponent(), product);
+}
+
+/**
+ * @brief Adds two intermediate values without rounding the result
+ */
+template <size_t E, size_t M, size_t Extra, typename WordType>
+[[nodiscard]] constexpr unnormalized_float<E, M, Extra, WordType>
+add(const unnormalized_float<E, M, Extra, WordType>& lhs,
+    const unnormalized_float<E, M, Extra, WordType>& rhs)
+{
+    using U = unnormalized_float<E, M, Extra, WordType>;
+    using Mantissa = typename U::Mantissa;
+    constexpr auto width = static_cast<int64_t>(U::width);
+
+    if (lhs.is_nan() || rhs.is_nan() ||
+        (lhs.is_inf() && rhs.is_inf() && lhs.get_sign() != rhs.get_sign()))
+    {
+        return U::NaN();
+    }
+    if (lhs.is_inf() || rhs.is_inf())
+    {
+        return lhs.is_inf() ? lhs : rhs;
+    }
+    if (lhs.is_zero() || rhs.is_zero())
+    {
+        if (lhs.is_zero() && rhs.is_zero())
+        {
+            return U{lhs.get_sign() && rhs.get_sign(), 0, Mantissa::zero()};
+        }
+        return lhs.is_zero() ? rhs : lhs;
+    }
+
+    // align both operands such that the larger one leaves exactly one bit for the carry
+    const auto top = [](const U& u) {
+        return u.get_exponent() + width - static_cast<int64_t>(count_leading_zeroes(u.get_mantissa()));
+    };
+    const int64_t exponent = std::max(top(lhs), top(rhs)) + 1 - width;
+
+    const auto align = [exponent](const U& u) {
+        const int64_t shift = exponent - u.get_exponent();
+        if (shift <= 0)
+        {
+            return u.get_mantissa() << static_cast<size_t>(-shift);
+        }
+        const auto [shifted, grs] = rshift_grs(u.get_mantissa(), static_cast<size_t>(shift));
+        Mantissa result{shifted};
+        if (grs != 0)
+        {
+            result.set_bit(0, true);
+        }
+        return result;
+    };
+
+    const Mantissa l = align(lhs);
+    const Mantissa r = align(rhs);
+
+    if (lhs.get_sign() == rhs.get_sign())
+    {
+        return U{lhs.get_sign(), exponent, add(l, r)};
+    }
+
+    if (l == r)
+    {
+        return U{false, 0, Mantissa::zero()};
+    }
+    return (l > r) ? U{lhs.get_sign(), exponent, sub(l, r)}
+                   : U{rhs.get_sign(), exponent, sub(r, l)};
+}
+
+/**
+ * @brief Subtracts two intermediate values without rounding the result
+ */
+template <size_t E, size_t M, size_t Extra, typename WordType>
+[[nodiscard]] constexpr unnormalized_float<E, M, Extra, WordType>
+sub(const unnormalized_float<E, M, Extra, WordType>& lhs,
+    const unnormalized_float<E, M, Extra, WordType>& rhs)
+{
+    return add(lhs, rhs.negated());
+}
+
+namespace float_operators {
+
+template <size_t E, size_t M, size_t Extra, typename WordType>
+auto operator+(const unnormalized_float<E, M, Extra, WordType>& lhs,
+               const unnormalized_float<E, M, Extra, WordType>& rhs)
+    -> unnormalized_float<E, M, Extra, WordType>
+{
+    return add(lhs, rhs);
+}
+
+template <size_t E, size_t M, size_t Extra, typename WordType>
+auto operator-(const unnormalized_float<E, M, Extra, WordType>& lhs,
+               const unnormalized_float<E, M, Extra, WordType>& rhs)
+    -> unnormalized_float<E, M, Extra, WordType>
+{
+    return sub(lhs, rhs);
+}
+
+template <size_t E, size_t M, size_t Extra, typename WordType>
+auto operator*(const unnormalized_float<E, M, Extra, WordType>& lhs,
+               const unnormalized_float<E, M, Extra, WordType>& rhs)
+    -> unnormalized_float<E, M, Extra, WordType>
+{
+    return mul(lhs, rhs);
+}
+
+template <size_t E, size_t M, size_t Extra, typename WordType>
+auto operator-(const unnormalized_float<E, M, Extra, WordType>& x)
+    -> unnormalized_float<E, M, Extra, WordType>
+{
+    return x.negated();
+}
+
+} // namespace float_operators
+} // namespace aarith
@@ -6,5 +6,7 @@
 #include <aarith/float/float_string_utils.hpp>
 #include <aarith/float/float_utils.hpp>
 #include <aarith/float/floating_point.hpp>
+#include <aarith/float/kulisch_accumulator.hpp>
 #include <aarith/float/nan_payload.hpp>
-#include <aarith/float/total_order.hpp>
\ No newline at end of file
+#include <aarith/float/total_order.hpp>
+#include <aarith/float/unnormalized_float.hpp>
\ No newline at end of file
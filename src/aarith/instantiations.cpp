@@ -0,0 +1,20 @@
+/**
+ * @file instantiations.cpp
+ *
+ * The single translation unit of the aarith_instantiations library: it contains the explicit
+ * instantiations declared in instantiations.hpp.
+ */
+
+#define AARITH_COMPILING_INSTANTIATIONS
+
+#include <aarith/instantiations.hpp>
+
+namespace aarith {
+
+#define AARITH_DEFINE_WIDTH(W) AARITH_INSTANTIATE_WIDTH(template, W)
+#define AARITH_DEFINE_FORMAT(E, M) AARITH_INSTANTIATE_FORMAT(template, E, M)
+
+AARITH_INSTANTIATED_WIDTHS(AARITH_DEFINE_WIDTH)
+AARITH_INSTANTIATED_FORMATS(AARITH_DEFINE_FORMAT)
+
+} // namespace aarith
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <aarith/float.hpp>
+#include <aarith/integer.hpp>
+
+#include <ostream>
+#include <string>
+#include <utility>
+
+/**
+ * @file instantiations.hpp
+ *
+ * Explicit instantiation declarations of the operations on commonly used integer widths and
+ * floating-point formats. Translation units including this header (instead of aarith/integer.hpp
+ * and aarith/float.hpp) do not instantiate these operations themselves, they link against the
+ * instantiations compiled once into the aarith_instantiations library (build aarith with
+ * `-DBUILD_INSTANTIATIONS=ON` and link against `aarith::Instantiations`, which also defines
+ * `AARITH_EXTERN_TEMPLATES`).
+ *
+ * The widths and formats are configured using the CMake variables `AARITH_INSTANTIATED_WIDTHS`
+ * and `AARITH_INSTANTIATED_FORMATS`. Without `AARITH_EXTERN_TEMPLATES`, this header is equivalent
+ * to including aarith/integer.hpp and aarith/float.hpp.
+ *
+ * @note Only integers and floating-point numbers of 64-bit words are instantiated.
+ */
+
+#if __has_include(<aarith/instantiation_list.hpp>)
+#include <aarith/instantiation_list.hpp>
+#endif
+
+#if !defined(AARITH_INSTANTIATED_WIDTHS)
+#define AARITH_INSTANTIATED_WIDTHS(X) X(8) X(16) X(32) X(64) X(128)
+#endif
+
+#if !defined(AARITH_INSTANTIATED_FORMATS)
+#define AARITH_INSTANTIATED_FORMATS(X) X(8, 23) X(11, 52) X(5, 10)
+#endif
+
+/**
+ * @brief Instantiates (or declares the instantiations of) the operations on the (un)signed
+ * integers of the given width
+ */
+#define AARITH_INSTANTIATE_INTEGER(PREFIX, I)                                                      \
+    PREFIX I add<I>(const I&, const I&);                                                           \
+    PREFIX I sub<I>(const I&, const I&);                                                           \
+    PREFIX I mul<I>(const I&, const I&);                                                           \
+    PREFIX I div<I>(const I&, const I&);                                                           \
+    PREFIX I remainder<I>(const I&, const I&);                                                     \
+    PREFIX std::pair<I, I> restoring_division(const I&, const I&);                                 \
+    PREFIX std::string to_decimal(const I&);                                                       \
+    PREFIX I integer_operators::operator+<I>(const I&, const I&);                                  \
+    PREFIX I integer_operators::operator-<I>(const I&, const I&);                                  \
+    PREFIX I integer_operators::operator*<I>(const I&, const I&);                                  \
+    PREFIX I integer_operators::operator/<I>(const I&, const I&);                                  \
+    PREFIX I integer_operators::operator%<I>(const I&, const I&);                                  \
+    PREFIX std::ostream& operator<<<I>(std::ostream&, const I&);
+
+#define AARITH_INSTANTIATE_WIDTH(PREFIX, W)                                                        \
+    AARITH_INSTANTIATE_INTEGER(PREFIX, ::aarith::uinteger<W>)                                      \
+    AARITH_INSTANTIATE_INTEGER(PREFIX, ::aarith::integer<W>)                                       \
+    PREFIX std::string to_binary(const word_array<W>&);
+
+/**
+ * @brief Instantiates (or declares the instantiations of) the operations on the floating-point
+ * numbers of the given format
+ */
+#define AARITH_INSTANTIATE_FORMAT(PREFIX, E, M)                                                    \
+    PREFIX floating_point<E, M> add<E, M>(const floating_point<E, M>,                              \
+                                          const floating_point<E, M>);                             \
+    PREFIX floating_point<E, M> sub<E, M>(const floating_point<E, M>,                              \
+                                          const floating_point<E, M>);                             \
+    PREFIX floating_point<E, M> mul<E, M, uint64_t>(const floating_point<E, M>,                    \
+                                                    const floating_point<E, M>);                   \
+    PREFIX floating_point<E, M> div<E, M, uint64_t>(const floating_point<E, M>,                    \
+                                                    const floating_point<E, M>);                   \
+    PREFIX floating_point<E, M> float_operators::operator+(const floating_point<E, M>&,            \
+                                                           const floating_point<E, M>&);           \
+    PREFIX floating_point<E, M> float_operators::operator-(const floating_point<E, M>&,            \
+                                                           const floating_point<E, M>&);           \
+    PREFIX floating_point<E, M> float_operators::operator*(const floating_point<E, M>&,            \
+                                                           const floating_point<E, M>&);           \
+    PREFIX floating_point<E, M> float_operators::operator/(const floating_point<E, M>&,            \
+                                                           const floating_point<E, M>&);           \
+    PREFIX std::string to_binary(const floating_point<E, M>&, const bool);                         \
+    PREFIX std::string to_sci_string(const floating_point<E, M>);                                  \
+    PREFIX std::ostream& operator<<(std::ostream&, const floating_point<E, M>&);
+
+#if defined(AARITH_EXTERN_TEMPLATES) && !defined(AARITH_COMPILING_INSTANTIATIONS)
+
+namespace aarith {
+
+#define AARITH_EXTERN_WIDTH(W) AARITH_INSTANTIATE_WIDTH(extern template, W)
+#define AARITH_EXTERN_FORMAT(E, M) AARITH_INSTANTIATE_FORMAT(extern template, E, M)
+
+AARITH_INSTANTIATED_WIDTHS(AARITH_EXTERN_WIDTH)
+AARITH_INSTANTIATED_FORMATS(AARITH_EXTERN_FORMAT)
+
+#undef AARITH_EXTERN_WIDTH
+#undef AARITH_EXTERN_FORMAT
+
+} // namespace aarith
+
+#endif
@@ -62,6 +62,7 @@ template <class Integer, class Function>
 {
 
     static_assert(::aarith::is_integral_v<Integer>);
+    const operation_scope<instrumentation::approx_operation_post_masking, Integer::width()> scope;
 
     /*
      * In case of signed integers we *always* want to have the signed bit correct and, therefore,
@@ -153,6 +154,7 @@ template <typename Integer, typename Function>
                                                    const size_t bits = Integer::width())
 {
     static_assert(::aarith::is_integral_v<Integer>);
+    const operation_scope<instrumentation::approx_operation_pre_masking, Integer::width()> scope;
 
     /*
      * In case of signed integers we *always* want to have the signed bit correct and, therefore,
@@ -227,6 +229,8 @@ auto approx_uint_bitmasking_mul(const uinteger<Width, WordType>& opd1,
                                 const uinteger<Width, WordType>& opd2, const size_t bits)
     -> uinteger<2 * Width, WordType>
 {
+    const operation_scope<instrumentation::approx_uint_bitmasking_mul, Width> scope;
+
     constexpr auto product_width = 2 * Width;
 
     auto const mask = generate_bitmask<uinteger<product_width, WordType>>(bits);
@@ -251,6 +255,7 @@ uinteger<width + 1> FAUadder(const uinteger<width>& a, const uinteger<width>& b)
     static_assert(shared_bits <= lsp_width);
     static_assert(lsp_width < width);
     static_assert(lsp_width > 0);
+    const operation_scope<instrumentation::FAUadder, width> scope;
 
     constexpr size_t lsp_index = lsp_width - 1;
 
@@ -291,7 +296,7 @@ uinteger<width + 1> FAUadder(const uinteger<width>& a, const uinteger<width>& b)
     uinteger<width + 1> result{lsp};
 
     const auto extended_msp = width_cast<width + 1>(msp);
-    result = add(result, extended_msp << lsp_width);
+    result = add(result, shl<lsp_width>(extended_msp));
     return result;
 }
 
@@ -313,6 +318,7 @@ template <size_t W, size_t V, typename WordType>
 [[nodiscard]] uinteger<std::max(W, V), WordType> trivial_approx_add(const uinteger<W, WordType> a,
                                                                     const uinteger<V, WordType> b)
 {
+    const operation_scope<instrumentation::trivial_approx_add, std::max(W, V)> scope;
 
     constexpr auto word_adder = [](const WordType a_, const WordType b_) { return a_ + b_; };
 
@@ -325,6 +331,8 @@ template <size_t W, size_t V, typename WordType>
 template <size_t width, size_t lsp_width, size_t shared_bits = 0>
 uinteger<width + 1> FAU_sub(const uinteger<width>& a, [[maybe_unused]] const uinteger<width>& b)
 {
+    const operation_scope<instrumentation::FAU_sub, width> scope;
+
     auto b_inv = ~width_cast<width + 1>(b);
     const auto one = uinteger<width + 1>(1U);
     b_inv = add(b_inv, one);
@@ -0,0 +1,1082 @@
+#pragma once
+
+#include <aarith/core/limb_arena.hpp>
+#include <aarith/core/limb_operations.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file dyn_integer.hpp
+ *
+ * Integers whose width is chosen at run time. The width is fixed when an integer is constructed,
+ * operations on integers of different widths throw a `std::invalid_argument` (where the
+ * fixed-width types fail to compile).
+ *
+ * The limbs are stored inline for up to 256 bits. Wider integers take their limbs from a
+ * thread-local pool, i.e., the memory is reused once it has been freed. All arithmetic is
+ * implemented by the (non-templated) kernels of limb_operations.hpp.
+ *
+ * The bits are stored exactly like in a `uinteger<W>` or `integer<W>` with 64-bit words, both
+ * representations can be converted into each other without changing any bit.
+ */
+
+namespace aarith {
+
+/**
+ * @brief Thread-local pool of limb buffers
+ *
+ * Buffers are grouped in size classes of powers of two. Freed buffers are kept for reuse and
+ * only released when the thread ends.
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to use this class.
+ */
+class limb_pool
+{
+public:
+    limb_pool() = default;
+    limb_pool(const limb_pool&) = delete;
+    limb_pool& operator=(const limb_pool&) = delete;
+
+    ~limb_pool()
+    {
+        for (auto& free_list : free_lists)
+        {
+            for (limb* buffer : free_list)
+            {
+                delete[] buffer;
+            }
+        }
+        alive() = false;
+    }
+
+    /**
+     * @brief Returns a buffer of at least the given number of limbs
+     */
+    [[nodiscard]] static limb* allocate(const size_t count)
+    {
+        const size_t size_class = size_class_of(count);
+        if (alive())
+        {
+            auto& free_list = local().free_lists[size_class];
+            if (!free_list.empty())
+            {
+                limb* buffer = free_list.back();
+                free_list.pop_back();
+                return buffer;
+            }
+        }
+        return new limb[size_t{1} << size_class];
+    }
+
+    /**
+     * @brief Returns a buffer (obtained by allocate with the same count) to the pool
+     */
+    static void deallocate(limb* buffer, const size_t count)
+    {
+        if (alive())
+        {
+            local().free_lists[size_class_of(count)].push_back(buffer);
+        }
+        else
+        {
+            delete[] buffer;
+        }
+    }
+
+private:
+    std::array<std::vector<limb*>, limb_width> free_lists;
+
+    static limb_pool& local()
+    {
+        thread_local limb_pool pool;
+        return pool;
+    }
+
+    // cleared once the pool of the thread has been destroyed
+    static bool& alive()
+    {
+        thread_local bool is_alive = true;
+        return is_alive;
+    }
+
+    static size_t size_class_of(const size_t count)
+    {
+        size_t size_class = 0;
+        while ((size_t{1} << size_class) < count)
+        {
+            ++size_class;
+        }
+        return size_class;
+    }
+};
+
+/**
+ * @brief Bits of a width chosen at run time (the base of dyn_uinteger and dyn_integer)
+ *
+ * The bits beyond the width are always zero.
+ */
+class dyn_word_array
+{
+public:
+    using word_type = limb;
+
+    /**
+     * @brief Creates a zero of the given width
+     */
+    explicit dyn_word_array(const size_t width)
+        : width_(width)
+    {
+        if (width == 0)
+        {
+            throw std::invalid_argument("The width of a dyn_word_array must not be zero");
+        }
+        allocate();
+        std::fill(words, words + word_count(), limb{0});
+    }
+
+    dyn_word_array(const dyn_word_array& other)
+        : width_(other.width_)
+    {
+        allocate();
+        std::copy(other.words, other.words + word_count(), words);
+    }
+
+    dyn_word_array(dyn_word_array&& other) noexcept
+        : width_(other.width_)
+    {
+        if (other.is_inline())
+        {
+            words = inline_words.data();
+            std::copy(other.words, other.words + word_count(), words);
+        }
+        else
+        {
+            words = other.words;
+            other.width_ = 1;
+            other.words = other.inline_words.data();
+            other.words[0] = 0U;
+        }
+    }
+
+    dyn_word_array& operator=(const dyn_word_array& other)
+    {
+        if (this != &other)
+        {
+            if (word_count() != other.word_count())
+            {
+                release();
+                width_ = other.width_;
+                allocate();
+            }
+            width_ = other.width_;
+            std::copy(other.words, other.words + word_count(), words);
+        }
+        return *this;
+    }
+
+    dyn_word_array& operator=(dyn_word_array&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (other.is_inline())
+            {
+                if (word_count() != other.word_count())
+                {
+                    release();
+                    width_ = other.width_;
+                    words = inline_words.data();
+                }
+                width_ = other.width_;
+                std::copy(other.words, other.words + word_count(), words);
+            }
+            else
+            {
+                release();
+                width_ = other.width_;
+                words = other.words;
+                other.width_ = 1;
+                other.words = other.inline_words.data();
+                other.words[0] = 0U;
+            }
+        }
+        return *this;
+    }
+
+    ~dyn_word_array()
+    {
+        release();
+    }
+
+    /**
+     * @brief The number of limbs that are stored inline (without using the pool)
+     */
+    static constexpr size_t inline_word_count = 4;
+
+    [[nodiscard]] size_t width() const noexcept
+    {
+        return width_;
+    }
+
+    [[nodiscard]] static constexpr size_t word_width() noexcept
+    {
+        return limb_width;
+    }
+
+    [[nodiscard]] size_t word_count() const noexcept
+    {
+        return limb_count(width_);
+    }
+
+    [[nodiscard]] word_type word(const size_t index) const
+    {
+        return words[index];
+    }
+
+    void set_word(const size_t index, const word_type value)
+    {
+        words[index] = value;
+        if (index == word_count() - 1)
+        {
+            mask_limbs(words, width_);
+        }
+    }
+
+    [[nodiscard]] word_type bit(const size_t index) const
+    {
+        if (index >= width_)
+        {
+            throw std::out_of_range("Bit index out of range");
+        }
+        return (words[index / limb_width] >> (index % limb_width)) & 1U;
+    }
+
+    void set_bit(const size_t index, const bool value = true)
+    {
+        if (index >= width_)
+        {
+            throw std::out_of_range("Bit index out of range");
+        }
+        const limb mask = limb{1} << (index % limb_width);
+        words[index / limb_width] =
+            value ? (words[index / limb_width] | mask) : (words[index / limb_width] & ~mask);
+    }
+
+    [[nodiscard]] word_type msb() const
+    {
+        return bit(width_ - 1);
+    }
+
+    [[nodiscard]] bool is_zero() const
+    {
+        return is_zero_limbs(words, word_count());
+    }
+
+    [[nodiscard]] limb* data() noexcept
+    {
+        return words;
+    }
+
+    [[nodiscard]] const limb* data() const noexcept
+    {
+        return words;
+    }
+
+private:
+    size_t width_;
+    limb* words{nullptr};
+    std::array<limb, inline_word_count> inline_words{};
+
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+        return words == inline_words.data();
+    }
+
+    void allocate()
+    {
+        words = word_count() <= inline_word_count ? inline_words.data()
+                                                  : limb_pool::allocate(word_count());
+    }
+
+    void release() noexcept
+    {
+        if (words != nullptr && !is_inline())
+        {
+            limb_pool::deallocate(words, word_count());
+        }
+        words = inline_words.data();
+    }
+};
+
+/**
+ * @brief Unsigned integer whose width is chosen at run time
+ *
+ * @see uinteger
+ */
+class dyn_uinteger : public dyn_word_array
+{
+public:
+    /**
+     * @brief Creates a zero of the given width
+     */
+    explicit dyn_uinteger(const size_t width)
+        : dyn_word_array(width)
+    {
+    }
+
+    /**
+     * @brief Creates an integer of the given width with the given value (truncated to the width)
+     */
+    dyn_uinteger(const size_t width, const uint64_t value)
+        : dyn_word_array(width)
+    {
+        set_word(0, value);
+    }
+
+    /**
+     * @brief Copies the bits of a fixed-width unsigned integer
+     */
+    template <size_t W>
+    explicit dyn_uinteger(const uinteger<W, uint64_t>& value)
+        : dyn_word_array(W)
+    {
+        std::copy(value.data(), value.data() + value.word_count(), data());
+    }
+
+    /**
+     * @brief Converts into a fixed-width unsigned integer of the same width
+     *
+     * @throws std::invalid_argument If the widths differ
+     */
+    template <size_t W> explicit operator uinteger<W, uint64_t>() const
+    {
+        if (width() != W)
+        {
+            throw std::invalid_argument("The width of the dyn_uinteger does not match");
+        }
+        uinteger<W, uint64_t> result;
+        for (size_t i = 0; i < result.word_count(); ++i)
+        {
+            result.set_word(i, word(i));
+        }
+        return result;
+    }
+
+    explicit operator uint64_t() const
+    {
+        return word(0);
+    }
+
+    [[nodiscard]] static dyn_uinteger zero(const size_t width)
+    {
+        return dyn_uinteger{width};
+    }
+
+    [[nodiscard]] static dyn_uinteger one(const size_t width)
+    {
+        return dyn_uinteger{width, 1U};
+    }
+
+    [[nodiscard]] static dyn_uinteger min(const size_t width)
+    {
+        return zero(width);
+    }
+
+    [[nodiscard]] static dyn_uinteger max(const size_t width)
+    {
+        dyn_uinteger result{width};
+        std::fill(result.data(), result.data() + result.word_count(), ~limb{0});
+        mask_limbs(result.data(), width);
+        return result;
+    }
+
+    [[nodiscard]] bool is_negative() const
+    {
+        return false;
+    }
+};
+
+/**
+ * @brief Signed integer (in two's complement) whose width is chosen at run time
+ *
+ * @see integer
+ */
+class dyn_integer : public dyn_word_array
+{
+public:
+    /**
+     * @brief Creates a zero of the given width
+     */
+    explicit dyn_integer(const size_t width)
+        : dyn_word_array(width)
+    {
+    }
+
+    /**
+     * @brief Creates an integer of the given width with the given value (truncated to the width)
+     */
+    dyn_integer(const size_t width, const int64_t value)
+        : dyn_word_array(width)
+    {
+        const limb extension = value < 0 ? ~limb{0} : limb{0};
+        for (size_t i = 0; i < word_count(); ++i)
+        {
+            set_word(i, i == 0 ? static_cast<limb>(value) : extension);
+        }
+    }
+
+    /**
+     * @brief Copies the bits of a fixed-width signed integer
+     */
+    template <size_t W>
+    explicit dyn_integer(const integer<W, uint64_t>& value)
+        : dyn_word_array(W)
+    {
+        std::copy(value.data(), value.data() + value.word_count(), data());
+    }
+
+    /**
+     * @brief Reinterprets the bits of an unsigned integer
+     */
+    explicit dyn_integer(const dyn_uinteger& value)
+        : dyn_word_array(value)
+    {
+    }
+
+    /**
+     * @brief Converts into a fixed-width signed integer of the same width
+     *
+     * @throws std::invalid_argument If the widths differ
+     */
+    template <size_t W> explicit operator integer<W, uint64_t>() const
+    {
+        if (width() != W)
+        {
+            throw std::invalid_argument("The width of the dyn_integer does not match");
+        }
+        integer<W, uint64_t> result;
+        for (size_t i = 0; i < result.word_count(); ++i)
+        {
+            result.set_word(i, word(i));
+        }
+        return result;
+    }
+
+    [[nodiscard]] static dyn_integer zero(const size_t width)
+    {
+        return dyn_integer{width};
+    }
+
+    [[nodiscard]] static dyn_integer one(const size_t width)
+    {
+        return dyn_integer{width, 1};
+    }
+
+    [[nodiscard]] static dyn_integer minus_one(const size_t width)
+    {
+        return dyn_integer{width, -1};
+    }
+
+    [[nodiscard]] static dyn_integer min(const size_t width)
+    {
+        dyn_integer result{width};
+        result.set_bit(width - 1);
+        return result;
+    }
+
+    [[nodiscard]] static dyn_integer max(const size_t width)
+    {
+        dyn_integer result{width, -1};
+        result.set_bit(width - 1, false);
+        return result;
+    }
+
+    [[nodiscard]] bool is_negative() const
+    {
+        return msb() != 0U;
+    }
+};
+
+/**
+ * @brief Throws if two runtime-width integers do not have the same width
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+inline void check_same_width(const dyn_word_array& a, const dyn_word_array& b)
+{
+    if (a.width() != b.width())
+    {
+        throw std::invalid_argument("The widths of the operands differ");
+    }
+}
+
+/**
+ * @brief Adds an integer to another integer in-place (modulo 2^width)
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @return The carry out of the most significant bit
+ */
+inline bool dyn_add_inplace(dyn_word_array& a, const dyn_word_array& b)
+{
+    check_same_width(a, b);
+    const size_t top = a.width() % limb_width;
+    const limb carry = add_limbs(a.data(), a.data(), b.data(), a.word_count());
+    const bool carry_out = top == 0 ? carry != 0U : ((a.data()[a.word_count() - 1] >> top) & 1U);
+    mask_limbs(a.data(), a.width());
+    return carry_out;
+}
+
+/**
+ * @brief Subtracts an integer from another integer in-place (modulo 2^width)
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ *
+ * @return The borrow out of the most significant bit
+ */
+inline bool dyn_sub_inplace(dyn_word_array& a, const dyn_word_array& b)
+{
+    check_same_width(a, b);
+    const size_t top = a.width() % limb_width;
+    const limb borrow = sub_limbs(a.data(), a.data(), b.data(), a.word_count());
+    const bool borrow_out =
+        top == 0 ? borrow != 0U : ((a.data()[a.word_count() - 1] >> top) & 1U);
+    mask_limbs(a.data(), a.width());
+    return borrow_out;
+}
+
+/**
+ * @brief Adds the product of two integers to an accumulator in-place (modulo 2^width)
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+inline void dyn_mul_add_inplace(dyn_word_array& acc, const dyn_word_array& a,
+                                const dyn_word_array& b)
+{
+    check_same_width(acc, a);
+    check_same_width(acc, b);
+    if (&acc == &a || &acc == &b)
+    {
+        const dyn_word_array a_{a};
+        const dyn_word_array b_{b};
+        mul_add_limbs(acc.data(), a_.data(), b_.data(), acc.word_count());
+    }
+    else
+    {
+        mul_add_limbs(acc.data(), a.data(), b.data(), acc.word_count());
+    }
+    mask_limbs(acc.data(), acc.width());
+}
+
+// the overloads for the concrete types are preferred over the templates for fixed-width integers
+
+inline bool add_inplace(dyn_uinteger& a, const dyn_uinteger& b)
+{
+    return dyn_add_inplace(a, b);
+}
+
+inline bool add_inplace(dyn_integer& a, const dyn_integer& b)
+{
+    return dyn_add_inplace(a, b);
+}
+
+inline bool sub_inplace(dyn_uinteger& a, const dyn_uinteger& b)
+{
+    return dyn_sub_inplace(a, b);
+}
+
+inline bool sub_inplace(dyn_integer& a, const dyn_integer& b)
+{
+    return dyn_sub_inplace(a, b);
+}
+
+inline void mul_add_inplace(dyn_uinteger& acc, const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    dyn_mul_add_inplace(acc, a, b);
+}
+
+inline void mul_add_inplace(dyn_integer& acc, const dyn_integer& a, const dyn_integer& b)
+{
+    dyn_mul_add_inplace(acc, a, b);
+}
+
+[[nodiscard]] inline dyn_uinteger add(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    dyn_uinteger result{a};
+    add_inplace(result, b);
+    return result;
+}
+
+[[nodiscard]] inline dyn_integer add(const dyn_integer& a, const dyn_integer& b)
+{
+    dyn_integer result{a};
+    add_inplace(result, b);
+    return result;
+}
+
+[[nodiscard]] inline dyn_uinteger sub(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    dyn_uinteger result{a};
+    sub_inplace(result, b);
+    return result;
+}
+
+[[nodiscard]] inline dyn_integer sub(const dyn_integer& a, const dyn_integer& b)
+{
+    dyn_integer result{a};
+    sub_inplace(result, b);
+    return result;
+}
+
+[[nodiscard]] inline dyn_uinteger mul(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    dyn_uinteger result{a.width()};
+    mul_add_inplace(result, a, b);
+    return result;
+}
+
+[[nodiscard]] inline dyn_integer mul(const dyn_integer& a, const dyn_integer& b)
+{
+    // the lower bits of the product are the same for signed and unsigned multiplication
+    dyn_integer result{a.width()};
+    mul_add_inplace(result, a, b);
+    return result;
+}
+
+/**
+ * @brief Computes the two's complement of a signed integer
+ */
+[[nodiscard]] inline dyn_integer negate(const dyn_integer& n)
+{
+    dyn_integer result{n};
+    negate_limbs(result.data(), n.data(), n.word_count());
+    mask_limbs(result.data(), n.width());
+    return result;
+}
+
+/**
+ * @brief Computes the absolute value of a signed integer
+ *
+ * @note The absolute value of the smallest integer is the smallest integer itself.
+ */
+[[nodiscard]] inline dyn_integer abs(const dyn_integer& n)
+{
+    return n.is_negative() ? negate(n) : n;
+}
+
+/**
+ * @brief Divides two unsigned integers using restoring division
+ *
+ * @return Pair of (quotient, remainder)
+ * @throws std::runtime_error If the denominator is zero
+ */
+[[nodiscard]] inline std::pair<dyn_uinteger, dyn_uinteger>
+restoring_division(const dyn_uinteger& numerator, const dyn_uinteger& denominator)
+{
+    check_same_width(numerator, denominator);
+    if (denominator.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+
+    dyn_uinteger quotient{numerator.width()};
+    dyn_uinteger remainder{numerator.width()};
+    divide_limbs(quotient.data(), remainder.data(), numerator.data(), denominator.data(),
+                 numerator.width());
+    return std::make_pair(std::move(quotient), std::move(remainder));
+}
+
+/**
+ * @brief Divides two signed integers, the quotient is rounded towards zero and the remainder has
+ * the sign of the numerator
+ *
+ * @return Pair of (quotient, remainder)
+ * @throws std::runtime_error If the denominator is zero
+ */
+[[nodiscard]] inline std::pair<dyn_integer, dyn_integer>
+restoring_division(const dyn_integer& numerator, const dyn_integer& denominator)
+{
+    check_same_width(numerator, denominator);
+    if (denominator.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+
+    // the magnitudes fit into unsigned integers of the same width
+    const dyn_integer abs_numerator = abs(numerator);
+    const dyn_integer abs_denominator = abs(denominator);
+
+    dyn_integer quotient{numerator.width()};
+    dyn_integer remainder{numerator.width()};
+    divide_limbs(quotient.data(), remainder.data(), abs_numerator.data(), abs_denominator.data(),
+                 numerator.width());
+
+    if (numerator.is_negative() != denominator.is_negative())
+    {
+        quotient = negate(quotient);
+    }
+    if (numerator.is_negative())
+    {
+        remainder = negate(remainder);
+    }
+    return std::make_pair(std::move(quotient), std::move(remainder));
+}
+
+[[nodiscard]] inline dyn_uinteger div(const dyn_uinteger& numerator,
+                                      const dyn_uinteger& denominator)
+{
+    return restoring_division(numerator, denominator).first;
+}
+
+[[nodiscard]] inline dyn_integer div(const dyn_integer& numerator, const dyn_integer& denominator)
+{
+    return restoring_division(numerator, denominator).first;
+}
+
+[[nodiscard]] inline dyn_uinteger remainder(const dyn_uinteger& numerator,
+                                            const dyn_uinteger& denominator)
+{
+    return restoring_division(numerator, denominator).second;
+}
+
+[[nodiscard]] inline dyn_integer remainder(const dyn_integer& numerator,
+                                           const dyn_integer& denominator)
+{
+    return restoring_division(numerator, denominator).second;
+}
+
+/**
+ * @brief Changes the width of an unsigned integer (truncating or zero-extending it)
+ */
+[[nodiscard]] inline dyn_uinteger width_cast(const dyn_uinteger& a, const size_t width)
+{
+    dyn_uinteger result{width};
+    std::copy(a.data(), a.data() + std::min(a.word_count(), result.word_count()), result.data());
+    mask_limbs(result.data(), width);
+    return result;
+}
+
+/**
+ * @brief Changes the width of a signed integer (truncating or sign-extending it)
+ */
+[[nodiscard]] inline dyn_integer width_cast(const dyn_integer& a, const size_t width)
+{
+    dyn_integer result{width};
+    const limb extension = a.is_negative() ? ~limb{0} : limb{0};
+    for (size_t i = 0; i < result.word_count(); ++i)
+    {
+        limb w = extension;
+        if (i < a.word_count())
+        {
+            w = a.word(i);
+            if (i == a.word_count() - 1)
+            {
+                w |= extension & ~top_limb_mask(a.width());
+            }
+        }
+        result.data()[i] = w;
+    }
+    mask_limbs(result.data(), width);
+    return result;
+}
+
+[[nodiscard]] inline size_t count_leading_zeroes(const dyn_word_array& a)
+{
+    return count_leading_zeroes_limbs(a.data(), a.width());
+}
+
+inline dyn_uinteger& operator<<=(dyn_uinteger& a, const size_t shift)
+{
+    shift_left_limbs(a.data(), a.data(), a.word_count(), shift);
+    mask_limbs(a.data(), a.width());
+    return a;
+}
+
+inline dyn_integer& operator<<=(dyn_integer& a, const size_t shift)
+{
+    shift_left_limbs(a.data(), a.data(), a.word_count(), shift);
+    mask_limbs(a.data(), a.width());
+    return a;
+}
+
+inline dyn_uinteger& operator>>=(dyn_uinteger& a, const size_t shift)
+{
+    shift_right_limbs(a.data(), a.data(), a.word_count(), shift);
+    return a;
+}
+
+/**
+ * @brief Arithmetic right shift
+ */
+inline dyn_integer& operator>>=(dyn_integer& a, const size_t shift)
+{
+    const bool negative = a.is_negative();
+    sign_extend_limbs(a.data(), a.width());
+    shift_right_limbs(a.data(), a.data(), a.word_count(), shift, negative);
+    mask_limbs(a.data(), a.width());
+    return a;
+}
+
+[[nodiscard]] inline dyn_uinteger operator<<(const dyn_uinteger& a, const size_t shift)
+{
+    dyn_uinteger result{a};
+    return result <<= shift;
+}
+
+[[nodiscard]] inline dyn_integer operator<<(const dyn_integer& a, const size_t shift)
+{
+    dyn_integer result{a};
+    return result <<= shift;
+}
+
+[[nodiscard]] inline dyn_uinteger operator>>(const dyn_uinteger& a, const size_t shift)
+{
+    dyn_uinteger result{a};
+    return result >>= shift;
+}
+
+[[nodiscard]] inline dyn_integer operator>>(const dyn_integer& a, const size_t shift)
+{
+    dyn_integer result{a};
+    return result >>= shift;
+}
+
+/**
+ * @brief Applies a binary bitwise operation to all limbs
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <typename DynInteger, typename Op>
+[[nodiscard]] DynInteger dyn_bitwise(const DynInteger& a, const DynInteger& b, Op op)
+{
+    check_same_width(a, b);
+    DynInteger result{a};
+    for (size_t i = 0; i < a.word_count(); ++i)
+    {
+        result.data()[i] = op(a.word(i), b.word(i));
+    }
+    return result;
+}
+
+[[nodiscard]] inline dyn_uinteger operator&(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x & y; });
+}
+
+[[nodiscard]] inline dyn_integer operator&(const dyn_integer& a, const dyn_integer& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x & y; });
+}
+
+[[nodiscard]] inline dyn_uinteger operator|(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x | y; });
+}
+
+[[nodiscard]] inline dyn_integer operator|(const dyn_integer& a, const dyn_integer& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x | y; });
+}
+
+[[nodiscard]] inline dyn_uinteger operator^(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x ^ y; });
+}
+
+[[nodiscard]] inline dyn_integer operator^(const dyn_integer& a, const dyn_integer& b)
+{
+    return dyn_bitwise(a, b, [](const limb x, const limb y) { return x ^ y; });
+}
+
+[[nodiscard]] inline dyn_uinteger operator~(const dyn_uinteger& a)
+{
+    dyn_uinteger result{a};
+    for (size_t i = 0; i < a.word_count(); ++i)
+    {
+        result.data()[i] = ~a.word(i);
+    }
+    mask_limbs(result.data(), a.width());
+    return result;
+}
+
+[[nodiscard]] inline dyn_integer operator~(const dyn_integer& a)
+{
+    dyn_integer result{a};
+    for (size_t i = 0; i < a.word_count(); ++i)
+    {
+        result.data()[i] = ~a.word(i);
+    }
+    mask_limbs(result.data(), a.width());
+    return result;
+}
+
+/**
+ * @brief Compares two unsigned integers
+ *
+ * @return A negative value, zero or a positive value if a is less than, equal to or greater than b
+ */
+[[nodiscard]] inline int compare(const dyn_uinteger& a, const dyn_uinteger& b)
+{
+    check_same_width(a, b);
+    return compare_limbs(a.data(), b.data(), a.word_count());
+}
+
+/**
+ * @brief Compares two signed integers
+ *
+ * @return A negative value, zero or a positive value if a is less than, equal to or greater than b
+ */
+[[nodiscard]] inline int compare(const dyn_integer& a, const dyn_integer& b)
+{
+    check_same_width(a, b);
+    if (a.is_negative() != b.is_negative())
+    {
+        return a.is_negative() ? -1 : 1;
+    }
+    // two's complement numbers of the same sign compare like unsigned numbers
+    return compare_limbs(a.data(), b.data(), a.word_count());
+}
+
+#define AARITH_DYN_COMPARISONS(Type)                                                               \
+    [[nodiscard]] inline bool operator==(const Type& a, const Type& b)                            \
+    {                                                                                              \
+        return compare(a, b) == 0;                                                                 \
+    }                                                                                              \
+    [[nodiscard]] inline bool operator!=(const Type& a, const Type& b)                            \
+    {                                                                                              \
+        return compare(a, b) != 0;                                                                 \
+    }                                                                                              \
+    [[nodiscard]] inline bool operator<(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return compare(a, b) < 0;                                                                  \
+    }                                                                                              \
+    [[nodiscard]] inline bool operator<=(const Type& a, const Type& b)                            \
+    {                                                                                              \
+        return compare(a, b) <= 0;                                                                 \
+    }                                                                                              \
+    [[nodiscard]] inline bool operator>(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return compare(a, b) > 0;                                                                  \
+    }                                                                                              \
+    [[nodiscard]] inline bool operator>=(const Type& a, const Type& b)                            \
+    {                                                                                              \
+        return compare(a, b) >= 0;                                                                 \
+    }
+
+AARITH_DYN_COMPARISONS(dyn_uinteger)
+AARITH_DYN_COMPARISONS(dyn_integer)
+
+#undef AARITH_DYN_COMPARISONS
+
+/**
+ * @brief Converts an unsigned integer into its decimal representation
+ */
+[[nodiscard]] inline std::string to_decimal(const dyn_uinteger& value)
+{
+    return limbs_to_decimal(value.data(), value.word_count());
+}
+
+/**
+ * @brief Converts a signed integer into its decimal representation
+ */
+[[nodiscard]] inline std::string to_decimal(const dyn_integer& value)
+{
+    dyn_uinteger magnitude{value.width()};
+    const dyn_integer abs_value = abs(value);
+    std::copy(abs_value.data(), abs_value.data() + abs_value.word_count(), magnitude.data());
+    return (value.is_negative() ? "-" : "") + to_decimal(magnitude);
+}
+
+/**
+ * @brief Converts an integer into its binary representation (of exactly width digits)
+ */
+[[nodiscard]] inline std::string to_binary(const dyn_word_array& value)
+{
+    std::string result;
+    result.reserve(value.width());
+    for (size_t i = value.width(); i > 0; --i)
+    {
+        result += value.bit(i - 1) ? '1' : '0';
+    }
+    return result;
+}
+
+inline std::ostream& operator<<(std::ostream& out, const dyn_uinteger& value)
+{
+    return out << to_decimal(value);
+}
+
+inline std::ostream& operator<<(std::ostream& out, const dyn_integer& value)
+{
+    return out << to_decimal(value);
+}
+
+namespace integer_operators {
+
+[[nodiscard]] inline dyn_integer operator-(const dyn_integer& a)
+{
+    return negate(a);
+}
+
+#define AARITH_DYN_ARITHMETIC_OPERATORS(Type)                                                      \
+    [[nodiscard]] inline Type operator+(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return add(a, b);                                                                          \
+    }                                                                                              \
+    [[nodiscard]] inline Type operator-(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return sub(a, b);                                                                          \
+    }                                                                                              \
+    [[nodiscard]] inline Type operator*(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return mul(a, b);                                                                          \
+    }                                                                                              \
+    [[nodiscard]] inline Type operator/(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return div(a, b);                                                                          \
+    }                                                                                              \
+    [[nodiscard]] inline Type operator%(const Type& a, const Type& b)                             \
+    {                                                                                              \
+        return remainder(a, b);                                                                    \
+    }                                                                                              \
+    inline Type& operator+=(Type& a, const Type& b)                                                \
+    {                                                                                              \
+        add_inplace(a, b);                                                                         \
+        return a;                                                                                  \
+    }                                                                                              \
+    inline Type& operator-=(Type& a, const Type& b)                                                \
+    {                                                                                              \
+        sub_inplace(a, b);                                                                         \
+        return a;                                                                                  \
+    }                                                                                              \
+    inline Type& operator*=(Type& a, const Type& b)                                                \
+    {                                                                                              \
+        a = mul(a, b);                                                                             \
+        return a;                                                                                  \
+    }                                                                                              \
+    inline Type& operator/=(Type& a, const Type& b)                                                \
+    {                                                                                              \
+        a = div(a, b);                                                                             \
+        return a;                                                                                  \
+    }                                                                                              \
+    inline Type& operator%=(Type& a, const Type& b)                                                \
+    {                                                                                              \
+        a = remainder(a, b);                                                                       \
+        return a;                                                                                  \
+    }
+
+AARITH_DYN_ARITHMETIC_OPERATORS(dyn_uinteger)
+AARITH_DYN_ARITHMETIC_OPERATORS(dyn_integer)
+
+#undef AARITH_DYN_ARITHMETIC_OPERATORS
+
+} // namespace integer_operators
+
+} // namespace aarith
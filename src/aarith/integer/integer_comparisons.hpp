@@ -1,5 +1,6 @@
 #pragma once
 
+#include <aarith/core/limb_operations.hpp>
 #include <aarith/core/traits.hpp>
 #include <aarith/integer/integers.hpp>
 
@@ -35,6 +36,14 @@ constexpr bool operator<(const uinteger<W, WordType>& a, const uinteger<V, WordT
     constexpr size_t words_W = integer<W, WordType>::word_count();
     constexpr size_t words_V = integer<V, WordType>::word_count();
 
+    if constexpr (words_W == words_V && uses_limb_kernels<W, WordType>())
+    {
+        if (use_limb_kernels())
+        {
+            return compare_limbs(a.data(), b.data(), words_W) < 0;
+        }
+    }
+
     if constexpr (words_W == words_V)
     {
         for (auto i = words_W; i > 0; --i)
@@ -1,51 +1,277 @@
 #pragma once
+#include <aarith/core/instrumentation.hpp>
+#include <aarith/core/limb_arena.hpp>
+#include <aarith/core/limb_operations.hpp>
 #include <aarith/core/traits.hpp>
 #include <aarith/integer/integers.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace aarith {
 
 /**
- * @brief Adds two unsigned integers of, possibly, different bit widths.
+ * @brief Returns the word with the given index of an integer sign-extended to infinite width
  *
- * @tparam I Integer type of the first summand
- * @tparam T Integer type of the second summand
- * @param a First summand
- * @param b Second summand
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <typename I>
+[[nodiscard]] constexpr typename I::word_type extended_word(const I& x, const size_t index)
+{
+    using word_type = typename I::word_type;
+    constexpr auto ones = std::numeric_limits<word_type>::max();
+
+    if constexpr (is_unsigned_v<I>)
+    {
+        return index < I::word_count() ? x.word(index) : word_type{0};
+    }
+    else
+    {
+        const bool negative = x.is_negative();
+        if (index >= I::word_count())
+        {
+            return negative ? ones : word_type{0};
+        }
+        if (negative && index == I::word_count() - 1)
+        {
+            return static_cast<word_type>(x.word(index) | ~I::word_mask(index));
+        }
+        return x.word(index);
+    }
+}
+
+/**
+ * @brief Adds an integer to another integer in-place
+ *
+ * In contrast to `add`, no temporary integers are created. The summand may be narrower than the
+ * target, it is then (sign-)extended on the fly. The sum is computed modulo 2^I::width().
+ *
+ * @tparam I The integer type of the target
+ * @tparam T The integer type of the summand
+ * @param a The first summand, overwritten with the sum
+ * @param b The second summand
  * @param initial_carry True if there is an initial carry coming in
- * @return Sum of a and b with bit width max(I::width,T::width)+1
+ * @return The carry out of the most significant bit
  */
 template <typename I, typename T>
-[[nodiscard]] constexpr auto expanding_add(const I& a, const T& b, const bool initial_carry)
+constexpr bool add_inplace(I& a, const T& b, const bool initial_carry = false)
 {
+    static_assert(::aarith::is_integral_v<I>);
+    static_assert(::aarith::is_integral_v<T>);
+    static_assert(::aarith::same_signedness<I, T>);
+    static_assert(::aarith::same_word_type<I, T>);
+    static_assert(T::width() <= I::width(), "The summand must not be wider than the target");
+
+    using word_type = typename I::word_type;
+    constexpr size_t top_bits = I::width() % I::word_width();
+
+    if constexpr (std::is_same_v<I, T> && uses_limb_kernels<I::width(), word_type>())
+    {
+        if (use_limb_kernels())
+        {
+            const limb carry = add_limbs(a.data(), a.data(), b.data(), I::word_count(),
+                                         initial_carry ? limb{1U} : limb{0U});
+            if constexpr (top_bits > 0)
+            {
+                // the carry out of a partially used word is the bit just above its used bits
+                const limb top = a.word(I::word_count() - 1);
+                a.set_word(I::word_count() - 1, top);
+                return ((top >> top_bits) & 1U) != 0U;
+            }
+            return carry != 0U;
+        }
+    }
+
+    word_type carry = initial_carry ? word_type{1U} : word_type{0U};
+    for (size_t i = 0; i < I::word_count(); ++i)
+    {
+        const word_type word_a = a.word(i);
+        // the (sign-)extension must not reach beyond the width of the target
+        const auto word_b = static_cast<word_type>(extended_word(b, i) & I::word_mask(i));
+
+        auto sum = static_cast<word_type>(word_a + word_b);
+        const bool overflow = sum < word_a;
+        sum = static_cast<word_type>(sum + carry);
+        carry = (overflow || sum < carry) ? word_type{1U} : word_type{0U};
+
+        if constexpr (top_bits > 0)
+        {
+            if (i == I::word_count() - 1)
+            {
+                // the carry out of a partially used word is the bit just above its used bits
+                carry = static_cast<word_type>((sum >> top_bits) & 1U);
+            }
+        }
+        a.set_word(i, sum);
+    }
+    return carry != 0U;
+}
 
+/**
+ * @brief Subtracts an integer from another integer in-place
+ *
+ * In contrast to `sub`, no temporary integers are created. The subtrahend may be narrower than
+ * the target, it is then (sign-)extended on the fly. The difference is computed modulo
+ * 2^I::width().
+ *
+ * @tparam I The integer type of the target
+ * @tparam T The integer type of the subtrahend
+ * @param a The minuend, overwritten with the difference
+ * @param b The subtrahend
+ * @return The borrow out of the most significant bit
+ */
+template <typename I, typename T> constexpr bool sub_inplace(I& a, const T& b)
+{
     static_assert(::aarith::is_integral_v<I>);
     static_assert(::aarith::is_integral_v<T>);
     static_assert(::aarith::same_signedness<I, T>);
+    static_assert(::aarith::same_word_type<I, T>);
+    static_assert(T::width() <= I::width(), "The subtrahend must not be wider than the target");
 
-    constexpr size_t res_width = std::max(I::width(), T::width()) + 1U;
+    using word_type = typename I::word_type;
+    constexpr size_t top_bits = I::width() % I::word_width();
+
+    if constexpr (std::is_same_v<I, T> && uses_limb_kernels<I::width(), word_type>())
+    {
+        if (use_limb_kernels())
+        {
+            const limb borrow = sub_limbs(a.data(), a.data(), b.data(), I::word_count());
+            if constexpr (top_bits > 0)
+            {
+                const limb top = a.word(I::word_count() - 1);
+                a.set_word(I::word_count() - 1, top);
+                return ((top >> top_bits) & 1U) != 0U;
+            }
+            return borrow != 0U;
+        }
+    }
 
-    auto a_ = width_cast<res_width>(a);
-    auto b_ = width_cast<res_width>(b);
+    word_type borrow{0U};
+    for (size_t i = 0; i < I::word_count(); ++i)
+    {
+        const word_type word_a = a.word(i);
+        // the (sign-)extension must not reach beyond the width of the target
+        const auto word_b = static_cast<word_type>(extended_word(b, i) & I::word_mask(i));
 
-    using word_type = typename decltype(a_)::word_type; // weird but works O_0
+        auto difference = static_cast<word_type>(word_a - word_b);
+        const bool underflow = word_a < word_b;
+        const bool borrow_underflow = difference < borrow;
+        difference = static_cast<word_type>(difference - borrow);
+        borrow = (underflow || borrow_underflow) ? word_type{1U} : word_type{0U};
 
-    decltype(a_) sum{0U};
+        if constexpr (top_bits > 0)
+        {
+            if (i == I::word_count() - 1)
+            {
+                borrow = static_cast<word_type>((difference >> top_bits) & 1U);
+            }
+        }
+        a.set_word(i, difference);
+    }
+    return borrow != 0U;
+}
 
-    word_type carry = initial_carry ? word_type{1U} : word_type{0U};
+/**
+ * @brief Adds the product of two integers to an accumulator in-place
+ *
+ * Computes `acc += a * b` modulo 2^I::width() using word-by-word multiplication without creating
+ * any temporary integers. As the result is computed modulo 2^I::width(), the same computation
+ * is correct for unsigned and (two's complement) signed integers. The factors may be narrower
+ * than the accumulator, they are then (sign-)extended on the fly.
+ *
+ * @tparam I The integer type of the accumulator
+ * @tparam A The integer type of the first factor
+ * @tparam B The integer type of the second factor
+ * @param acc The accumulator
+ * @param a The first factor
+ * @param b The second factor
+ */
+template <typename I, typename A, typename B>
+constexpr void mul_add_inplace(I& acc, const A& a, const B& b)
+{
+    static_assert(::aarith::is_integral_v<I>);
+    static_assert(::aarith::same_signedness<I, A> && ::aarith::same_signedness<I, B>);
+    static_assert(::aarith::same_word_type<I, A> && ::aarith::same_word_type<I, B>);
+    static_assert(A::width() <= I::width() && B::width() <= I::width(),
+                  "The factors must not be wider than the accumulator");
+
+    using word_type = typename I::word_type;
+    constexpr size_t count = I::word_count();
+
+    if constexpr (std::is_same_v<I, A> && std::is_same_v<I, B> &&
+                  uses_limb_kernels<I::width(), word_type>())
+    {
+        if (use_limb_kernels() && &acc != &a && &acc != &b)
+        {
+            mul_add_limbs(acc.data(), a.data(), b.data(), count);
+            acc.set_word(count - 1, acc.word(count - 1));
+            return;
+        }
+    }
+
+    // words of unsigned factors beyond their width are zero and can be skipped
+    constexpr size_t count_a = is_unsigned_v<A> ? A::word_count() : count;
+    constexpr size_t count_b = is_unsigned_v<B> ? B::word_count() : count;
 
-    for (auto i = 0U; i < sum.word_count(); ++i)
+    for (size_t i = 0; i < count_a; ++i)
     {
+        const word_type word_a = extended_word(a, i);
+        if (word_a == 0U)
+        {
+            continue;
+        }
 
-        word_type word_a{a_.word(i)};
-        word_type word_b{b_.word(i)};
+        word_type carry{0U};
+        const size_t last = std::min(count - i, count_b);
+        for (size_t j = 0; j < last; ++j)
+        {
+            const auto [high, low] = mul_word(word_a, extended_word(b, j));
+            const word_type current = acc.word(i + j);
 
-        word_type partial_sum = word_a + word_b;
-        word_type new_carry = (partial_sum < word_a || partial_sum < word_b) ? 1U : 0U;
-        partial_sum += carry;
-        carry = (new_carry || partial_sum < word_a || partial_sum < word_b) ? 1U : 0U;
-        sum.set_word(i, partial_sum);
+            auto sum = static_cast<word_type>(low + current);
+            word_type next_carry = static_cast<word_type>(high + (sum < low ? 1U : 0U));
+            sum = static_cast<word_type>(sum + carry);
+            next_carry = static_cast<word_type>(next_carry + (sum < carry ? 1U : 0U));
+
+            acc.set_word(i + j, sum);
+            carry = next_carry;
+        }
+        // propagate the carry into the remaining words of the accumulator
+        for (size_t k = i + last; k < count && carry != 0U; ++k)
+        {
+            const auto sum = static_cast<word_type>(acc.word(k) + carry);
+            carry = sum < carry ? word_type{1U} : word_type{0U};
+            acc.set_word(k, sum);
+        }
     }
+}
+
+/**
+ * @brief Adds two unsigned integers of, possibly, different bit widths.
+ *
+ * @tparam I Integer type of the first summand
+ * @tparam T Integer type of the second summand
+ * @param a First summand
+ * @param b Second summand
+ * @param initial_carry True if there is an initial carry coming in
+ * @return Sum of a and b with bit width max(I::width,T::width)+1
+ */
+template <typename I, typename T>
+[[nodiscard]] constexpr auto expanding_add(const I& a, const T& b, const bool initial_carry)
+{
+
+    static_assert(::aarith::is_integral_v<I>);
+    static_assert(::aarith::is_integral_v<T>);
+    static_assert(::aarith::same_signedness<I, T>);
+
+    constexpr size_t res_width = std::max(I::width(), T::width()) + 1U;
+
+    auto sum = width_cast<res_width>(a);
+    add_inplace(sum, b, initial_carry);
     return sum;
 }
 
@@ -76,8 +302,9 @@ template <typename I> [[nodiscard]] constexpr auto sub(const I& a, const I& b) -
     }
     else
     {
-        auto result = expanding_add(a, ~b, true);
-        return width_cast<W>(result);
+        I result{a};
+        sub_inplace(result, b);
+        return result;
     }
 }
 
@@ -128,54 +355,47 @@ template <typename I> [[nodiscard]] I constexpr add(const I& a, const I& b)
     }
     else
     {
-        const auto result = expanding_add<I, I>(a, b);
-        return width_cast<W>(result);
+        I result{a};
+        add_inplace(result, b);
+        return result;
     }
 }
 
 /**
  * @brief Multiplies two unsigned integers expanding the bit width so that the result fits.
  *
- * This implements the simplest multiplication algorithm (binary "long multiplication") that adds up
- * the partial products everywhere where the first multiplicand has a 1 bit. The simplicity, of
- * course, comes at the cost of performance.
+ * This implements the simplest multiplication algorithm ("long multiplication") that adds up the
+ * partial products of all pairs of words of the multiplicands (see `mul_add_inplace`).
  *
  * @tparam W The bit width of the first multiplicand
  * @tparam V The bit width of the second multiplicand
+ * @tparam E The exponent width if the multiplicands are floating-point mantissae (only used by the
+ * instrumentation)
+ * @tparam M The mantissa width if the multiplicands are floating-point mantissae (only used by the
+ * instrumentation)
  * @param a First multiplicand
  * @param b Second multiplicand
  * @return Product of a and b
  */
-template <std::size_t W, std::size_t V, typename WordType>
+template <std::size_t W, std::size_t V, typename WordType, std::size_t E = 0, std::size_t M = 0>
 [[nodiscard]] constexpr uinteger<W + V, WordType>
 schoolbook_expanding_mul(const uinteger<W, WordType>& a, const uinteger<V, WordType>& b)
 {
+    return instrumented<instrumentation::schoolbook_expanding_mul, W, E, M>([&]() {
+        constexpr std::size_t res_width = W + V;
+        uinteger<res_width, WordType> result{0U};
 
-    constexpr std::size_t res_width = W + V;
-    uinteger<res_width, WordType> result{0U};
-
-    if constexpr (res_width <= uinteger<W, WordType>::word_width())
-    {
-        auto result_uint = a.word(0) * b.word(0);
-        result.set_word(0, result_uint);
-    }
-    else
-    {
-        static_assert(::aarith::is_integral_v<uinteger<res_width, WordType>>);
-        static_assert(::aarith::is_unsigned_v<uinteger<res_width, WordType>>);
-
-        const auto leading_zeroes = V - count_leading_zeroes(b);
-        uinteger<res_width, WordType> a_ = width_cast<res_width>(a);
-
-        for (auto bit_index = 0U; bit_index < leading_zeroes; ++bit_index)
+        if constexpr (res_width <= uinteger<W, WordType>::word_width())
         {
-            if (b.bit(bit_index))
-            {
-                result = add(result, a_ << bit_index);
-            }
+            auto result_uint = a.word(0) * b.word(0);
+            result.set_word(0, result_uint);
         }
-    }
-    return result;
+        else
+        {
+            mul_add_inplace(result, a, b);
+        }
+        return result;
+    });
 }
 
 /**
@@ -206,27 +426,51 @@ template <typename I, typename = std::enable_if_t<is_integral_v<I> && is_unsigne
     }
     else
     {
-        return width_cast<W>(schoolbook_expanding_mul(a, b));
+        // only the partial products contributing to the lower W bits are computed
+        I result{};
+        mul_add_inplace(result, a, b);
+        return result;
     }
 }
 
 /**
- * @brief Multiplies two unsigned integers using the Karazuba algorithm expanding the bit width so
- * that the result fits.
- *
- * This implements the karazuba multiplication algorithm (divide and conquer).
+ * @brief Multiplies two wide unsigned integers using the Karazuba algorithm, the intermediate
+ * results are kept in the limb_arena of the calling thread
  *
- * @tparam W The bit width of the first multiplicant
- * @tparam V The bit width of the second multiplicant
- * @param a First multiplicant
- * @param b Second multiplicant
- * @return Product of a and b
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
  */
 template <std::size_t W, std::size_t V, typename WordType>
-[[nodiscard]] constexpr uinteger<W + V, WordType> expanding_karazuba(const uinteger<W, WordType>& a,
-                                                                     const uinteger<V, WordType>& b)
+[[nodiscard]] uinteger<W + V, WordType> arena_expanding_karazuba(const uinteger<W, WordType>& a,
+                                                                 const uinteger<V, WordType>& b)
 {
+    constexpr size_t n =
+        std::max(uinteger<W, WordType>::word_count(), uinteger<V, WordType>::word_count());
+
+    scratch_scope scratch;
+    const limb* a_ = scratch.copy(a.data(), a.word_count(), n);
+    const limb* b_ = scratch.copy(b.data(), b.word_count(), n);
+    limb* product = scratch.allocate(2 * n);
+    karazuba_limbs(product, a_, b_, n, scratch);
+
+    uinteger<W + V, WordType> result;
+    std::copy(product, product + result.word_count(), result.data());
+    return result;
+}
 
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] constexpr uinteger<W + V, WordType> expanding_karazuba(const uinteger<W, WordType>& a,
+                                                                     const uinteger<V, WordType>& b);
+
+/**
+ * @brief Multiplies two unsigned integers using the Karazuba algorithm keeping all intermediate
+ * results on the stack
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] constexpr uinteger<W + V, WordType>
+stack_expanding_karazuba(const uinteger<W, WordType>& a, const uinteger<V, WordType>& b)
+{
     constexpr std::size_t res_width = W + V;
     if constexpr (res_width <= uinteger<W, WordType>::word_width())
     {
@@ -277,9 +521,9 @@ template <std::size_t W, std::size_t V, typename WordType>
         }
 
         constexpr auto full_shift = 2 * karazuba_width;
-        const auto k1 = width_cast<res_width>(p1) << full_shift;
-        const auto k2 = width_cast<res_width>(expanding_sub(p3, expanding_add(p1, p2)))
-                        << karazuba_width;
+        const auto k1 = shl<full_shift>(width_cast<res_width>(p1));
+        const auto k2 =
+            shl<karazuba_width>(width_cast<res_width>(expanding_sub(p3, expanding_add(p1, p2))));
         const auto product = expanding_add(k1, expanding_add(k2, p2));
 
         return width_cast<res_width>(product);
@@ -298,29 +542,57 @@ template <std::size_t W, std::size_t V, typename WordType>
 }
 
 /**
- * @brief Implements the restoring division algorithm.
+ * @brief Multiplies two unsigned integers using the Karazuba algorithm expanding the bit width so
+ * that the result fits.
  *
- * @see https://en.wikipedia.org/wiki/Division_algorithm#Restoring_division
+ * This implements the karazuba multiplication algorithm (divide and conquer).
  *
- * @param numerator The number that is to be divided
- * @param denominator The number that divides the other number
- * @tparam W Width of the numbers used in division.
+ * For integers of 64-bit words, narrow products are computed using the schoolbook method and
+ * the intermediate results of wide products (@see arena_scratch_threshold) are kept in the
+ * limb_arena of the calling thread instead of on the stack.
  *
- * @return Pair of (quotient, remainder)
+ * @tparam W The bit width of the first multiplicant
+ * @tparam V The bit width of the second multiplicant
+ * @param a First multiplicant
+ * @param b Second multiplicant
+ * @return Product of a and b
+ */
+template <std::size_t W, std::size_t V, typename WordType>
+[[nodiscard]] constexpr uinteger<W + V, WordType> expanding_karazuba(const uinteger<W, WordType>& a,
+                                                                     const uinteger<V, WordType>& b)
+{
+    if constexpr (std::is_same_v<WordType, limb>)
+    {
+        if constexpr (uses_limb_arena<W + V, WordType>())
+        {
+            if (use_limb_kernels())
+            {
+                return arena_expanding_karazuba(a, b);
+            }
+        }
+        // below the threshold, the word-by-word product is faster than the recursion (and does
+        // not instantiate the templates of all intermediate widths)
+        return schoolbook_expanding_mul(a, b);
+    }
+    else
+    {
+        return stack_expanding_karazuba(a, b);
+    }
+}
+
+/**
+ * @brief Implements the restoring division algorithm keeping all intermediate results on the stack
  *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
  */
 template <std::size_t W, std::size_t V, typename WordType>
 [[nodiscard]] constexpr std::pair<uinteger<W, WordType>, uinteger<W, WordType>>
-restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, WordType>& denominator)
+stack_restoring_division(const uinteger<W, WordType>& numerator,
+                         const uinteger<V, WordType>& denominator)
 {
     using UInteger = uinteger<W, WordType>;
     using LargeUInteger = uinteger<2 * W, WordType>;
 
-    if (denominator.is_zero())
-    {
-        throw std::runtime_error("Attempted division by zero");
-    }
-
     // Cover some special cases in order to speed everything up
     if (numerator == denominator)
     {
@@ -348,17 +620,12 @@ restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, Wor
     for (size_t i = 0; i < n; ++i)
     {
         const auto bit = (n - 1) - i;
-        const LargeUInteger TwoR = (R << 1);
-        if (TwoR >= D)
+        R <<= 1;
+        if (R >= D)
         {
-            R = sub(TwoR, D);
+            sub_inplace(R, D);
             Q.set_bit(bit, true);
         }
-        else
-        {
-            R = TwoR;
-            Q.set_bit(bit, false);
-        }
     }
 
     const uinteger<W, WordType> remainder_ = width_cast<W>(R >> n);
@@ -366,6 +633,61 @@ restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, Wor
     return std::make_pair(Q, remainder_);
 }
 
+/**
+ * @brief Implements the restoring division algorithm.
+ *
+ * @see https://en.wikipedia.org/wiki/Division_algorithm#Restoring_division
+ *
+ * For integers of 64-bit words, the division is performed in place by the divide_limbs kernel
+ * instead of keeping double-width intermediate results on the stack.
+ *
+ * @param numerator The number that is to be divided
+ * @param denominator The number that divides the other number
+ * @tparam W Width of the numbers used in division.
+ * @tparam E The exponent width if the operands are floating-point mantissae (only used by the
+ * instrumentation)
+ * @tparam M The mantissa width if the operands are floating-point mantissae (only used by the
+ * instrumentation)
+ *
+ * @return Pair of (quotient, remainder)
+ *
+ */
+template <std::size_t W, std::size_t V, typename WordType, std::size_t E = 0, std::size_t M = 0>
+[[nodiscard]] constexpr std::pair<uinteger<W, WordType>, uinteger<W, WordType>>
+restoring_division(const uinteger<W, WordType>& numerator, const uinteger<V, WordType>& denominator)
+{
+    if (denominator.is_zero())
+    {
+        throw std::runtime_error("Attempted division by zero");
+    }
+
+    return instrumented<instrumentation::restoring_division, W, E, M>([&]() {
+        if constexpr (std::is_same_v<WordType, limb> && V <= W)
+        {
+            if (use_limb_kernels())
+            {
+                std::pair<uinteger<W, WordType>, uinteger<W, WordType>> result;
+                if constexpr (uses_limb_arena<W, WordType>())
+                {
+                    scratch_scope scratch;
+                    const limb* d = scratch.copy(denominator.data(), denominator.word_count(),
+                                                 numerator.word_count());
+                    divide_limbs(result.first.data(), result.second.data(), numerator.data(), d,
+                                 W);
+                }
+                else
+                {
+                    const auto d = width_cast<W>(denominator);
+                    divide_limbs(result.first.data(), result.second.data(), numerator.data(),
+                                 d.data(), W);
+                }
+                return result;
+            }
+        }
+        return stack_restoring_division(numerator, denominator);
+    });
+}
+
 /**
  * @brief Computes the remainder of the division of one integer by another integer
  *
@@ -506,7 +828,7 @@ template <typename I>
  */
 template <size_t Width, typename WordType>
 auto constexpr operator>>=(integer<Width, WordType>& lhs, const size_t rhs)
-    -> integer<Width, WordType>
+    -> integer<Width, WordType>&
 {
     arithmetic_right_shift(lhs, rhs);
     return lhs;
@@ -550,8 +872,7 @@ auto constexpr operator>>(const integer<Width, WordType>& lhs, const U& rhs)
 
 template <typename I, typename = std::enable_if_t<is_integral_v<I>>> I& operator--(I& a)
 {
-    I val = sub(a, I::one());
-    a.set_bits(val);
+    sub_inplace(a, I::one());
     return a;
 }
 
@@ -564,8 +885,7 @@ template <typename I, typename = std::enable_if_t<is_integral_v<I>>> I operator-
 
 template <typename I, typename = std::enable_if_t<is_integral_v<I>>> I& operator++(I& a)
 {
-    I val = add(a, I::one());
-    a.set_bits(val);
+    add_inplace(a, I::one());
     return a;
 }
 
@@ -576,6 +896,45 @@ template <typename I, typename = std::enable_if_t<is_integral_v<I>>> I operator+
     return cpy;
 }
 
+/**
+ * @brief Shifts an integer to the left in-place
+ *
+ * @tparam I The integer type
+ * @param a The integer to be shifted
+ * @param shift The number of bits to shift
+ * @return Reference to the shifted integer
+ */
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& shift_left_inplace(I& a, const size_t shift)
+{
+    logical_left_shift(a, shift);
+    return a;
+}
+
+/**
+ * @brief Shifts an integer to the right in-place
+ *
+ * Signed integers are shifted arithmetically, unsigned integers logically.
+ *
+ * @tparam I The integer type
+ * @param a The integer to be shifted
+ * @param shift The number of bits to shift
+ * @return Reference to the shifted integer
+ */
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& shift_right_inplace(I& a, const size_t shift)
+{
+    if constexpr (is_unsigned_v<I>)
+    {
+        logical_right_shift(a, shift);
+    }
+    else
+    {
+        arithmetic_right_shift(a, shift);
+    }
+    return a;
+}
+
 /**
  * @brief Naively multiplies two signed integers.
  *
@@ -629,7 +988,10 @@ template <size_t W, typename WordType>
     }
     else
     {
-        return width_cast<W>(naive_expanding_mul(a, b));
+        // the lower W bits of the product are the same for signed and unsigned multiplication
+        I result{};
+        mul_add_inplace(result, a, b);
+        return result;
     }
 }
 
@@ -686,11 +1048,11 @@ template <size_t x, size_t y, typename WordType>
 
         if (snd_last_bit && !last_bit)
         {
-            P = add(P, S);
+            add_inplace(P, S);
         }
         if (!snd_last_bit && last_bit)
         {
-            P = add(P, A);
+            add_inplace(P, A);
         }
 
         const bool prefix_minus = P.msb();
@@ -786,11 +1148,11 @@ template <size_t x, size_t y, typename WordType>
 
         if (snd_last_bit && !last_bit)
         {
-            P = add(P, S);
+            add_inplace(P, S);
         }
         if (!snd_last_bit && last_bit)
         {
-            P = add(P, A);
+            add_inplace(P, A);
         }
 
         const bool prefix_minus = P.msb();
@@ -1108,6 +1470,50 @@ template <typename Integer>
     return (a <= b) ? sub(b, a) : sub(a, b);
 }
 
+/**
+ * @brief Anticipates the number of leading zeroes of the difference a-b.
+ *
+ * This is the leading-zero anticipator (LZA) used in the near path of floating-point adders: The
+ * position of the leading one of a-b is predicted from the operands alone, i.e. in hardware it
+ * can be computed in parallel to the actual subtraction. The prediction is either exact or one too
+ * small, so the normalization shift has to be corrected by at most one additional bit.
+ *
+ * @see Schmookler, Nowka: Leading Zero Anticipation and Detection -- A Comparison of Methods
+ *
+ * @note The result is only meaningful if a > b
+ *
+ * @tparam W The bit width of the operands
+ * @param a Minuend
+ * @param b Subtrahend
+ * @return The predicted number of leading zeroes of a-b
+ */
+template <size_t W, typename WordType>
+[[nodiscard]] constexpr size_t leading_zero_anticipation(const uinteger<W, WordType>& a,
+                                                         const uinteger<W, WordType>& b)
+{
+    using U = uinteger<W, WordType>;
+
+    // a-b is computed as a+~b+1, the indicator is built from the propagate (t), generate (g) and
+    // zero (z) signals of the operands a and ~b
+    const U b_inv = ~b;
+    const U t = a ^ b_inv;
+    const U g = a & b_inv;
+    const U z = ~(a | b_inv);
+
+    // neighbouring signals t[i+1], g[i-1] and z[i-1]: above the MSB the operands are 0 and 1 (i.e.
+    // propagate) and the carry-in below the LSB acts as a generate
+    U t_left = t >> 1;
+    t_left.set_msb(true);
+    U g_right = g << 1;
+    g_right.set_bit(0, true);
+    const U z_right = z << 1;
+
+    const U indicator = (t_left & ((g & ~z_right) | (z & ~g_right))) |
+                        (~t_left & ((z & ~z_right) | (g & ~g_right)));
+
+    return count_leading_zeroes(indicator);
+}
+
 /**
  * @brief Left-shift assignment operator
  * @tparam W The word_container type to work on
@@ -1117,7 +1523,7 @@ template <typename Integer>
  */
 template <typename W, typename I,
           typename = std::enable_if_t<is_word_array_v<W> && is_integral_v<I> && is_unsigned_v<I>>>
-constexpr auto operator>>=(W& lhs, const I rhs) -> W
+constexpr auto operator>>=(W& lhs, const I rhs) -> W&
 {
     const size_t shift = static_cast<size_t>(rhs);
     lhs >>= shift;
@@ -1184,6 +1590,44 @@ auto constexpr operator%(const I& lhs, const I& rhs) -> I
     return remainder(lhs, rhs);
 }
 
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& operator+=(I& lhs, const I& rhs)
+{
+    add_inplace(lhs, rhs);
+    return lhs;
+}
+
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& operator-=(I& lhs, const I& rhs)
+{
+    sub_inplace(lhs, rhs);
+    return lhs;
+}
+
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& operator*=(I& lhs, const I& rhs)
+{
+    // the product can not be accumulated into one of its factors
+    I product{};
+    mul_add_inplace(product, lhs, rhs);
+    lhs = product;
+    return lhs;
+}
+
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& operator/=(I& lhs, const I& rhs)
+{
+    lhs = div(lhs, rhs);
+    return lhs;
+}
+
+template <typename I, typename = std::enable_if_t<is_integral_v<I>>>
+constexpr I& operator%=(I& lhs, const I& rhs)
+{
+    lhs = remainder(lhs, rhs);
+    return lhs;
+}
+
 } // namespace integer_operators
 
 } // namespace aarith
@@ -1,58 +1,178 @@
 #pragma once
 
+#include <aarith/core/word_array_random_generation.hpp>
+
+#include <limits>
 #include <random>
 #include <stdexcept>
+#include <tuple>
 
 namespace aarith {
 
 /**
  * Implements random number generation interface similar to std::uniform_int_distribution.
+ *
+ * The numbers are distributed uniformly (without the bias of reducing a random number modulo the
+ * length of the interval) and no division is performed when generating a number:
+ *
+ *  - If the length of the interval is a power of two, the random bits are used directly.
+ *  - Otherwise, for up to 64 bits, Lemire's multiply-and-shift rejection is used.
+ *  - Otherwise, random numbers with as many bits as the interval length are drawn until one fits
+ *    into the interval. The most significant word is drawn (and compared) first, so most of the
+ *    rejected numbers are rejected without drawing their remaining words.
+ *
  * @note The interval returned is [min,max]
  */
 template <size_t BitWidth, typename WordType = uint64_t> class uniform_uinteger_distribution
 {
 public:
     using input_type = uinteger<BitWidth, WordType>;
-    using internal_type = uinteger<BitWidth + 1, WordType>;
+    using result_type = input_type;
 
     explicit uniform_uinteger_distribution(const input_type& min_ = input_type::min(),
                                            const input_type& max_ = input_type::max())
         : min(min_)
-        , max(add(internal_type{max_}, internal_type::one()))
-        , length(sub(max, min))
+        , range(sub(max_, min_))
     {
-        if (!(min <= max))
+        if (max_ < min_)
         {
             throw std::runtime_error("uniform_uinteger_distribution: a must be <= b");
         }
+
+        const size_t bits = BitWidth - count_leading_zeroes(range);
+        const size_t top_bits = bits % input_type::word_width();
+        words = (bits + input_type::word_width() - 1) / input_type::word_width();
+        top_mask = top_bits == 0 ? std::numeric_limits<WordType>::max()
+                                 : static_cast<WordType>((WordType{1} << top_bits) - 1U);
+
+        // the length of the interval is a power of two iff range + 1 has a single bit set
+        power_of_two = count_leading_zeroes(range) + count_trailing_ones() == BitWidth;
+
+        if constexpr (BitWidth <= 64)
+        {
+            if (!power_of_two)
+            {
+                length = to_native(range) + 1U;
+                // (2^64 - length) % length, the only division, performed once
+                threshold = (0U - length) % length;
+            }
+        }
     }
 
-    template <class Generator> auto operator()(Generator& g) -> input_type
+    template <class Generator> auto operator()(Generator& g) -> result_type
     {
-        internal_type uint;
-        for (auto i = 0U; i < uint.word_count(); ++i)
+        if (power_of_two)
+        {
+            input_type number;
+            fill(number, g);
+            return add(min, number);
+        }
+
+        if constexpr (BitWidth <= 64)
+        {
+            // the upper word of the product is uniformly distributed in [0, length) unless the
+            // lower word is below the threshold
+            auto [high, low] = mul_word(random_word<uint64_t>(g), length);
+            while (low < threshold)
+            {
+                std::tie(high, low) = mul_word(random_word<uint64_t>(g), length);
+            }
+            return add(min, from_native(high));
+        }
+        else
         {
-            uint.set_word(i, random_word(g));
+            const size_t top = words - 1;
+            const WordType range_top = range.word(top);
+            while (true)
+            {
+                const WordType top_word = random_word<WordType>(g) & top_mask;
+                if (top_word > range_top)
+                {
+                    continue;
+                }
+                input_type number;
+                number.set_word(top, top_word);
+                for (size_t i = 0; i < top; ++i)
+                {
+                    number.set_word(i, random_word<WordType>(g));
+                }
+                if (top_word < range_top || number <= range)
+                {
+                    return add(min, number);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Fills [first, last) with random numbers
+     */
+    template <class OutputIt, class Generator>
+    void generate(OutputIt first, OutputIt last, Generator& g)
+    {
+        for (; first != last; ++first)
+        {
+            *first = (*this)(g);
         }
-        // Modulo is slightly biased towards smaller numbers. Possible fix: e.g. use "Java's
-        // algorithm.
-        using namespace aarith::integer_operators; // NOLINT
-        //        std::cout << min << " + (" << uint << " % " << length << ") = " << min << " + "
-        //                  << (uint % length) << "\n";
-        return width_cast<BitWidth>(min + (uint % length));
     }
 
     void reset()
     {
-        random_word.reset();
     }
 
 private:
-    internal_type min;
-    internal_type max;
-    internal_type length;
-    std::uniform_int_distribution<WordType> random_word{std::numeric_limits<WordType>::min(),
-                                                        std::numeric_limits<WordType>::max()};
+    input_type min;
+    // max - min
+    input_type range;
+    // the number of words (and the mask of the most significant word) needed for range
+    size_t words{0};
+    WordType top_mask{0};
+    bool power_of_two{false};
+    // range + 1 and the rejection threshold for Lemire's method
+    uint64_t length{0};
+    uint64_t threshold{0};
+
+    template <class Generator> void fill(input_type& number, Generator& g) const
+    {
+        for (size_t i = 0; i < words; ++i)
+        {
+            number.set_word(i, random_word<WordType>(g));
+        }
+        if (words > 0)
+        {
+            number.set_word(words - 1, number.word(words - 1) & top_mask);
+        }
+    }
+
+    [[nodiscard]] size_t count_trailing_ones() const
+    {
+        size_t ones = 0;
+        while (ones < BitWidth && range.bit(ones))
+        {
+            ++ones;
+        }
+        return ones;
+    }
+
+    [[nodiscard]] static uint64_t to_native(const input_type& number)
+    {
+        uint64_t result = 0;
+        for (size_t i = 0; i < input_type::word_count(); ++i)
+        {
+            result |= static_cast<uint64_t>(number.word(i)) << (i * input_type::word_width());
+        }
+        return result;
+    }
+
+    [[nodiscard]] static input_type from_native(const uint64_t number)
+    {
+        input_type result;
+        for (size_t i = 0; i < input_type::word_count(); ++i)
+        {
+            result.set_word(i, static_cast<WordType>(number >> (i * input_type::word_width())));
+        }
+        return result;
+    }
 };
 
 /**
@@ -68,19 +188,26 @@ public:
         word_array<BitWidth, WordType> array;
         for (auto i = 0U; i < array.word_count(); ++i)
         {
-            array.set_word(i, random_word(g));
+            array.set_word(i, random_word<WordType>(g));
         }
         return result_type{array};
     }
 
-    virtual void reset()
+    /**
+     * @brief Fills [first, last) with random numbers
+     */
+    template <class OutputIt, class Generator>
+    void generate(OutputIt first, OutputIt last, Generator& g)
     {
-        random_word.reset();
+        for (; first != last; ++first)
+        {
+            *first = (*this)(g);
+        }
     }
 
-private:
-    std::uniform_int_distribution<WordType> random_word{std::numeric_limits<WordType>::min(),
-                                                        std::numeric_limits<WordType>::max()};
+    virtual void reset()
+    {
+    }
 };
 
 } // namespace aarith
@@ -1,178 +1,384 @@
 #pragma once
 
-#include <optional>
-
+#include <aarith/core/thread_pool.hpp>
+#include <aarith/integer/integer_comparisons.hpp>
+#include <aarith/integer/integer_operations.hpp>
 #include <aarith/integer/integers.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace aarith {
 
+/**
+ * @brief The integers start, start + stride, start + 2 stride, ... that are not greater than end
+ *
+ * The range is random-access: the element at a position is computed directly from the position
+ * (instead of repeatedly adding the stride), so the range works with the (parallel) standard
+ * algorithms and can be split into subranges that are iterated independently (@see split).
+ *
+ * The reverse iteration starts at end and subtracts the stride, i.e., if the stride does not divide
+ * end - start, it produces different elements than the forward iteration.
+ *
+ * @tparam Integer The (unsigned) integer type of the elements
+ */
 template <typename Integer> class integer_range
 {
-    const Integer start_;
-    const Integer end_;
-    const Integer stride_;
+    static_assert(::aarith::is_integral_v<Integer>);
 
-    template <typename I, bool IsForwardIterator = true> class integer_iter
-    {
+    using word_type = typename Integer::word_type;
 
-        std::optional<I> current;
-        const integer_range<I> range;
+public:
+    /**
+     * @brief Whether the positions in the range are native integers
+     *
+     * A range of integers of up to 62 bits has at most 2^62 elements, i.e., the positions of its
+     * elements and the distances between its iterators fit into native integers.
+     */
+    static constexpr bool native_positions = Integer::width() <= 62;
+
+    /**
+     * @brief The type of the positions of the elements (and the size of the range)
+     *
+     * As the full range has 2^W elements, the positions need one more bit than the integers.
+     */
+    using size_type = std::conditional_t<native_positions, uint64_t,
+                                         uinteger<Integer::width() + 1, word_type>>;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Integer;
 
+    /**
+     * @brief Random-access iterator over the elements of the range
+     *
+     * The iterator refers to its range, i.e., the range has to outlive the iterator.
+     *
+     * @note The iterator returns the elements by value, i.e., strictly speaking, it only meets the
+     * requirements of a legacy input iterator. It is tagged as random-access iterator as the
+     * standard library (libstdc++ in particular) dispatches its algorithms, including the parallel
+     * ones, on the tag without relying on references to the elements. For C++20, iterator_concept
+     * marks it as a (non-legacy) random-access iterator.
+     */
+    class iterator
+    {
     public:
-        using value_type = I;
-        using reference = I;
-        using iterator_category = std::input_iterator_tag;
-        using pointer = I*;
-        using difference_type = void;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = Integer;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Integer*;
+        using reference = Integer;
 
-        integer_iter<I, IsForwardIterator>(const I current, const integer_range<I> range)
-            : current(current)
-            , range(range)
+        iterator() = default;
+
+        /**
+         * @param range The range to iterate
+         * @param position The position of the iterator
+         * @param origin The bits of the element at position zero
+         */
+        iterator(const integer_range* range, const size_type& position, const size_type& origin)
+            : range(range)
+            , position(position)
+            , origin(origin)
         {
+            if constexpr (!native_positions)
+            {
+                value = range->value_at(origin, position);
+            }
         }
 
-        explicit integer_iter<I, IsForwardIterator>(const integer_range<I> rg)
-            : current(std::nullopt)
-            , range(rg)
+        Integer operator*() const
         {
+            if constexpr (native_positions)
+            {
+                return range->value_at(origin, position);
+            }
+            else
+            {
+                return value;
+            }
         }
 
-        I operator*() const
+        Integer operator[](const difference_type n) const
         {
-            return *current;
+            return *(*this + n);
         }
-        I* operator->() const
+
+        iterator& operator++()
         {
-            return &(*current);
+            if constexpr (native_positions)
+            {
+                ++position;
+            }
+            else
+            {
+                // wide integers are not recomputed from the position, the stride is added instead
+                add_inplace(position, size_type::one());
+                add_inplace(value, range->stride_);
+            }
+            return *this;
         }
 
-        integer_iter& operator++()
-        { // preincrement
-            if constexpr (IsForwardIterator)
-            {
-                if (current == range.end_)
-                {
-                    current = std::nullopt;
-                }
-                else if (current)
-                {
-                    const I curr = *current;
-                    const I stride = range.stride_;
-                    const I new_val = add(curr, stride);
+        iterator operator++(int)
+        {
+            iterator previous{*this};
+            ++*this;
+            return previous;
+        }
 
-                    const bool no_overflow = new_val > curr;
-                    const bool far_enough_away = new_val <= range.end_;
-                    if (no_overflow && far_enough_away)
-                    {
-                        current = new_val;
-                    }
-                    else
-                    {
-                        current = std::nullopt;
-                    }
-                }
+        iterator& operator--()
+        {
+            if constexpr (native_positions)
+            {
+                --position;
             }
             else
             {
-                if (current == range.start_)
-                {
-                    current = std::nullopt;
-                }
-                else if (current)
-                {
-                    const I curr = *current;
-                    const I stride = range.stride_;
-                    const I new_val = sub(curr, stride);
-
-                    const bool no_underflow = new_val < curr;
-                    const bool far_enough_away = new_val >= range.start_;
-                    if (no_underflow && far_enough_away)
-                    {
-                        current = new_val;
-                    }
-                    else
-                    {
-                        current = std::nullopt;
-                    }
-                }
+                sub_inplace(position, size_type::one());
+                sub_inplace(value, range->stride_);
             }
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator previous{*this};
+            --*this;
+            return previous;
+        }
 
+        iterator& operator+=(const difference_type n)
+        {
+            if constexpr (native_positions)
+            {
+                position = static_cast<size_type>(static_cast<difference_type>(position) + n);
+            }
+            else
+            {
+                const auto distance = from_native<size_type>(
+                    static_cast<uint64_t>(n < 0 ? -static_cast<uint64_t>(n) : n));
+                position = n < 0 ? sub(position, distance) : add(position, distance);
+                value = range->value_at(origin, position);
+            }
             return *this;
         }
 
-        friend bool operator==(integer_iter<I, IsForwardIterator> const& lhs,
-                               integer_iter<I, IsForwardIterator> const& rhs)
+        iterator& operator-=(const difference_type n)
+        {
+            return *this += -n;
+        }
+
+        friend iterator operator+(iterator it, const difference_type n)
         {
-            return (lhs.current == rhs.current) && (lhs.range == rhs.range);
+            return it += n;
         }
-        friend bool operator!=(integer_iter<I, IsForwardIterator> const& lhs,
-                               integer_iter<I, IsForwardIterator> const& rhs)
+
+        friend iterator operator+(const difference_type n, iterator it)
+        {
+            return it += n;
+        }
+
+        friend iterator operator-(iterator it, const difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.distance_from(rhs);
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.position == rhs.position;
+        }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs)
         {
             return !(lhs == rhs);
         }
+        friend bool operator<(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.position < rhs.position;
+        }
+        friend bool operator>(const iterator& lhs, const iterator& rhs)
+        {
+            return rhs < lhs;
+        }
+        friend bool operator<=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(rhs < lhs);
+        }
+        friend bool operator>=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+    private:
+        const integer_range* range{nullptr};
+        size_type position{};
+        size_type origin{};
+        // the current element of ranges of wide integers
+        Integer value{};
+
+        [[nodiscard]] difference_type distance_from(const iterator& other) const
+        {
+            if constexpr (native_positions)
+            {
+                return static_cast<difference_type>(position) -
+                       static_cast<difference_type>(other.position);
+            }
+            else
+            {
+                const bool negative = position < other.position;
+                const size_type distance =
+                    negative ? sub(other.position, position) : sub(position, other.position);
+                const auto magnitude = static_cast<difference_type>(to_native(distance));
+                return negative ? -magnitude : magnitude;
+            }
+        }
     };
 
-public:
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
     explicit integer_range(const Integer start = Integer::min(), const Integer end = Integer::max(),
-                  const Integer stride = Integer::one())
+                           const Integer stride = Integer::one())
         : start_(start)
         , end_(end)
         , stride_(stride)
     {
-        static_assert(::aarith::is_integral_v<Integer>);
-
         if (stride_ <= Integer::zero())
         {
             throw std::invalid_argument("Stride must be positive");
         }
+
+        start_bits = to_bits(start_);
+        stride_bits = to_bits(stride_);
+        if (start_ <= end_)
+        {
+            // the distance is computed modulo 2^W, it is the correct distance for signed integers
+            const size_type distance = truncate(subtract(to_bits(end_), start_bits));
+            if constexpr (native_positions)
+            {
+                size_ = distance / stride_bits + 1U;
+            }
+            else
+            {
+                size_ = add(div(distance, stride_bits), size_type::one());
+            }
+        }
     }
 
-    [[nodiscard]] integer_iter<Integer> begin() const
+    /**
+     * @brief Returns the number of elements in the range
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == size_type{0U};
+    }
+
+    /**
+     * @brief Returns the element at the given position
+     */
+    [[nodiscard]] Integer operator[](const size_type& position) const
+    {
+        return value_at(start_bits, position);
+    }
+
+    [[nodiscard]] iterator begin() const
     {
         return cbegin();
     }
 
-    [[nodiscard]] integer_iter<Integer> end() const
+    [[nodiscard]] iterator end() const
     {
         return cend();
     }
 
-    [[nodiscard]] integer_iter<Integer> cbegin() const
+    [[nodiscard]] iterator cbegin() const
     {
-        if (start_ > end_)
-        {
-            return cend();
-        }
-        return integer_iter<Integer>(start_, *this);
+        return iterator(this, size_type{0U}, start_bits);
     }
 
-    [[nodiscard]] integer_iter<Integer> cend() const
+    [[nodiscard]] iterator cend() const
     {
-        return integer_iter<Integer>(*this);
+        return iterator(this, size_, start_bits);
     }
 
-    [[nodiscard]] integer_iter<Integer, false> rbegin() const
+    [[nodiscard]] reverse_iterator rbegin() const
     {
         return crbegin();
     }
 
-    [[nodiscard]] integer_iter<Integer, false> rend() const
+    [[nodiscard]] reverse_iterator rend() const
     {
         return crend();
     }
 
-    [[nodiscard]] integer_iter<Integer, false> crbegin() const
+    [[nodiscard]] reverse_iterator crbegin() const
     {
-        if (start_ > end_)
-        {
-            return crend();
-        }
-        return integer_iter<Integer, false>(end_, *this);
+        return reverse_iterator(iterator(this, size_, reverse_origin()));
     }
 
-    [[nodiscard]] integer_iter<Integer, false> crend() const
+    [[nodiscard]] reverse_iterator crend() const
     {
-        return integer_iter<Integer, false>(*this);
+        return reverse_iterator(iterator(this, size_type{0U}, reverse_origin()));
+    }
+
+    /**
+     * @brief Splits the range into consecutive subranges of (almost) equal size
+     *
+     * The subranges can be iterated independently, e.g., by the threads of a thread_pool (@see
+     * parallel_for_each).
+     *
+     * @param parts The number of subranges, fewer subranges are returned if the range has fewer
+     * elements
+     * @return The non-empty subranges in ascending order
+     */
+    [[nodiscard]] std::vector<integer_range> split(const size_t parts) const
+    {
+        if (parts == 0)
+        {
+            throw std::invalid_argument("A range can not be split into zero parts");
+        }
+
+        std::vector<integer_range> result;
+        const size_type requested = from_native<size_type>(parts);
+        const size_type count = size_ < requested ? size_ : requested;
+        if (count == size_type{0U})
+        {
+            return result;
+        }
+
+        const size_type chunk = divide(size_, count);
+        const size_type larger = subtract(size_, multiply(chunk, count));
+
+        // count does not exceed parts, so it is a native integer
+        const size_t subranges = static_cast<size_t>(to_native(count));
+        size_type first{0U};
+        for (size_t i = 0; i < subranges; ++i)
+        {
+            const size_type length =
+                from_native<size_type>(i) < larger ? increment(chunk) : chunk;
+            const size_type next = add_positions(first, length);
+            result.emplace_back(value_at(start_bits, first),
+                                value_at(start_bits, subtract(next, size_type{1U})), stride_);
+            first = next;
+        }
+        return result;
     }
 
     friend bool operator==(integer_range<Integer> const& lhs, integer_range<Integer> const& rhs)
@@ -184,6 +390,584 @@ public:
     {
         return !(lhs == rhs);
     }
+
+private:
+    Integer start_;
+    Integer end_;
+    Integer stride_;
+
+    size_type start_bits{};
+    size_type stride_bits{};
+    size_type size_{};
+
+    [[nodiscard]] Integer value_at(const size_type& origin, const size_type& position) const
+    {
+        return from_bits(add_positions(origin, multiply(position, stride_bits)));
+    }
+
+    /**
+     * Returns the bits of the origin of the reverse iteration: it starts at end (which is not
+     * necessarily an element of the range if the stride does not divide end - start)
+     */
+    [[nodiscard]] size_type reverse_origin() const
+    {
+        if (empty())
+        {
+            return start_bits;
+        }
+        return subtract(to_bits(end_),
+                        multiply(subtract(size_, size_type{1U}), stride_bits));
+    }
+
+    /**
+     * Returns the bits of an integer as (unsigned) position
+     */
+    [[nodiscard]] static size_type to_bits(const Integer& value)
+    {
+        size_type result{};
+        for (size_t i = 0; i < Integer::word_count(); ++i)
+        {
+            if constexpr (native_positions)
+            {
+                result |= static_cast<uint64_t>(value.word(i)) << (i * Integer::word_width());
+            }
+            else
+            {
+                result.set_word(i, value.word(i));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Returns the integer consisting of the lower bits of a position
+     */
+    [[nodiscard]] static Integer from_bits(const size_type& bits)
+    {
+        Integer result{};
+        for (size_t i = 0; i < Integer::word_count(); ++i)
+        {
+            if constexpr (native_positions)
+            {
+                result.set_word(i, static_cast<word_type>(bits >> (i * Integer::word_width())));
+            }
+            else
+            {
+                result.set_word(i, bits.word(i));
+            }
+        }
+        return result;
+    }
+
+    template <typename T> [[nodiscard]] static T from_native(const uint64_t n)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return static_cast<T>(n);
+        }
+        else
+        {
+            T result{};
+            for (size_t i = 0; i < T::word_count() && i * T::word_width() < 64; ++i)
+            {
+                result.set_word(i, static_cast<word_type>(n >> (i * T::word_width())));
+            }
+            return result;
+        }
+    }
+
+    [[nodiscard]] static uint64_t to_native(const size_type& n)
+    {
+        if constexpr (native_positions)
+        {
+            return n;
+        }
+        else
+        {
+            if (count_leading_zeroes(n) < size_type::width() - 63)
+            {
+                throw std::out_of_range("The distance of the iterators is too large");
+            }
+            uint64_t result = 0;
+            for (size_t i = 0; i < size_type::word_count() && i * size_type::word_width() < 64;
+                 ++i)
+            {
+                result |= static_cast<uint64_t>(n.word(i)) << (i * size_type::word_width());
+            }
+            return result;
+        }
+    }
+
+    /**
+     * Clears the bits of a position beyond the width of the integers
+     */
+    [[nodiscard]] static size_type truncate(size_type n)
+    {
+        if constexpr (native_positions)
+        {
+            return n & ((uint64_t{1} << Integer::width()) - 1U);
+        }
+        else
+        {
+            n.set_bit(Integer::width(), false);
+            return n;
+        }
+    }
+
+    [[nodiscard]] static size_type add_positions(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a + b;
+        }
+        else
+        {
+            return add(a, b);
+        }
+    }
+
+    [[nodiscard]] static size_type increment(const size_type& a)
+    {
+        return add_positions(a, size_type{1U});
+    }
+
+    [[nodiscard]] static size_type subtract(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a - b;
+        }
+        else
+        {
+            return sub(a, b);
+        }
+    }
+
+    [[nodiscard]] static size_type multiply(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a * b;
+        }
+        else
+        {
+            return mul(a, b);
+        }
+    }
+
+    [[nodiscard]] static size_type divide(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a / b;
+        }
+        else
+        {
+            return div(a, b);
+        }
+    }
 };
 
+/**
+ * @brief The cartesian product of integer ranges
+ *
+ * The elements are the tuples (a, b, ...) with a from the first range, b from the second range and
+ * so on. The last range varies fastest, i.e., iterating the product is equivalent to nested loops
+ * over the ranges (with the first range in the outermost loop). Like integer_range, the product is
+ * random-access and can be split into subranges.
+ *
+ * @note The product is restricted to ranges with native positions. Like for integer_range, the
+ * distance of two iterators has to fit into a std::ptrdiff_t (otherwise, computing it throws an
+ * std::out_of_range exception).
+ *
+ * @tparam Integers The integer types of the ranges
+ */
+template <typename... Integers> class cartesian_range
+{
+    static_assert(sizeof...(Integers) > 0);
+    static_assert((integer_range<Integers>::native_positions && ...),
+                  "Cartesian products are only supported for integers of up to 62 bits");
+
+    /**
+     * The product of the ranges has at most 2^(sum of the widths) elements, so the positions need
+     * one more bit than the integers together
+     */
+    static constexpr size_t position_width = (Integers::width() + ...) + 1;
+
+public:
+    /**
+     * @brief Whether the positions in the product are native integers
+     */
+    static constexpr bool native_positions = position_width <= 63;
+
+    /**
+     * @brief The type of the positions of the elements (and the size of the product)
+     */
+    using size_type = std::conditional_t<native_positions, uint64_t, uinteger<position_width>>;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<Integers...>;
+
+    /**
+     * @brief Random-access iterator over the elements of the product
+     *
+     * The iterator refers to its range, i.e., the range has to outlive the iterator.
+     *
+     * @note Like the iterator of integer_range, the iterator returns the elements by value but is
+     * tagged as random-access iterator (@see integer_range::iterator).
+     */
+    class iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = std::tuple<Integers...>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = value_type;
+
+        iterator() = default;
+
+        iterator(const cartesian_range* range, const size_type& position)
+            : range(range)
+            , position(position)
+        {
+        }
+
+        value_type operator*() const
+        {
+            return (*range)[position];
+        }
+
+        value_type operator[](const difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        iterator& operator++()
+        {
+            position = add_positions(position, size_type{1U});
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous{*this};
+            ++*this;
+            return previous;
+        }
+
+        iterator& operator--()
+        {
+            position = subtract(position, size_type{1U});
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator previous{*this};
+            --*this;
+            return previous;
+        }
+
+        iterator& operator+=(const difference_type n)
+        {
+            if constexpr (native_positions)
+            {
+                position = static_cast<size_type>(static_cast<difference_type>(position) + n);
+            }
+            else
+            {
+                const size_type distance{
+                    static_cast<uint64_t>(n < 0 ? -static_cast<uint64_t>(n) : n)};
+                position = n < 0 ? subtract(position, distance) : add_positions(position, distance);
+            }
+            return *this;
+        }
+
+        iterator& operator-=(const difference_type n)
+        {
+            return *this += -n;
+        }
+
+        friend iterator operator+(iterator it, const difference_type n)
+        {
+            return it += n;
+        }
+
+        friend iterator operator+(const difference_type n, iterator it)
+        {
+            return it += n;
+        }
+
+        friend iterator operator-(iterator it, const difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.distance_from(rhs);
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.position == rhs.position;
+        }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator<(const iterator& lhs, const iterator& rhs)
+        {
+            return lhs.position < rhs.position;
+        }
+        friend bool operator>(const iterator& lhs, const iterator& rhs)
+        {
+            return rhs < lhs;
+        }
+        friend bool operator<=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(rhs < lhs);
+        }
+        friend bool operator>=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+    private:
+        const cartesian_range* range{nullptr};
+        size_type position{0U};
+
+        [[nodiscard]] difference_type distance_from(const iterator& other) const
+        {
+            if constexpr (native_positions)
+            {
+                return static_cast<difference_type>(position) -
+                       static_cast<difference_type>(other.position);
+            }
+            else
+            {
+                const bool negative = position < other.position;
+                const size_type distance = negative ? subtract(other.position, position)
+                                                    : subtract(position, other.position);
+                const auto magnitude = static_cast<difference_type>(to_native(distance));
+                return negative ? -magnitude : magnitude;
+            }
+        }
+    };
+
+    using const_iterator = iterator;
+
+    explicit cartesian_range(const integer_range<Integers>&... ranges)
+        : ranges(ranges...)
+    {
+        // the product fits into the positions, so it cannot overflow
+        size_type total{1U};
+        for (const uint64_t size : {ranges.size()...})
+        {
+            total = multiply(total, size_type{size});
+        }
+        last = total;
+    }
+
+    /**
+     * @brief Returns the number of elements in the product
+     */
+    [[nodiscard]] size_type size() const
+    {
+        return subtract(last, first);
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return first == last;
+    }
+
+    /**
+     * @brief Returns the element at the given position
+     */
+    [[nodiscard]] value_type operator[](const size_type& position) const
+    {
+        value_type result;
+        decode(add_positions(first, position), result);
+        return result;
+    }
+
+    [[nodiscard]] iterator begin() const
+    {
+        return iterator(this, size_type{0U});
+    }
+
+    [[nodiscard]] iterator end() const
+    {
+        return iterator(this, size());
+    }
+
+    [[nodiscard]] iterator cbegin() const
+    {
+        return begin();
+    }
+
+    [[nodiscard]] iterator cend() const
+    {
+        return end();
+    }
+
+    /**
+     * @brief Splits the product into consecutive subranges of (almost) equal size
+     *
+     * @param parts The number of subranges, fewer subranges are returned if the product has fewer
+     * elements
+     * @return The non-empty subranges in ascending order
+     */
+    [[nodiscard]] std::vector<cartesian_range> split(const size_t parts) const
+    {
+        if (parts == 0)
+        {
+            throw std::invalid_argument("A range can not be split into zero parts");
+        }
+
+        std::vector<cartesian_range> result;
+        const size_type requested{static_cast<uint64_t>(parts)};
+        const size_type count = size() < requested ? size() : requested;
+        if (count == size_type{0U})
+        {
+            return result;
+        }
+
+        const auto [chunk, larger] = divide(size(), count);
+        // count does not exceed parts, so it is a native integer
+        const size_t subranges = static_cast<size_t>(to_native(count));
+        size_type begin = first;
+        for (size_t i = 0; i < subranges; ++i)
+        {
+            const size_type index{static_cast<uint64_t>(i)};
+            const size_type length =
+                index < larger ? add_positions(chunk, size_type{1U}) : chunk;
+            const size_type next = add_positions(begin, length);
+            result.push_back(cartesian_range(ranges, begin, next));
+            begin = next;
+        }
+        return result;
+    }
+
+private:
+    std::tuple<integer_range<Integers>...> ranges;
+    // the subrange of the (linearized) product
+    size_type first{0U};
+    size_type last{0U};
+
+    cartesian_range(const std::tuple<integer_range<Integers>...>& ranges, const size_type& first,
+                    const size_type& last)
+        : ranges(ranges)
+        , first(first)
+        , last(last)
+    {
+    }
+
+    template <size_t K = sizeof...(Integers)>
+    void decode(const size_type& position, value_type& result) const
+    {
+        if constexpr (K > 0)
+        {
+            const auto& range = std::get<K - 1>(ranges);
+            const auto [quotient, index] = divide(position, size_type{range.size()});
+            std::get<K - 1>(result) = range[to_native(index)];
+            decode<K - 1>(quotient, result);
+        }
+    }
+
+    [[nodiscard]] static uint64_t to_native(const size_type& n)
+    {
+        if constexpr (native_positions)
+        {
+            return n;
+        }
+        else
+        {
+            if (count_leading_zeroes(n) < size_type::width() - 63)
+            {
+                throw std::out_of_range("The distance of the iterators is too large");
+            }
+            return n.word(0);
+        }
+    }
+
+    [[nodiscard]] static size_type add_positions(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a + b;
+        }
+        else
+        {
+            return add(a, b);
+        }
+    }
+
+    [[nodiscard]] static size_type subtract(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a - b;
+        }
+        else
+        {
+            return sub(a, b);
+        }
+    }
+
+    [[nodiscard]] static size_type multiply(const size_type& a, const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return a * b;
+        }
+        else
+        {
+            return mul(a, b);
+        }
+    }
+
+    /**
+     * Returns the quotient and the remainder (the divisor must not be zero)
+     */
+    [[nodiscard]] static std::pair<size_type, size_type> divide(const size_type& a,
+                                                                const size_type& b)
+    {
+        if constexpr (native_positions)
+        {
+            return {a / b, a % b};
+        }
+        else
+        {
+            return restoring_division(a, b);
+        }
+    }
+};
+
+/**
+ * @brief Calls a function for all elements of a range using the threads of a pool
+ *
+ * The range is split into several chunks per thread that are distributed dynamically between the
+ * threads. The function is called concurrently and must be thread-safe.
+ *
+ * @param pool The threads to use
+ * @param range The range (an integer_range or a cartesian_range)
+ * @param f The function to call for every element
+ * @param chunks_per_thread The number of chunks per thread (more chunks balance the load better)
+ */
+template <typename Range, class Function>
+void parallel_for_each(thread_pool& pool, const Range& range, Function f,
+                       const size_t chunks_per_thread = 8)
+{
+    const auto chunks = range.split(pool.size() * chunks_per_thread);
+    pool.parallel_for(chunks.size(), [&](const size_t i) {
+        for (const auto& element : chunks[i])
+        {
+            f(element);
+        }
+    });
+}
+
 } // namespace aarith
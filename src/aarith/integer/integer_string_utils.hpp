@@ -1,6 +1,7 @@
 #pragma once
 
 #include <aarith/core/core_string_utils.hpp>
+#include <aarith/core/limb_arena.hpp>
 
 namespace aarith {
 
@@ -16,8 +17,8 @@ auto to_base_2n(const uinteger<Width, WordType>& value)
     std::string result;
     for (auto i = digit_count; i > 0; --i)
     {
-        auto const bits = value.template bits<N>((i - 1) * N);
-        result += digits[bits.word(0)];
+        auto const digit = read_word_bits(value.data(), value.word_count(), (i - 1) * N, N);
+        result += digits[digit];
     }
     return result;
 }
@@ -78,24 +79,19 @@ auto to_bcd(const uinteger<Width, WordType>& num)
     uinteger<bcd_width, WordType> bcd;
     for (auto i = Width; i > 0; --i)
     {
-        uinteger<bcd_width, WordType> three(3U);
-        uinteger<bcd_width, WordType> four(4U);
-        uinteger<bcd_width, WordType> mask(15U); // NOLINT
-
+        // double dabble: digits larger than four are corrected in-place, adding three to a
+        // digit of at most nine never produces a carry into the next digit
         for (auto c_bcd = 0U; c_bcd < bcd_digits; ++c_bcd)
         {
-            auto masked = bcd & mask;
-            if (masked > four)
+            const auto digit = read_word_bits(bcd.data(), bcd.word_count(), 4 * c_bcd, 4);
+            if (digit > 4U)
             {
-                bcd = add(bcd, three);
+                write_word_bits(bcd.data(), bcd.word_count(), 4 * c_bcd, 4,
+                                static_cast<WordType>(digit + 3U));
             }
-
-            three = (three << 4);
-            four = (four << 4);
-            mask = (mask << 4);
         }
 
-        bcd = (bcd << 1);
+        bcd <<= 1;
         const auto new_word = bcd.word(0) | (num.bit(i - 1));
         bcd.set_word(0, new_word);
     }
@@ -106,7 +102,15 @@ auto to_bcd(const uinteger<Width, WordType>& num)
 template <size_t Width, typename WordType>
 auto to_decimal(const uinteger<Width, WordType>& value) -> std::string
 {
-    return remove_leading_zeroes(to_hex(to_bcd(value)));
+    if constexpr (uses_limb_arena<Width, WordType>())
+    {
+        // the double dabble needs a quadratic number of steps in the width
+        return limbs_to_decimal(value.data(), value.word_count());
+    }
+    else
+    {
+        return remove_leading_zeroes(to_hex(to_bcd(value)));
+    }
 }
 
 /// Convert the given integer value into a decimal string representation.
@@ -120,7 +124,7 @@ auto to_decimal(const integer<Width, WordType>& value) -> std::string
         res += "-";
     }
     const auto absval = expanding_abs(value);
-    res += remove_leading_zeroes(to_hex(to_bcd(absval)));
+    res += to_decimal(absval);
     return res;
 }
 
@@ -2,6 +2,7 @@
 
 #include <aarith/core/traits.hpp>
 #include <aarith/core/word_array.hpp>
+#include <aarith/core/word_array_view.hpp>
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -69,6 +70,12 @@ public:
     {
     }
 
+    template <size_t V>
+    constexpr uinteger<Width, WordType>(const word_array_view<V, WordType>& view) // NOLINT
+        : word_array<Width, WordType>(view)
+    {
+    }
+
     template <class... Args> static constexpr auto from_words(Args... args) -> uinteger
     {
         uinteger n;
@@ -268,6 +275,12 @@ public:
     {
     }
 
+    template <size_t V>
+    constexpr integer<Width, WordType>(const word_array_view<V, WordType>& view) // NOLINT
+        : word_array<Width, WordType>(view)
+    {
+    }
+
     [[nodiscard]] static constexpr integer min()
     {
         integer min;
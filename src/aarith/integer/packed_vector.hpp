@@ -0,0 +1,643 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+#include <aarith/integer/integers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace aarith {
+
+/**
+ * @brief A sequence container storing `uinteger` or `integer` values densely packed
+ *
+ * Every value occupies exactly `W` bits of the underlying storage, i.e., a
+ * `packed_vector<uinteger<5>>` of 64 elements needs five 64-bit words (instead of 64 words for a
+ * `std::vector<uinteger<5>>`). Values may straddle word boundaries.
+ *
+ * As the elements are not addressable, `operator[]` on a mutable container returns a proxy
+ * reference (similar to `std::vector<bool>`). Reading an element yields a copy of the value.
+ *
+ * For moving data between the packed representation and native integer arrays, `unpack` and
+ * `pack` convert ranges of elements at once. If the target supports BMI2, they use PDEP/PEXT to
+ * process a full 64-bit word per step.
+ *
+ * @tparam Integer The type of the stored values (an `uinteger` or `integer`)
+ */
+template <class Integer> class packed_vector
+{
+    static_assert(is_integral_v<Integer>, "Only uinteger and integer values can be packed");
+
+    using storage_word = uint64_t;
+
+    static constexpr size_t storage_width = 64;
+    static constexpr size_t value_width = Integer::width();
+    static constexpr size_t value_word_width = Integer::word_width();
+
+public:
+    using value_type = Integer;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = value_type;
+
+    /**
+     * @brief Proxy referencing a single element of a packed_vector
+     */
+    class reference
+    {
+    public:
+        reference(packed_vector& container, const size_t index)
+            : container(&container)
+            , index(index)
+        {
+        }
+
+        reference(const reference&) = default;
+
+        operator value_type() const // NOLINT
+        {
+            return container->get(index);
+        }
+
+        reference& operator=(const value_type& value)
+        {
+            container->set(index, value);
+            return *this;
+        }
+
+        reference& operator=(const reference& other) // NOLINT
+        {
+            return *this = static_cast<value_type>(other);
+        }
+
+        friend void swap(reference a, reference b)
+        {
+            const value_type tmp = a;
+            a = static_cast<value_type>(b);
+            b = tmp;
+        }
+
+        friend bool operator==(const reference& a, const value_type& b)
+        {
+            return static_cast<value_type>(a) == b;
+        }
+
+        friend bool operator==(const value_type& a, const reference& b)
+        {
+            return a == static_cast<value_type>(b);
+        }
+
+        friend bool operator!=(const reference& a, const value_type& b)
+        {
+            return !(a == b);
+        }
+
+        friend bool operator!=(const value_type& a, const reference& b)
+        {
+            return !(a == b);
+        }
+
+    private:
+        packed_vector* container;
+        size_t index;
+    };
+
+    /**
+     * @brief Random access iterator over the elements of a packed_vector
+     *
+     * @tparam Const Whether the iterator only allows reading the elements
+     */
+    template <bool Const> class basic_iterator
+    {
+        using container_type = std::conditional_t<Const, const packed_vector, packed_vector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Integer;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, Integer, typename packed_vector::reference>;
+
+        basic_iterator() = default;
+
+        basic_iterator(container_type* container, const size_t index)
+            : container(container)
+            , index(index)
+        {
+        }
+
+        /**
+         * @brief Every iterator can be converted into a const iterator
+         */
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) // NOLINT
+            : container(other.container)
+            , index(other.index)
+        {
+        }
+
+        reference operator*() const
+        {
+            if constexpr (Const)
+            {
+                return container->get(index);
+            }
+            else
+            {
+                return reference{*container, index};
+            }
+        }
+
+        reference operator[](const difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        basic_iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            basic_iterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+
+        basic_iterator& operator--()
+        {
+            --index;
+            return *this;
+        }
+
+        basic_iterator operator--(int)
+        {
+            basic_iterator tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        basic_iterator& operator+=(const difference_type n)
+        {
+            index = static_cast<size_t>(static_cast<difference_type>(index) + n);
+            return *this;
+        }
+
+        basic_iterator& operator-=(const difference_type n)
+        {
+            return *this += -n;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, const difference_type n)
+        {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(const difference_type n, basic_iterator it)
+        {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, const difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b)
+        {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index == b.index;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index != b.index;
+        }
+
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index < b.index;
+        }
+
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index > b.index;
+        }
+
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index <= b.index;
+        }
+
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b)
+        {
+            return a.index >= b.index;
+        }
+
+    private:
+        friend class basic_iterator<!Const>;
+
+        container_type* container{nullptr};
+        size_t index{0};
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    packed_vector() = default;
+
+    /**
+     * @brief Creates a vector of `count` copies of `value`
+     */
+    explicit packed_vector(const size_t count, const value_type& value = value_type::zero())
+    {
+        resize(count, value);
+    }
+
+    packed_vector(std::initializer_list<value_type> values)
+        : packed_vector(values.begin(), values.end())
+    {
+    }
+
+    template <class InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    packed_vector(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            push_back(*first);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return element_count;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return element_count == 0;
+    }
+
+    /**
+     * @brief Returns the number of elements that fit into the currently allocated storage
+     */
+    [[nodiscard]] size_t capacity() const
+    {
+        return storage.capacity() * storage_width / value_width;
+    }
+
+    void reserve(const size_t count)
+    {
+        storage.reserve(words_for(count));
+    }
+
+    void clear()
+    {
+        storage.clear();
+        element_count = 0;
+    }
+
+    /**
+     * @brief Changes the number of elements, new elements are initialized with `value`
+     */
+    void resize(const size_t count, const value_type& value = value_type::zero())
+    {
+        const size_t old_count = element_count;
+        storage.resize(words_for(count), 0U);
+        element_count = count;
+
+        if (count < old_count)
+        {
+            clear_unused_bits();
+        }
+        else if (!value.is_zero())
+        {
+            for (size_t i = old_count; i < count; ++i)
+            {
+                set(i, value);
+            }
+        }
+    }
+
+    void push_back(const value_type& value)
+    {
+        storage.resize(words_for(element_count + 1), 0U);
+        set(element_count++, value);
+    }
+
+    void pop_back()
+    {
+        resize(element_count - 1);
+    }
+
+    /**
+     * @brief Returns the element at the given position
+     */
+    [[nodiscard]] value_type get(const size_t index) const
+    {
+        value_type result = value_type::zero();
+        const size_t offset = index * value_width;
+        for (size_t i = 0; i < result.word_count(); ++i)
+        {
+            const size_t bits = std::min(value_word_width, value_width - i * value_word_width);
+            const auto w = read_bits(offset + i * value_word_width, bits);
+            result.set_word(i, static_cast<typename value_type::word_type>(w));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Overwrites the element at the given position
+     */
+    void set(const size_t index, const value_type& value)
+    {
+        const size_t offset = index * value_width;
+        for (size_t i = 0; i < value.word_count(); ++i)
+        {
+            const size_t bits = std::min(value_word_width, value_width - i * value_word_width);
+            const auto w = static_cast<storage_word>(value.word(i));
+            write_bits(offset + i * value_word_width, bits, w);
+        }
+    }
+
+    [[nodiscard]] reference operator[](const size_t index)
+    {
+        return reference{*this, index};
+    }
+
+    [[nodiscard]] value_type operator[](const size_t index) const
+    {
+        return get(index);
+    }
+
+    /**
+     * @brief Accesses an element with bounds checking
+     *
+     * @throws std::out_of_range if the index is not smaller than the size
+     */
+    [[nodiscard]] reference at(const size_t index)
+    {
+        check_range(index, 1);
+        return reference{*this, index};
+    }
+
+    [[nodiscard]] value_type at(const size_t index) const
+    {
+        check_range(index, 1);
+        return get(index);
+    }
+
+    [[nodiscard]] reference front()
+    {
+        return reference{*this, 0};
+    }
+
+    [[nodiscard]] value_type front() const
+    {
+        return get(0);
+    }
+
+    [[nodiscard]] reference back()
+    {
+        return reference{*this, element_count - 1};
+    }
+
+    [[nodiscard]] value_type back() const
+    {
+        return get(element_count - 1);
+    }
+
+    [[nodiscard]] iterator begin()
+    {
+        return iterator{this, 0};
+    }
+
+    [[nodiscard]] iterator end()
+    {
+        return iterator{this, element_count};
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return const_iterator{this, 0};
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return const_iterator{this, element_count};
+    }
+
+    [[nodiscard]] const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    [[nodiscard]] const_iterator cend() const
+    {
+        return end();
+    }
+
+    /**
+     * @brief Returns the underlying storage words
+     *
+     * Element `i` occupies the bits `[i*W, (i+1)*W)` where bit `j` is bit `j % 64` of word
+     * `j / 64`. All bits behind the last element are zero.
+     */
+    [[nodiscard]] const storage_word* data() const
+    {
+        return storage.data();
+    }
+
+    /**
+     * @brief Returns the number of words of the underlying storage
+     */
+    [[nodiscard]] size_t storage_size() const
+    {
+        return storage.size();
+    }
+
+    /**
+     * @brief Converts the elements `[first, first+count)` into native integers
+     *
+     * Signed values are sign-extended, unsigned values are zero-extended.
+     *
+     * @tparam Native The native integer type (at least as wide as the stored values)
+     * @param first The index of the first element to convert
+     * @param count The number of elements to convert
+     * @param out The array receiving the `count` values
+     * @throws std::out_of_range if the range is not within the vector
+     */
+    template <class Native> void unpack(const size_t first, const size_t count, Native* out) const
+    {
+        static_assert(std::is_integral_v<Native>, "Values can only be unpacked into integers");
+        static_assert(value_width <= 8 * sizeof(Native),
+                      "The native type must be at least as wide as the stored values");
+        check_range(first, count);
+
+        using Unsigned = std::make_unsigned_t<Native>;
+
+        size_t i = 0;
+#if defined(__BMI2__)
+        constexpr size_t lane_width = 8 * sizeof(Native);
+        if constexpr (lane_width < storage_width)
+        {
+            constexpr size_t lanes = storage_width / lane_width;
+            constexpr storage_word mask = lane_mask(lane_width);
+            for (; i + lanes <= count; i += lanes)
+            {
+                const auto bits = read_bits((first + i) * value_width, lanes * value_width);
+                const storage_word spread = _pdep_u64(bits, mask);
+                std::memcpy(out + i, &spread, sizeof(spread));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            out[i] = static_cast<Native>(read_bits((first + i) * value_width, value_width));
+        }
+
+        if constexpr (is_signed_v<Integer> && value_width < 8 * sizeof(Native))
+        {
+            const storage_word sign = storage_word{1} << (value_width - 1);
+            for (i = 0; i < count; ++i)
+            {
+                const auto bits = static_cast<storage_word>(static_cast<Unsigned>(out[i]));
+                out[i] = static_cast<Native>(static_cast<Unsigned>((bits ^ sign) - sign));
+            }
+        }
+    }
+
+    /**
+     * @brief Overwrites the elements `[first, first+count)` with native integers
+     *
+     * Only the `W` least significant bits of every native value are stored.
+     *
+     * @tparam Native The native integer type
+     * @param first The index of the first element to overwrite
+     * @param count The number of elements to overwrite
+     * @param in The array holding the `count` values
+     * @throws std::out_of_range if the range is not within the vector
+     */
+    template <class Native> void pack(const size_t first, const size_t count, const Native* in)
+    {
+        static_assert(std::is_integral_v<Native>, "Values can only be packed from integers");
+        static_assert(value_width <= 8 * sizeof(Native),
+                      "The native type must be at least as wide as the stored values");
+        check_range(first, count);
+
+        using Unsigned = std::make_unsigned_t<Native>;
+
+        size_t i = 0;
+#if defined(__BMI2__)
+        constexpr size_t lane_width = 8 * sizeof(Native);
+        if constexpr (lane_width < storage_width)
+        {
+            constexpr size_t lanes = storage_width / lane_width;
+            constexpr storage_word mask = lane_mask(lane_width);
+            for (; i + lanes <= count; i += lanes)
+            {
+                storage_word spread;
+                std::memcpy(&spread, in + i, sizeof(spread));
+                write_bits((first + i) * value_width, lanes * value_width, _pext_u64(spread, mask));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            write_bits((first + i) * value_width, value_width,
+                       static_cast<storage_word>(static_cast<Unsigned>(in[i])));
+        }
+    }
+
+    friend bool operator==(const packed_vector& a, const packed_vector& b)
+    {
+        return a.element_count == b.element_count && a.storage == b.storage;
+    }
+
+    friend bool operator!=(const packed_vector& a, const packed_vector& b)
+    {
+        return !(a == b);
+    }
+
+private:
+    std::vector<storage_word> storage;
+    size_t element_count{0};
+
+    [[nodiscard]] static constexpr size_t words_for(const size_t count)
+    {
+        return (count * value_width + storage_width - 1) / storage_width;
+    }
+
+    [[nodiscard]] static constexpr storage_word low_mask(const size_t bits)
+    {
+        return bits >= storage_width ? ~storage_word{0} : (storage_word{1} << bits) - 1U;
+    }
+
+    /**
+     * @brief A mask selecting the lowest W bits of every lane of the given width
+     */
+    [[nodiscard]] static constexpr storage_word lane_mask(const size_t lane_width)
+    {
+        storage_word mask = 0;
+        for (size_t lane = 0; lane < storage_width / lane_width; ++lane)
+        {
+            mask |= low_mask(value_width) << (lane * lane_width);
+        }
+        return mask;
+    }
+
+    void check_range(const size_t first, const size_t count) const
+    {
+        if (first > element_count || count > element_count - first)
+        {
+            throw std::out_of_range("Index out of range of packed_vector");
+        }
+    }
+
+    /**
+     * @brief Reads up to 64 bits starting at the given bit offset
+     */
+    [[nodiscard]] storage_word read_bits(const size_t offset, const size_t count) const
+    {
+        return read_word_bits(storage.data(), storage.size(), offset, count);
+    }
+
+    /**
+     * @brief Writes up to 64 bits starting at the given bit offset
+     */
+    void write_bits(const size_t offset, const size_t count, const storage_word bits)
+    {
+        write_word_bits(storage.data(), storage.size(), offset, count, bits);
+    }
+
+    void clear_unused_bits()
+    {
+        const size_t used = (element_count * value_width) % storage_width;
+        if (used != 0)
+        {
+            storage.back() &= low_mask(used);
+        }
+    }
+};
+
+} // namespace aarith
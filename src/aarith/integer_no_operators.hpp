@@ -2,11 +2,13 @@
 
 #include <aarith/core.hpp>
 
+#include <aarith/integer/dyn_integer.hpp>
 #include <aarith/integer/integer_casts.hpp>
 #include <aarith/integer/integer_comparisons.hpp>
 #include <aarith/integer/integer_operations.hpp>
 #include <aarith/integer/integer_ranges.hpp>
 #include <aarith/integer/integers.hpp>
+#include <aarith/integer/packed_vector.hpp>
 
 #include <aarith/integer/integer_string_utils.hpp>
 
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <aarith/core/thread_pool.hpp>
+#include <aarith/linalg/gemm.hpp>
+#include <aarith/linalg/gemm_strategies.hpp>
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <aarith/core/thread_pool.hpp>
+#include <aarith/linalg/gemm_strategies.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace aarith {
+
+/**
+ * @brief Block sizes used by `gemm`
+ *
+ * A block of `mc x kc` elements of A and a block of `kc x nc` elements of B are copied into
+ * contiguous buffers before they are multiplied. Blocks of A are distributed between the threads.
+ */
+struct gemm_blocking
+{
+    size_t mc = 64;  // NOLINT
+    size_t nc = 256; // NOLINT
+    size_t kc = 256; // NOLINT
+};
+
+/**
+ * @brief Multiplies two matrices without using any of the fast paths
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function. Use
+ * @see gemm instead.
+ */
+template <class Strategy, class MatrixA, class MatrixB>
+void blocked_gemm(const size_t m, const size_t n, const size_t k, const MatrixA a, const size_t lda,
+                  const MatrixB b, const size_t ldb, typename Strategy::result_type* c,
+                  const size_t ldc, const Strategy& strategy, thread_pool& pool,
+                  const gemm_blocking& blocking)
+{
+    using Element = typename Strategy::element_type;
+    using Accumulator = typename Strategy::accumulator_type;
+
+    if (blocking.mc == 0 || blocking.nc == 0 || blocking.kc == 0)
+    {
+        throw std::invalid_argument("Block sizes of gemm must not be zero");
+    }
+
+    const size_t row_blocks = (m + blocking.mc - 1) / blocking.mc;
+
+    for (size_t jc = 0; jc < n; jc += blocking.nc)
+    {
+        const size_t nc = std::min(blocking.nc, n - jc);
+
+        // the accumulators of the current column panel of C
+        std::vector<Accumulator> acc(m * nc, strategy.zero());
+        std::vector<Element> b_packed;
+
+        for (size_t pc = 0; pc < k; pc += blocking.kc)
+        {
+            const size_t kc = std::min(blocking.kc, k - pc);
+
+            b_packed.clear();
+            b_packed.reserve(kc * nc);
+            for (size_t p = 0; p < kc; ++p)
+            {
+                const auto row = b + static_cast<std::ptrdiff_t>((pc + p) * ldb + jc);
+                b_packed.insert(b_packed.end(), row, row + static_cast<std::ptrdiff_t>(nc));
+            }
+
+            pool.parallel_for(row_blocks, [&](const size_t block) {
+                const size_t ic = block * blocking.mc;
+                const size_t mc = std::min(blocking.mc, m - ic);
+
+                std::vector<Element> a_packed;
+                a_packed.reserve(mc * kc);
+                for (size_t i = 0; i < mc; ++i)
+                {
+                    const auto row = a + static_cast<std::ptrdiff_t>((ic + i) * lda + pc);
+                    a_packed.insert(a_packed.end(), row, row + static_cast<std::ptrdiff_t>(kc));
+                }
+
+                for (size_t i = 0; i < mc; ++i)
+                {
+                    Accumulator* acc_row = acc.data() + (ic + i) * nc;
+                    const Element* a_row = a_packed.data() + i * kc;
+                    for (size_t p = 0; p < kc; ++p)
+                    {
+                        const Element& a_ip = a_row[p];
+                        const Element* b_row = b_packed.data() + p * nc;
+                        for (size_t j = 0; j < nc; ++j)
+                        {
+                            strategy.multiply_accumulate(acc_row[j], a_ip, b_row[j]);
+                        }
+                    }
+                }
+            });
+        }
+
+        pool.parallel_for(row_blocks, [&](const size_t block) {
+            const size_t ic = block * blocking.mc;
+            const size_t mc = std::min(blocking.mc, m - ic);
+            for (size_t i = ic; i < ic + mc; ++i)
+            {
+                for (size_t j = 0; j < nc; ++j)
+                {
+                    c[i * ldc + jc + j] = strategy.finalize(acc[i * nc + j]);
+                }
+            }
+        });
+    }
+}
+
+/**
+ * @brief General matrix multiplication C = A * B
+ *
+ * All matrices are stored in row-major order, the leading dimensions (`lda`, `ldb`, `ldc`) give
+ * the distance between two rows. The multiplication is blocked for the cache, the blocks are
+ * packed into contiguous buffers and the rows of C are distributed between the threads of the
+ * pool.
+ *
+ * The arithmetic is described by the strategy (see gemm_strategies.hpp). If the strategy can be
+ * computed using native types with bit-identical results (e.g. integers with accumulators of at
+ * most 64 bit), the matrices are converted and the native types are used.
+ *
+ * A and B can be given as pointers or random access iterators, e.g., of a `packed_vector`.
+ *
+ * @tparam Strategy The strategy used for multiplying and accumulating
+ * @tparam MatrixA Pointer or random access iterator to the elements of A
+ * @tparam MatrixB Pointer or random access iterator to the elements of B
+ * @param m Number of rows of A and C
+ * @param n Number of columns of B and C
+ * @param k Number of columns of A and rows of B
+ * @param a The matrix A
+ * @param lda The leading dimension of A
+ * @param b The matrix B
+ * @param ldb The leading dimension of B
+ * @param c The matrix C (the result)
+ * @param ldc The leading dimension of C
+ * @param strategy The strategy used for multiplying and accumulating
+ * @param pool The threads to use
+ * @param blocking The block sizes to use
+ */
+template <class Strategy, class MatrixA, class MatrixB>
+void gemm(const size_t m, const size_t n, const size_t k, const MatrixA a, const size_t lda,
+          const MatrixB b, const size_t ldb, typename Strategy::result_type* c, const size_t ldc,
+          const Strategy& strategy = Strategy{}, thread_pool& pool = default_thread_pool(),
+          const gemm_blocking& blocking = gemm_blocking{})
+{
+    if constexpr (native_gemm<Strategy>::available)
+    {
+        using Native = native_gemm<Strategy>;
+        using NativeType = typename Native::type;
+
+        std::vector<NativeType> a_native(m * k);
+        std::vector<NativeType> b_native(k * n);
+        std::vector<NativeType> c_native(m * n);
+
+        for (size_t i = 0; i < m; ++i)
+        {
+            const auto row = a + static_cast<std::ptrdiff_t>(i * lda);
+            std::transform(row, row + static_cast<std::ptrdiff_t>(k), a_native.data() + i * k,
+                           Native::to_native);
+        }
+        for (size_t p = 0; p < k; ++p)
+        {
+            const auto row = b + static_cast<std::ptrdiff_t>(p * ldb);
+            std::transform(row, row + static_cast<std::ptrdiff_t>(n), b_native.data() + p * n,
+                           Native::to_native);
+        }
+
+        blocked_gemm(m, n, k, a_native.data(), k, b_native.data(), n, c_native.data(), n,
+                     native_arithmetic<NativeType>{}, pool, blocking);
+
+        for (size_t i = 0; i < m; ++i)
+        {
+            std::transform(c_native.data() + i * n, c_native.data() + (i + 1) * n, c + i * ldc,
+                           Native::from_native);
+        }
+    }
+    else
+    {
+        blocked_gemm(m, n, k, a, lda, b, ldb, c, ldc, strategy, pool, blocking);
+    }
+}
+
+/**
+ * @brief Parameters of a two-dimensional convolution
+ */
+struct conv2d_parameters
+{
+    size_t stride = 1;
+    size_t padding = 0;
+};
+
+/**
+ * @brief Two-dimensional convolution (more precisely: cross-correlation) of a multi-channel image
+ *
+ * The image is given in channel-major order (C x H x W), the kernels as (C_out x C x KH x KW) and
+ * the result is stored as (C_out x OH x OW) with `OH = (H + 2*padding - KH) / stride + 1` (and
+ * analogously for OW). The convolution is lowered to a matrix multiplication (im2col) computed by
+ * `gemm`.
+ *
+ * @tparam Strategy The strategy used for multiplying and accumulating
+ * @param input The input image
+ * @param channels The number of input channels
+ * @param height The height of the input image
+ * @param width The width of the input image
+ * @param kernels The convolution kernels
+ * @param out_channels The number of kernels (and output channels)
+ * @param kernel_height The height of the kernels
+ * @param kernel_width The width of the kernels
+ * @param output The output image
+ * @param parameters Stride and padding of the convolution
+ * @param strategy The strategy used for multiplying and accumulating
+ * @param pool The threads to use
+ */
+template <class Strategy>
+void conv2d(const typename Strategy::element_type* input, const size_t channels,
+            const size_t height, const size_t width, const typename Strategy::element_type* kernels,
+            const size_t out_channels, const size_t kernel_height, const size_t kernel_width,
+            typename Strategy::result_type* output,
+            const conv2d_parameters& parameters = conv2d_parameters{},
+            const Strategy& strategy = Strategy{}, thread_pool& pool = default_thread_pool())
+{
+    using Element = typename Strategy::element_type;
+
+    const size_t padded_height = height + 2 * parameters.padding;
+    const size_t padded_width = width + 2 * parameters.padding;
+    if (parameters.stride == 0 || kernel_height > padded_height || kernel_width > padded_width)
+    {
+        throw std::invalid_argument("Invalid convolution parameters");
+    }
+
+    const size_t out_height = (padded_height - kernel_height) / parameters.stride + 1;
+    const size_t out_width = (padded_width - kernel_width) / parameters.stride + 1;
+
+    // im2col: every column contains the input values covered by the kernel at one output position
+    const size_t rows = channels * kernel_height * kernel_width;
+    const size_t columns = out_height * out_width;
+    std::vector<Element> lowered(rows * columns, Element::zero());
+
+    pool.parallel_for(channels, [&](const size_t ch) {
+        for (size_t kh = 0; kh < kernel_height; ++kh)
+        {
+            for (size_t kw = 0; kw < kernel_width; ++kw)
+            {
+                const size_t row = (ch * kernel_height + kh) * kernel_width + kw;
+                for (size_t oh = 0; oh < out_height; ++oh)
+                {
+                    const size_t y = oh * parameters.stride + kh;
+                    if (y < parameters.padding || y - parameters.padding >= height)
+                    {
+                        continue;
+                    }
+                    for (size_t ow = 0; ow < out_width; ++ow)
+                    {
+                        const size_t x = ow * parameters.stride + kw;
+                        if (x < parameters.padding || x - parameters.padding >= width)
+                        {
+                            continue;
+                        }
+                        lowered[row * columns + oh * out_width + ow] =
+                            input[(ch * height + y - parameters.padding) * width + x -
+                                  parameters.padding];
+                    }
+                }
+            }
+        }
+    });
+
+    gemm(out_channels, columns, rows, kernels, rows, lowered.data(), columns, output, columns,
+         strategy, pool);
+}
+
+} // namespace aarith
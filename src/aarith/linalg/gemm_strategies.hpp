@@ -0,0 +1,315 @@
+#pragma once
+
+#include <aarith/core/traits.hpp>
+#include <aarith/float/float_operations.hpp>
+#include <aarith/float/float_policies.hpp>
+#include <aarith/float/kulisch_accumulator.hpp>
+#include <aarith/integer_no_operators.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file gemm_strategies.hpp
+ *
+ * Strategies describing how `gemm` and `conv2d` compute with the matrix elements. A strategy
+ * provides
+ *  - the types `element_type` (the inputs), `accumulator_type` and `result_type` (the outputs),
+ *  - `zero()` returning an empty accumulator,
+ *  - `multiply_accumulate(acc, a, b)` adding the product `a*b` to the accumulator and
+ *  - `finalize(acc)` converting the accumulator into the result.
+ */
+
+namespace aarith {
+
+/**
+ * @brief Converts a number into a (wider) number of the same kind
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <class Target, class Source> [[nodiscard]] constexpr Target widen(const Source& x)
+{
+    if constexpr (std::is_same_v<Target, Source>)
+    {
+        return x;
+    }
+    else
+    {
+        return Target{x};
+    }
+}
+
+/**
+ * @brief Multiply-accumulate using the regular arithmetic of the accumulator type
+ *
+ * Both factors are converted into the accumulator type before they are multiplied. For
+ * floating-point numbers, the rounding mode can be chosen using a rounding policy (see
+ * float_policies.hpp).
+ *
+ * @tparam Element The type of the matrix elements
+ * @tparam Accumulator The type used for accumulating the products (and of the result)
+ * @tparam Rounding The rounding policy used for floating-point accumulators
+ */
+template <class Element, class Accumulator = Element, class Rounding = round_to_nearest_even>
+struct exact_arithmetic
+{
+    using element_type = Element;
+    using accumulator_type = Accumulator;
+    using result_type = Accumulator;
+    using rounding = Rounding;
+
+    [[nodiscard]] accumulator_type zero() const
+    {
+        return accumulator_type::zero();
+    }
+
+    void multiply_accumulate(accumulator_type& acc, const element_type& a,
+                             const element_type& b) const
+    {
+        const auto a_ = widen<accumulator_type>(a);
+        const auto b_ = widen<accumulator_type>(b);
+        if constexpr (is_float_v<accumulator_type>)
+        {
+            acc = add<Rounding>(acc, mul<Rounding>(a_, b_));
+        }
+        else
+        {
+            acc = add(acc, mul(a_, b_));
+        }
+    }
+
+    [[nodiscard]] result_type finalize(const accumulator_type& acc) const
+    {
+        return acc;
+    }
+};
+
+/**
+ * @brief Multiply-accumulate using an exact Kulisch accumulator, rounding only the final result
+ *
+ * @tparam E Width of exponent of the matrix elements
+ * @tparam M Width of mantissa of the matrix elements
+ */
+template <size_t E, size_t M> struct kulisch_arithmetic
+{
+    using element_type = floating_point<E, M>;
+    using accumulator_type = kulisch_accumulator<E, M>;
+    using result_type = floating_point<E, M>;
+
+    [[nodiscard]] accumulator_type zero() const
+    {
+        return accumulator_type{};
+    }
+
+    void multiply_accumulate(accumulator_type& acc, const element_type& a,
+                             const element_type& b) const
+    {
+        acc.accumulate_product(a, b);
+    }
+
+    [[nodiscard]] result_type finalize(const accumulator_type& acc) const
+    {
+        return acc.round();
+    }
+};
+
+/**
+ * @brief Multiply-accumulate using user-provided (e.g. approximate) operations
+ *
+ * This allows to plug in operations like `anytime_mul` or `FAU_add`:
+ *
+ * @code
+ * auto strategy = make_approximate_arithmetic<F>(
+ *     [](const F& a, const F& b) { return anytime_mul(a, b, 12); },
+ *     [](const F& a, const F& b) { return FAU_add<8, 23, 12, 4>(a, b); });
+ * @endcode
+ *
+ * @tparam Element The type of the matrix elements (also used for accumulation)
+ * @tparam Mul Function object computing the product of two elements
+ * @tparam Add Function object computing the sum of two elements
+ */
+template <class Element, class Mul, class Add> struct approximate_arithmetic
+{
+    using element_type = Element;
+    using accumulator_type = Element;
+    using result_type = Element;
+
+    Mul mul_fun;
+    Add add_fun;
+
+    [[nodiscard]] accumulator_type zero() const
+    {
+        return accumulator_type::zero();
+    }
+
+    void multiply_accumulate(accumulator_type& acc, const element_type& a,
+                             const element_type& b) const
+    {
+        acc = add_fun(acc, mul_fun(a, b));
+    }
+
+    [[nodiscard]] result_type finalize(const accumulator_type& acc) const
+    {
+        return acc;
+    }
+};
+
+/**
+ * @brief Creates an `approximate_arithmetic` strategy from the given operations
+ */
+template <class Element, class Mul, class Add>
+[[nodiscard]] approximate_arithmetic<Element, Mul, Add> make_approximate_arithmetic(Mul mul_fun,
+                                                                                   Add add_fun)
+{
+    return approximate_arithmetic<Element, Mul, Add>{std::move(mul_fun), std::move(add_fun)};
+}
+
+/**
+ * @brief Returns the rounded product of two native floating-point numbers
+ *
+ * The empty assembler statement forces the product into a register so the compiler cannot
+ * contract it with a subsequent addition into a fused multiply-add (which GCC does by default
+ * with GNU extensions, i.e., -ffp-contract=fast).
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to call this function.
+ */
+template <class Float> [[nodiscard]] inline Float separately_rounded_product(const Float a,
+                                                                             const Float b)
+{
+    static_assert(std::is_floating_point_v<Float>);
+#if defined(__GNUC__) && defined(__x86_64__)
+    Float product = a * b;
+    asm("" : "+x"(product)); // NOLINT
+    return product;
+#elif defined(__GNUC__) && defined(__aarch64__)
+    Float product = a * b;
+    asm("" : "+w"(product)); // NOLINT
+    return product;
+#else
+    const volatile Float product = a * b;
+    return product;
+#endif
+}
+
+/**
+ * @brief Multiply-accumulate on native types, used for the fast paths
+ *
+ * Floating-point products are rounded before they are added (see `separately_rounded_product`).
+ *
+ * @note As an end-user of aarith, you will, most likely, never need to use this strategy.
+ */
+template <class Native> struct native_arithmetic
+{
+    using element_type = Native;
+    using accumulator_type = Native;
+    using result_type = Native;
+
+    [[nodiscard]] constexpr accumulator_type zero() const
+    {
+        return Native{0};
+    }
+
+    constexpr void multiply_accumulate(accumulator_type& acc, const element_type a,
+                                       const element_type b) const
+    {
+        if constexpr (std::is_floating_point_v<Native>)
+        {
+            acc += separately_rounded_product(a, b);
+        }
+        else
+        {
+            acc += a * b;
+        }
+    }
+
+    [[nodiscard]] constexpr result_type finalize(const accumulator_type acc) const
+    {
+        return acc;
+    }
+};
+
+/**
+ * @brief Describes whether (and how) a strategy can be computed using native types
+ *
+ * A specialization has to provide the native type `type` as well as the conversions `to_native`
+ * and `from_native`. The results have to be bit-identical to those of the strategy.
+ */
+template <class Strategy, class = void> struct native_gemm
+{
+    static constexpr bool available = false;
+};
+
+/**
+ * @brief Unsigned integers are computed modulo 2^64 which is exact for accumulators of up to 64
+ * bits
+ */
+template <size_t W, size_t V, typename WordType>
+struct native_gemm<exact_arithmetic<uinteger<W, WordType>, uinteger<V, WordType>>,
+                   std::enable_if_t<(W <= 64) && (V <= 64)>>
+{
+    static constexpr bool available = true;
+    using type = uint64_t;
+
+    [[nodiscard]] static type to_native(const uinteger<W, WordType>& x)
+    {
+        return static_cast<uint64_t>(uinteger<64, WordType>{x});
+    }
+
+    [[nodiscard]] static uinteger<V, WordType> from_native(const type x)
+    {
+        return width_cast<V>(uinteger<64, WordType>{x});
+    }
+};
+
+/**
+ * @brief Signed integers are computed modulo 2^64 in two's complement which is exact for
+ * accumulators of up to 64 bits
+ */
+template <size_t W, size_t V, typename WordType>
+struct native_gemm<exact_arithmetic<integer<W, WordType>, integer<V, WordType>>,
+                   std::enable_if_t<(W <= 64) && (V <= 64)>>
+{
+    static constexpr bool available = true;
+    using type = uint64_t;
+
+    [[nodiscard]] static type to_native(const integer<W, WordType>& x)
+    {
+        // sign extension followed by a reinterpretation as unsigned number
+        return static_cast<uint64_t>(uinteger<64, WordType>{width_cast<64>(x)});
+    }
+
+    [[nodiscard]] static integer<V, WordType> from_native(const type x)
+    {
+        return integer<V, WordType>{uinteger<64, WordType>{x}};
+    }
+};
+
+/**
+ * @brief Floating-point accumulators in single or double precision (rounding to nearest) map to
+ * `float` and `double`
+ *
+ * @note The native results are bit-identical regardless of the floating-point contraction mode
+ * of the compiler as `native_arithmetic` rounds every product before adding it.
+ */
+template <size_t E, size_t M, size_t EA, size_t MA>
+struct native_gemm<exact_arithmetic<floating_point<E, M>, floating_point<EA, MA>,
+                                    round_to_nearest_even>,
+                   std::enable_if_t<((EA == 8 && MA == 23) || (EA == 11 && MA == 52)) &&
+                                    ((E == EA && M == MA) || (E < EA && M < MA))>>
+{
+    static constexpr bool available = true;
+    using type = std::conditional_t<(EA == 8), float, double>;
+
+    [[nodiscard]] static type to_native(const floating_point<E, M>& x)
+    {
+        return static_cast<type>(widen<floating_point<EA, MA>>(x));
+    }
+
+    [[nodiscard]] static floating_point<EA, MA> from_native(const type x)
+    {
+        return floating_point<EA, MA>{x};
+    }
+};
+
+} // namespace aarith
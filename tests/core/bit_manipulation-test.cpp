@@ -0,0 +1,123 @@
+#include <catch.hpp>
+
+#include "gen_word_array.hpp"
+#include <aarith/core.hpp>
+#include <aarith/integer.hpp>
+
+using namespace aarith;
+
+namespace {
+
+template <size_t W, typename WordType>
+word_array<W, WordType> extract_reference(const word_array<W, WordType>& value,
+                                          const word_array<W, WordType>& mask)
+{
+    word_array<W, WordType> result;
+    size_t position = 0;
+    for (size_t i = 0; i < W; ++i)
+    {
+        if (mask.bit(i))
+        {
+            result.set_bit(position++, value.bit(i));
+        }
+    }
+    return result;
+}
+
+template <size_t W, typename WordType>
+word_array<W, WordType> deposit_reference(const word_array<W, WordType>& value,
+                                          const word_array<W, WordType>& mask)
+{
+    word_array<W, WordType> result;
+    size_t position = 0;
+    for (size_t i = 0; i < W; ++i)
+    {
+        if (mask.bit(i))
+        {
+            result.set_bit(i, value.bit(position++));
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Bit manipulation matches the bit-by-bit definition",
+                       "[word_array][bit_manipulation]", ((size_t W, typename WordType), W, WordType),
+                       (8, uint64_t), (13, uint64_t), (64, uint64_t), (100, uint64_t),
+                       (256, uint64_t), (1024, uint64_t), (24, uint8_t), (150, uint16_t),
+                       (200, uint32_t))
+{
+    using A = word_array<W, WordType>;
+
+    const A value = GENERATE(take(15, random_word_array<W, WordType>()));
+    const A mask = GENERATE(take(5, random_word_array<W, WordType>()));
+
+    THEN("extract_bits and deposit_bits gather and scatter the selected bits")
+    {
+        CHECK(extract_bits(value, mask) == extract_reference(value, mask));
+        CHECK(deposit_bits(value, mask) == deposit_reference(value, mask));
+        CHECK(extract_bits(value, A::all_ones()) == value);
+        REQUIRE(extract_bits(deposit_bits(value, mask), mask) ==
+                deposit_reference(value, extract_bits(mask, mask)));
+    }
+
+    THEN("Reversing bits and bytes matches the definition")
+    {
+        const A reversed = reverse_bits(value);
+        for (size_t i = 0; i < W; ++i)
+        {
+            REQUIRE(reversed.bit(i) == value.bit(W - 1 - i));
+        }
+        REQUIRE(reverse_bits(reversed) == value);
+
+        if constexpr (W % 8 == 0)
+        {
+            const A swapped = byte_swap(value);
+            for (size_t i = 0; i < W; ++i)
+            {
+                const size_t byte = i / 8;
+                REQUIRE(swapped.bit(i) == value.bit((W / 8 - 1 - byte) * 8 + i % 8));
+            }
+        }
+    }
+
+    THEN("Interleaving and deinterleaving are inverse")
+    {
+        const auto interleaved = interleave_bits(value, mask);
+        for (size_t i = 0; i < W; ++i)
+        {
+            REQUIRE(interleaved.bit(2 * i) == value.bit(i));
+            REQUIRE(interleaved.bit(2 * i + 1) == mask.bit(i));
+        }
+        const auto [even, odd] = deinterleave_bits(interleaved);
+        CHECK(even == value);
+        REQUIRE(odd == mask);
+    }
+}
+
+SCENARIO("Using the bit manipulation on integers", "[word_array][bit_manipulation]")
+{
+    GIVEN("Unsigned integers")
+    {
+        const uinteger<16> value{0b1011'0110U};
+        const uinteger<16> mask{0b1111'0000U};
+
+        THEN("The results are still integers")
+        {
+            static constexpr uinteger<16> extracted = extract_bits(uinteger<16>{0xB6U},
+                                                                   uinteger<16>{0xF0U});
+            CHECK(extracted == uinteger<16>{0b1011U});
+            CHECK(deposit_bits(uinteger<16>{0b1011U}, mask) == uinteger<16>{0b1011'0000U});
+            CHECK(byte_swap(value) == uinteger<16>{0xB600U});
+            REQUIRE(reverse_bits(value) == uinteger<16>{0b0110'1101'0000'0000U});
+        }
+
+        THEN("Morton codes of coordinates can be computed")
+        {
+            const uinteger<8> x{0b0000'0011U};
+            const uinteger<8> y{0b0000'0101U};
+            REQUIRE(interleave_bits(x, y) == uinteger<16>{0b0010'0111U});
+        }
+    }
+}
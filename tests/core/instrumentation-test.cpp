@@ -0,0 +1,159 @@
+#include <catch.hpp>
+
+#include <aarith/core.hpp>
+#include <aarith/float.hpp>
+#include <aarith/float/approx_operations.hpp>
+#include <aarith/integer.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+/**
+ * @brief Returns the number of calls of the operation on the width and format (if any)
+ */
+uint64_t calls(const std::string& operation, const size_t width, const std::string& format = "")
+{
+    const std::vector<operation_count> counts = operation_counts();
+    const auto it = std::find_if(counts.begin(), counts.end(), [&](const operation_count& c) {
+        return c.operation == operation && c.width == width && c.format == format;
+    });
+    return it == counts.end() ? 0U : it->calls;
+}
+
+} // namespace
+
+// the operations are still usable in constant expressions
+static_assert(restoring_division(uinteger<64>{100U}, uinteger<64>{7U}).first == uinteger<64>{14U});
+static_assert(schoolbook_expanding_mul(uinteger<64>{100U}, uinteger<64>{7U}) ==
+              uinteger<128>{700U});
+
+SCENARIO("Counting the calls of the instrumented operations", "[core][instrumentation]")
+{
+    REQUIRE(instrumentation_enabled);
+    reset_operation_counts();
+
+    GIVEN("Integer operations")
+    {
+        const uinteger<256> a{1000U};
+        const uinteger<256> b{7U};
+
+        THEN("Every call is counted for the width of the operands")
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                static_cast<void>(restoring_division(a, b));
+                static_cast<void>(schoolbook_expanding_mul(a, b));
+            }
+            static_cast<void>(schoolbook_expanding_mul(uinteger<64>{3U}, uinteger<64>{5U}));
+
+            CHECK(calls("restoring_division", 256) == 3U);
+            CHECK(calls("schoolbook_expanding_mul", 256) == 3U);
+            CHECK(calls("schoolbook_expanding_mul", 64) == 1U);
+        }
+    }
+
+    GIVEN("Floating-point operations")
+    {
+        const floating_point<8, 23> a{1.5F};
+        const floating_point<8, 23> b{2.25F};
+        const std::string single = "floating_point<8, 23>";
+
+        THEN("The additions are counted per format")
+        {
+            static_cast<void>(a + b);
+            static_cast<void>(a - b);
+            static_cast<void>(floating_point<11, 52>{1.5} + floating_point<11, 52>{2.25});
+
+            CHECK(calls("add_", 32, single) == 2U);
+            CHECK(calls("add_", 64, "floating_point<11, 52>") == 1U);
+            CHECK(calls("round_and_pack", 32, single) == 2U);
+            CHECK(calls("round_and_pack", 64, "floating_point<11, 52>") == 1U);
+        }
+
+        THEN("The mantissa kernels of multiplications and divisions are counted per format")
+        {
+            static_cast<void>(a * b);
+            static_cast<void>(a / b);
+
+            CHECK(calls("schoolbook_expanding_mul", 24, single) == 1U);
+            CHECK(calls("restoring_division", 2 * 23 + 5, single) == 1U);
+            CHECK(calls("round_and_pack_wide", 32, single) == 2U);
+            CHECK(calls("schoolbook_expanding_mul", 24) == 0U);
+        }
+
+        THEN("The approximate operations are counted as the operation actually performed")
+        {
+            static_cast<void>(anytime_add(a, b, 10));
+            static_cast<void>(anytime_add(a, -b, 10));
+            static_cast<void>(anytime_mul(a, b, 10));
+            static_cast<void>(FAU_add<8, 23, 8, 2>(a, b));
+
+            CHECK(calls("anytime_add", 32, single) == 1U);
+            CHECK(calls("anytime_sub", 32, single) == 1U);
+            CHECK(calls("anytime_mul", 32, single) == 1U);
+            CHECK(calls("FAU_add", 32, single) == 1U);
+            CHECK(calls("FAUadder", 24) == 1U);
+            CHECK(calls("normalize", 33, "floating_point<8, 24>") >= 1U);
+        }
+    }
+
+    GIVEN("Several threads")
+    {
+        THEN("The counts of all threads (including finished ones) are summed up")
+        {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([]() {
+                    for (int i = 0; i < 100; ++i)
+                    {
+                        static_cast<void>(
+                            schoolbook_expanding_mul(uinteger<128>{3U}, uinteger<128>{5U}));
+                    }
+                });
+            }
+            static_cast<void>(schoolbook_expanding_mul(uinteger<128>{3U}, uinteger<128>{5U}));
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            CHECK(calls("schoolbook_expanding_mul", 128) == 401U);
+
+            reset_operation_counts();
+            CHECK(calls("schoolbook_expanding_mul", 128) == 0U);
+        }
+    }
+}
+
+SCENARIO("Dumping the counts", "[core][instrumentation]")
+{
+    reset_operation_counts();
+
+    GIVEN("Some counted operations")
+    {
+        static_cast<void>(floating_point<8, 23>{1.5F} * floating_point<8, 23>{2.0F});
+        static_cast<void>(restoring_division(uinteger<64>{9U}, uinteger<64>{2U}));
+
+        THEN("The table lists every operation, format and width")
+        {
+            std::stringstream out;
+            dump_operation_counts(out);
+            const std::string table = out.str();
+
+            CHECK(table.find("calls") != std::string::npos);
+            CHECK(table.find("restoring_division") != std::string::npos);
+            if (instrumentation_timers_enabled)
+            {
+                CHECK(table.find(instrumentation::tick_unit) != std::string::npos);
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+#include <aarith/core.hpp>
+#include <catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+SCENARIO("Generating random words using xoshiro256**", "[random][utility]")
+{
+    GIVEN("The generator with a known state")
+    {
+        xoshiro256starstar rng{std::array<uint64_t, 4>{1, 2, 3, 4}};
+
+        THEN("It produces the reference sequence")
+        {
+            CHECK(rng() == 0x2d00U);
+            CHECK(rng() == 0x0U);
+            CHECK(rng() == 0x5a007080U);
+            CHECK(rng() == 0x10e0000000009d80U);
+            CHECK(rng() == 0x10e0b61ce1009d80U);
+        }
+        THEN("Jumping produces the reference sequence")
+        {
+            rng.jump();
+            CHECK(rng() == 0xbbd2f312298443d8U);
+        }
+    }
+
+    GIVEN("A seed")
+    {
+        xoshiro256starstar rng{0};
+
+        THEN("The state is expanded using splitmix64")
+        {
+            CHECK(rng() == 0x99ec5f36cb75f2b4U);
+        }
+        THEN("Filling a batch produces the same words as calling the generator")
+        {
+            xoshiro256starstar copy{rng};
+            std::vector<uint64_t> batch(64);
+            rng.generate(batch.begin(), batch.end());
+            for (const uint64_t word : batch)
+            {
+                REQUIRE(word == copy());
+            }
+            CHECK(rng == copy);
+        }
+        THEN("Discarding skips words")
+        {
+            xoshiro256starstar copy{rng};
+            rng.discard(10);
+            for (int i = 0; i < 10; ++i)
+            {
+                copy();
+            }
+            CHECK(rng == copy);
+        }
+    }
+
+    GIVEN("Generators that are compatible with the standard library")
+    {
+        THEN("Their number of random bits per call is known")
+        {
+            STATIC_REQUIRE(generator_bits<xoshiro256starstar>() == 64);
+            STATIC_REQUIRE(generator_bits<std::mt19937>() == 32);
+            STATIC_REQUIRE(generator_bits<std::mt19937_64>() == 64);
+            STATIC_REQUIRE(generator_bits<std::minstd_rand>() == 0);
+        }
+        THEN("Random words are combined from several calls")
+        {
+            std::mt19937 rng{5};
+            std::mt19937 copy{rng};
+            const auto word = random_word<uint64_t>(rng);
+            const uint64_t low = copy();
+            const uint64_t high = copy();
+            CHECK(word == (low | (high << 32U)));
+        }
+    }
+}
+
+SCENARIO("Generating random words using Philox4x64-10", "[random][utility]")
+{
+    GIVEN("The known answer tests of Random123")
+    {
+        THEN("The blocks are encrypted correctly")
+        {
+            using block = philox4x64::block_type;
+            CHECK(philox4x64::encrypt({0, 0, 0, 0}, {0, 0}) ==
+                  block{0x16554d9eca36314cU, 0xdb20fe9d672d0fdcU, 0xd7e772cee186176bU,
+                        0x7e68b68aec7ba23bU});
+            constexpr uint64_t ones = ~uint64_t{0};
+            CHECK(philox4x64::encrypt({ones, ones, ones, ones}, {ones, ones}) ==
+                  block{0x87b092c3013fe90bU, 0x438c3c67be8d0224U, 0x9cc7d7c69cd777b6U,
+                        0xa09caebf594f0ba0U});
+            CHECK(philox4x64::encrypt({0x243f6a8885a308d3U, 0x13198a2e03707344U,
+                                       0xa4093822299f31d0U, 0x082efa98ec4e6c89U},
+                                      {0x452821e638d01377U, 0xbe5466cf34e90c6cU}) ==
+                  block{0xa528f45403e61d95U, 0x38c72dbd566e9788U, 0xa5a1610e72fd18b5U,
+                        0x57bd43b5e52b7fe6U});
+        }
+        THEN("The generator returns the words of the blocks in order")
+        {
+            philox4x64 rng{0, 0};
+            CHECK(rng() == 0x16554d9eca36314cU);
+            CHECK(rng() == 0xdb20fe9d672d0fdcU);
+            CHECK(rng() == 0xd7e772cee186176bU);
+            CHECK(rng() == 0x7e68b68aec7ba23bU);
+            CHECK(rng() == philox4x64::encrypt({1, 0, 0, 0}, {0, 0})[0]);
+        }
+    }
+
+    GIVEN("A generator")
+    {
+        philox4x64 rng{1234};
+
+        THEN("Skipping words is equivalent to generating them")
+        {
+            const uint64_t n = GENERATE(0, 1, 3, 4, 5, 11, 1000);
+            const uint64_t offset = GENERATE(0, 1, 3);
+            rng.skip(offset);
+            philox4x64 copy{rng};
+            rng.skip(n);
+            for (uint64_t i = 0; i < n; ++i)
+            {
+                copy();
+            }
+            CHECK(rng == copy);
+            CHECK(rng() == copy());
+        }
+        THEN("Filling a batch produces the same words as calling the generator")
+        {
+            const size_t size = GENERATE(0, 1, 4, 7, 64, 101);
+            rng();
+            philox4x64 copy{rng};
+            std::vector<uint64_t> batch(size);
+            rng.generate(batch.begin(), batch.end());
+            for (const uint64_t word : batch)
+            {
+                REQUIRE(word == copy());
+            }
+            CHECK(rng() == copy());
+        }
+        THEN("The streams of the seed differ")
+        {
+            philox4x64 first = rng.stream(1);
+            philox4x64 second = rng.stream(2);
+            CHECK(first == philox4x64{1234, 1});
+            CHECK(first() != second());
+        }
+        THEN("The substreams differ from each other, the generator and its later substreams")
+        {
+            philox4x64 first = rng.substream(0);
+            philox4x64 second = rng.substream(1);
+            philox4x64 other_stream = rng.stream(7).substream(0);
+            const philox4x64 copy{rng};
+            rng.skip(4);
+            philox4x64 later = rng.substream(0);
+
+            CHECK(rng.substream(0) != first);
+            const uint64_t word = first();
+            CHECK(word != second());
+            CHECK(word != other_stream());
+            CHECK(word != later());
+            CHECK(word != philox4x64{copy}());
+        }
+    }
+}
+
+SCENARIO("Generating reproducible random numbers in parallel", "[random][utility][parallel]")
+{
+    GIVEN("A distribution and a seed")
+    {
+        uniform_word_array_distribution<150> distribution;
+        philox4x64 rng{99};
+        constexpr size_t count = 1000;
+        constexpr size_t block_size = 64;
+
+        THEN("The numbers do not depend on the number of threads")
+        {
+            // generating the blocks one after the other
+            std::vector<word_array<150>> serial(count);
+            for (size_t block = 0; block * block_size < count; ++block)
+            {
+                philox4x64 block_rng = rng.substream(block);
+                const auto first = serial.begin() + static_cast<std::ptrdiff_t>(block * block_size);
+                const auto last =
+                    serial.begin() +
+                    static_cast<std::ptrdiff_t>(std::min(count, (block + 1) * block_size));
+                for (auto it = first; it != last; ++it)
+                {
+                    *it = distribution(block_rng);
+                }
+            }
+
+            for (const size_t threads : {1, 2, 5})
+            {
+                thread_pool pool{threads};
+                std::vector<word_array<150>> parallel(count);
+                philox4x64 parallel_rng{rng};
+                parallel_generate(pool, distribution, parallel.begin(), parallel.end(),
+                                  parallel_rng, block_size);
+                REQUIRE(parallel == serial);
+            }
+        }
+
+        THEN("The numbers depend on the stream and change with every call")
+        {
+            thread_pool pool{2};
+            philox4x64 other_stream{99, 7};
+            std::vector<word_array<150>> first(count);
+            std::vector<word_array<150>> second(count);
+            std::vector<word_array<150>> other(count);
+            parallel_generate(pool, distribution, first.begin(), first.end(), rng, block_size);
+            parallel_generate(pool, distribution, second.begin(), second.end(), rng, block_size);
+            parallel_generate(pool, distribution, other.begin(), other.end(), other_stream,
+                              block_size);
+
+            CHECK(first != second);
+            CHECK(first != other);
+            CHECK(rng != philox4x64{99});
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include <catch.hpp>
+
+#include "gen_word_array.hpp"
+#include <aarith/core.hpp>
+#include <aarith/integer.hpp>
+
+#include <utility>
+
+using namespace aarith;
+
+namespace {
+
+template <size_t W, typename WordType>
+word_array<W, WordType> shift_left_reference(const word_array<W, WordType>& value,
+                                             const size_t shift)
+{
+    word_array<W, WordType> result;
+    for (size_t i = shift; i < W; ++i)
+    {
+        result.set_bit(i, value.bit(i - shift));
+    }
+    return result;
+}
+
+template <size_t W, typename WordType>
+word_array<W, WordType> shift_right_reference(const word_array<W, WordType>& value,
+                                              const size_t shift, const bool fill)
+{
+    word_array<W, WordType> result;
+    for (size_t i = 0; i < W; ++i)
+    {
+        result.set_bit(i, i + shift < W ? static_cast<bool>(value.bit(i + shift)) : fill);
+    }
+    return result;
+}
+
+template <size_t N, size_t W, typename WordType>
+void check_compile_time_shifts(const word_array<W, WordType>& value,
+                               const word_array<W, WordType>& other)
+{
+    using A = word_array<W, WordType>;
+
+    const A left = shift_left_reference(value, N);
+    const A right = shift_right_reference(value, N, false);
+    const A arithmetic = shift_right_reference(value, N, value.msb());
+
+    CHECK(shl<N>(value) == left);
+    CHECK(shr<N>(value) == right);
+    CHECK(sar<N>(value) == arithmetic);
+
+    CHECK(shl_or<N>(value, other) == (left | other));
+    CHECK(shr_or<N>(value, other) == (right | other));
+    CHECK(shl_and<N>(value, other) == (left & other));
+    CHECK(shr_and<N>(value, other) == (right & other));
+}
+
+template <size_t W, typename WordType, size_t... Ns>
+void check_compile_time_shifts(const word_array<W, WordType>& value,
+                               const word_array<W, WordType>& other, std::index_sequence<Ns...>)
+{
+    (check_compile_time_shifts<Ns>(value, other), ...);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("Shifts match the bit-by-bit definition", "[word_array][shift]",
+                       ((size_t W, typename WordType), W, WordType), (8, uint64_t), (13, uint64_t),
+                       (64, uint64_t), (100, uint64_t), (256, uint64_t), (512, uint64_t),
+                       (1000, uint64_t), (1024, uint64_t), (24, uint8_t), (150, uint16_t),
+                       (200, uint32_t), (600, uint32_t))
+{
+    using A = word_array<W, WordType>;
+
+    const A value = GENERATE(take(10, random_word_array<W, WordType>()));
+    const A other = GENERATE(take(2, random_word_array<W, WordType>()));
+
+    THEN("Shifting by a runtime amount matches the definition")
+    {
+        for (size_t shift = 0; shift <= W + 3; ++shift)
+        {
+            CHECK((value << shift) == shift_left_reference(value, shift));
+            CHECK((value >> shift) == shift_right_reference(value, shift, false));
+
+            A arithmetic{value};
+            arithmetic_right_shift(arithmetic, shift);
+            CHECK(arithmetic == shift_right_reference(value, shift, value.msb()));
+        }
+    }
+
+    THEN("Shifting by a compile-time amount matches the definition")
+    {
+        check_compile_time_shifts(value, other,
+                                  std::index_sequence<0, 1, 5, 7, 8, 9, 31, 32, 63, 64, 65, 127,
+                                                      128, 200, 511, 512, W / 2, W - 1, W, W + 1,
+                                                      2 * W>{});
+    }
+}
+
+SCENARIO("Compile-time shifts can be evaluated at compile time", "[word_array][shift]")
+{
+    GIVEN("A constant word_array")
+    {
+        constexpr word_array<128> value = word_array<128>::from_words(0x8000'0000'0000'0001U, 3U);
+
+        THEN("The shifts are constant expressions")
+        {
+            constexpr auto left = shl<65>(value);
+            constexpr auto right = shr<64>(value);
+            constexpr auto arithmetic = sar<127>(value);
+
+            STATIC_REQUIRE(left == word_array<128>::from_words(6U, 0U));
+            STATIC_REQUIRE(right == word_array<128>::from_words(0U, 0x8000'0000'0000'0001U));
+            STATIC_REQUIRE(arithmetic == word_array<128>::all_ones());
+        }
+    }
+}
@@ -167,6 +167,26 @@ TEMPLATE_TEST_CASE_SIG("Counting bits in word_array", "[word_array][utility]",
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Counting leading zeroes/ones matches the bitwise definition",
+                       "[word_array][utility]", AARITH_INT_TEST_SIGNATURE,
+                       AARITH_WORD_ARRAY_TEST_TEMPLATE_PARAM_RANGE)
+{
+    using I = word_array<W, WordType>;
+
+    const size_t index = GENERATE(range(size_t{0}, W));
+
+    I single{I::all_zeroes()};
+    single.set_bit(index, true);
+
+    I ones_above{I::all_ones()};
+    ones_above.set_bit(index, false);
+
+    CHECK(count_leading_zeroes(single) == W - 1 - index);
+    CHECK(count_leading_ones(ones_above) == W - 1 - index);
+    CHECK(any_set_bit_below(single, index + 1));
+    REQUIRE_FALSE(any_set_bit_below(single, index));
+}
+
 TEMPLATE_TEST_CASE_SIG("Checking whether an word_array is not equal to zero/false",
                        "[word_array][utility]", AARITH_INT_TEST_SIGNATURE,
                        AARITH_WORD_ARRAY_TEST_TEMPLATE_PARAM_RANGE)
@@ -0,0 +1,151 @@
+#include <catch.hpp>
+
+#include "gen_word_array.hpp"
+#include <aarith/core.hpp>
+#include <aarith/integer.hpp>
+
+using namespace aarith;
+
+namespace {
+
+/// Reference implementation extracting the bits one by one
+template <size_t Count, size_t W, typename WordType>
+word_array<Count, WordType> bits_reference(const word_array<W, WordType>& w, const size_t index)
+{
+    word_array<Count, WordType> result;
+    for (size_t i = 0; i < Count && index + i < W; ++i)
+    {
+        result.set_bit(i, w.bit(index + i));
+    }
+    return result;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Views read the same bits as the copying extraction",
+                   "[word_array][utility][view]", uint8_t, uint16_t, uint64_t)
+{
+    using WordType = TestType;
+
+    const word_array<150, WordType> w = GENERATE(take(20, random_word_array<150, WordType>()));
+    const size_t index = GENERATE(0, 1, 7, 63, 64, 65, 100, 149);
+
+    THEN("bits and bits_view extract the same bits as the per-bit reference")
+    {
+        CHECK(w.template bits<1>(index) == bits_reference<1>(w, index));
+        CHECK(w.template bits<13>(index) == bits_reference<13>(w, index));
+        CHECK(w.template bits<64>(index) == bits_reference<64>(w, index));
+        CHECK(w.template bits<77>(index) == bits_reference<77>(w, index));
+
+        CHECK(bits_view<13>(w, index) == bits_reference<13>(w, index));
+        CHECK(bits_view<64>(w, index) == bits_reference<64>(w, index));
+        REQUIRE(bits_view<77>(w, index) == bits_reference<77>(w, index));
+    }
+
+    THEN("bit_range_view and bit_range agree")
+    {
+        CHECK(bit_range_view<149, 0>(w) == bit_range<149, 0>(w));
+        CHECK(bit_range_view<70, 60>(w) == bit_range<70, 60>(w));
+        CHECK(bit_range_view<127, 64>(w) == bit_range<127, 64>(w));
+        CHECK(bit_range_view<149, 3>(w) == bit_range<149, 3>(w));
+        REQUIRE(word_array<11, WordType>{bit_range_view<70, 60>(w)} == bit_range<70, 60>(w));
+    }
+
+    THEN("Splitting yields the upper and lower bits")
+    {
+        const auto [upper, lower] = split<80>(w);
+        CHECK(upper == bits_reference<69>(w, 81));
+        REQUIRE(lower == bits_reference<81>(w, 0));
+    }
+}
+
+TEMPLATE_TEST_CASE("Setting ranges of bits word by word", "[word_array][utility][view]", uint8_t,
+                   uint32_t, uint64_t)
+{
+    using WordType = TestType;
+
+    const word_array<150, WordType> w = GENERATE(take(10, random_word_array<150, WordType>()));
+    const word_array<70, WordType> v = GENERATE(take(5, random_word_array<70, WordType>()));
+    const size_t end = GENERATE(0, 1, 31, 64, 80);
+
+    word_array<150, WordType> expected{w};
+    for (size_t i = 0; i < v.width(); ++i)
+    {
+        expected.set_bit(end + i, v.bit(i));
+    }
+
+    THEN("set_bits matches setting the bits one by one")
+    {
+        word_array<150, WordType> result{w};
+        result.set_bits(end, v);
+        REQUIRE(result == expected);
+    }
+
+    THEN("Assigning to a bit span matches setting the bits one by one")
+    {
+        word_array<150, WordType> result{w};
+        bits_span<70>(result, end) = v;
+        REQUIRE(result == expected);
+    }
+}
+
+SCENARIO("Using views and spans as operands", "[word_array][utility][view]")
+{
+    GIVEN("A packed word with several small fields")
+    {
+        uinteger<48> packed = uinteger<48>::from_words(0x0000'F00D'BEEF'1234ULL);
+
+        THEN("Integers can be constructed directly from views")
+        {
+            const uinteger<16> low{bit_range_view<15, 0>(packed)};
+            const uinteger<16> high{bit_range_view<47, 32>(packed)};
+            const integer<16> signed_high{bit_range_view<47, 32>(packed)};
+
+            CHECK(low == uinteger<16>{0x1234U});
+            CHECK(add(low, high) == uinteger<16>{0x1234U + 0xF00DU});
+            CHECK(signed_high.is_negative());
+            REQUIRE(bit_range_view<31, 16>(packed) == uinteger<16>{0xBEEFU});
+        }
+
+        THEN("Fields can be overwritten through spans")
+        {
+            bit_range_span<31, 16>(packed) = word_array<16>{0xCAFEU};
+            REQUIRE(packed == uinteger<48>::from_words(0x0000'F00D'CAFE'1234ULL));
+        }
+
+        THEN("Overlapping assignments behave like copies")
+        {
+            bits_span<32>(packed, 8) = bits_view<32>(packed, 0);
+            REQUIRE(packed == uinteger<48>::from_words(0x0000'F0BE'EF12'3434ULL));
+        }
+
+        THEN("Single bits can be accessed")
+        {
+            auto span = bit_range_span<47, 40>(packed);
+            CHECK(span.bit(7) == 1U);
+            span.set_bit(7, false);
+            REQUIRE(packed.bit(47) == 0U);
+        }
+    }
+
+    GIVEN("An integer whose width is not a multiple of the word width")
+    {
+        uinteger<60> a{0U};
+
+        THEN("Spans reaching beyond the width do not write the unused bits of the top word")
+        {
+            bits_span<8>(a, 56) = word_array<8>{0xFFU};
+            CHECK(a.word(0) == 0xF00'0000'0000'0000ULL);
+            CHECK_FALSE(a > uinteger<60>::max());
+            REQUIRE(a == add(a, uinteger<60>{0U}));
+        }
+
+        THEN("Single bits beyond the width are not written")
+        {
+            auto span = bits_span<8>(a, 56);
+            span.set_bit(3);
+            span.set_bit(4);
+            REQUIRE(a.word(0) == 0x800'0000'0000'0000ULL);
+        }
+    }
+}
@@ -1,181 +1,658 @@
+#include "sharded_check.hpp"
+
 #include <aarith/float.hpp>
+#include <aarith/float/float_random_generation.hpp>
+#include <aarith/float/unnormalized_float.hpp>
+
 #include <gmp.h>
 #include <mpfr.h>
 
-#include <chrono>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
+
+/*
+ * Compares the results of the floating-point operations (rounded to nearest, ties to even) with the
+ * results of MPFR, bit for bit. MPFR computes with the precision and the exponent range of the
+ * format, the subnormal numbers are emulated using mpfr_subnormalize. All NaNs are considered
+ * equal.
+ *
+ * Small formats (up to 16 bits) are checked exhaustively, e.g.,
+ *
+ *   check_against_mpfr --format 5,10 --op mul
+ *
+ * checks all 2^32 products of half precision numbers. Larger formats are checked using stratified
+ * samples: every combination of the classes of operands (zero, subnormal, normal, near a tie,
+ * special, random bits and, for the last operand, close to the other operand or the product) gets
+ * the same number of samples. The checks are sharded, resumable and report their mismatches like
+ * check_integers_sharded does.
+ *
+ * @note The exponent range of MPFR is set per thread, which requires a thread-safe build of MPFR.
+ */
+
 using namespace aarith;
+using namespace aarith::correctness;
+
+namespace {
+
+struct options
+{
+    size_t exponent_width{4};
+    size_t mantissa_width{3};
+    std::string op{"add"};
+    std::string mode;
+    uint64_t samples{uint64_t{1} << 16U};
+    uint64_t seed{philox4x64::default_seed};
+    shard_options sharding;
+};
+
+void print_usage()
+{
+    std::cerr << "usage: check_against_mpfr [options]\n"
+                 "  --format E,M               the format to check, one of 3,2 4,3 5,2 5,10 8,7\n"
+                 "                             8,23 and 11,52 (default 4,3)\n"
+                 "  --op add|sub|mul|div|fma   the operation to check (default add)\n"
+                 "  --mode exhaustive|stratified\n"
+                 "                             check all operands or stratified samples (default\n"
+                 "                             exhaustive for formats of up to 16 bits)\n"
+                 "  --samples N                the samples per combination of classes (default\n"
+                 "                             2^16)\n"
+                 "  --seed S                   the seed of the samples\n"
+              << shard_options::usage;
+}
+
+options parse_options(const int argc, char** argv)
+{
+    options opts;
+    for (int i = 1; i < argc; i += 2)
+    {
+        const std::string key{argv[i]};
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument("Missing value of " + key);
+        }
+        const std::string value{argv[i + 1]};
+        if (key == "--format")
+        {
+            const auto comma = value.find(',');
+            if (comma == std::string::npos)
+            {
+                throw std::invalid_argument("The format has to be given as E,M");
+            }
+            opts.exponent_width = std::stoul(value.substr(0, comma));
+            opts.mantissa_width = std::stoul(value.substr(comma + 1));
+        }
+        else if (key == "--op")
+        {
+            opts.op = value;
+        }
+        else if (key == "--mode")
+        {
+            if (value != "exhaustive" && value != "stratified")
+            {
+                throw std::invalid_argument("The mode has to be exhaustive or stratified");
+            }
+            opts.mode = value;
+        }
+        else if (key == "--samples")
+        {
+            opts.samples = std::stoull(value);
+        }
+        else if (key == "--seed")
+        {
+            opts.seed = std::stoull(value);
+        }
+        else if (!opts.sharding.parse(key, value))
+        {
+            throw std::invalid_argument("Unknown option " + key);
+        }
+    }
+    opts.sharding.validate();
+    if (opts.mode.empty())
+    {
+        opts.mode = 1 + opts.exponent_width + opts.mantissa_width <= 16 ? "exhaustive"
+                                                                          : "stratified";
+    }
+    return opts;
+}
+
+enum class float_operation
+{
+    add,
+    sub,
+    mul,
+    div,
+    fma
+};
+
+[[nodiscard]] float_operation parse_operation(const std::string& op)
+{
+    if (op == "add")
+    {
+        return float_operation::add;
+    }
+    if (op == "sub")
+    {
+        return float_operation::sub;
+    }
+    if (op == "mul")
+    {
+        return float_operation::mul;
+    }
+    if (op == "div")
+    {
+        return float_operation::div;
+    }
+    if (op == "fma")
+    {
+        return float_operation::fma;
+    }
+    if (op == "sqrt")
+    {
+        throw std::invalid_argument("floating_point does not provide a square root yet");
+    }
+    throw std::invalid_argument("Unknown operation " + op);
+}
+
+template <size_t E, size_t M> struct format
+{
+    static constexpr size_t width = 1 + E + M;
+    static constexpr uint64_t sign_mask = uint64_t{1} << (E + M);
+    static constexpr uint64_t exponent_mask = ((uint64_t{1} << E) - 1U) << M;
+    static constexpr uint64_t fraction_mask = (uint64_t{1} << M) - 1U;
+    static constexpr int64_t bias = (int64_t{1} << (E - 1)) - 1;
+
+    static_assert(width <= 64, "The bit patterns have to fit into 64 bits");
+
+    [[nodiscard]] static constexpr bool is_nan(const uint64_t bits)
+    {
+        return (bits & exponent_mask) == exponent_mask && (bits & fraction_mask) != 0;
+    }
+
+    [[nodiscard]] static floating_point<E, M> to_float(const uint64_t bits)
+    {
+        word_array<width> w;
+        w.set_word(0, bits);
+        return floating_point<E, M>{w};
+    }
 
-static constexpr size_t n_iter = 5;
+    [[nodiscard]] static uint64_t to_bits(const floating_point<E, M>& f)
+    {
+        return as_word_array(f).word(0);
+    }
+};
 
-template <typename F> void check_add()
+/**
+ * @brief Computes the results of the operations on a format using MPFR
+ */
+template <size_t E, size_t M> class mpfr_reference
 {
+public:
+    using fmt = format<E, M>;
+    static constexpr mpfr_prec_t precision = M + 1;
+
+    mpfr_reference()
+        : old_emin(mpfr_get_emin())
+        , old_emax(mpfr_get_emax())
+    {
+        // MPFR stores numbers as 0.1xxx * 2^e, IEEE-754 as 1.xxx * 2^e, and the smallest subnormal
+        // number is 2^(1 - bias - M)
+        mpfr_set_emin(2 - fmt::bias - static_cast<int64_t>(M));
+        mpfr_set_emax(fmt::bias + 1);
+        for (auto& x : operands)
+        {
+            mpfr_init2(x, precision);
+        }
+        mpfr_init2(result, precision);
+        mpz_init(significand);
+    }
+
+    mpfr_reference(const mpfr_reference&) = delete;
+    mpfr_reference& operator=(const mpfr_reference&) = delete;
+
+    ~mpfr_reference()
+    {
+        for (auto& x : operands)
+        {
+            mpfr_clear(x);
+        }
+        mpfr_clear(result);
+        mpz_clear(significand);
+        mpfr_set_emin(old_emin);
+        mpfr_set_emax(old_emax);
+    }
+
+    [[nodiscard]] uint64_t operator()(const float_operation op, const uint64_t a, const uint64_t b,
+                                      const uint64_t c)
+    {
+        set(operands[0], a);
+        set(operands[1], b);
+
+        int ternary = 0;
+        switch (op)
+        {
+        case float_operation::add:
+            ternary = mpfr_add(result, operands[0], operands[1], MPFR_RNDN);
+            break;
+        case float_operation::sub:
+            ternary = mpfr_sub(result, operands[0], operands[1], MPFR_RNDN);
+            break;
+        case float_operation::mul:
+            ternary = mpfr_mul(result, operands[0], operands[1], MPFR_RNDN);
+            break;
+        case float_operation::div:
+            ternary = mpfr_div(result, operands[0], operands[1], MPFR_RNDN);
+            break;
+        case float_operation::fma:
+            set(operands[2], c);
+            ternary = mpfr_fma(result, operands[0], operands[1], operands[2], MPFR_RNDN);
+            break;
+        }
+        mpfr_subnormalize(result, ternary, MPFR_RNDN);
+        return get(result);
+    }
+
+private:
+    std::array<mpfr_t, 3> operands;
+    mpfr_t result;
+    mpz_t significand;
+    mpfr_exp_t old_emin;
+    mpfr_exp_t old_emax;
+
+    static void set(mpfr_ptr x, const uint64_t bits)
+    {
+        const bool negative = (bits & fmt::sign_mask) != 0;
+        const uint64_t exponent = (bits & fmt::exponent_mask) >> M;
+        const uint64_t fraction = bits & fmt::fraction_mask;
+        if ((bits & fmt::exponent_mask) == fmt::exponent_mask)
+        {
+            if (fraction != 0)
+            {
+                mpfr_set_nan(x);
+            }
+            else
+            {
+                mpfr_set_inf(x, negative ? -1 : 1);
+            }
+            return;
+        }
+        if (exponent == 0 && fraction == 0)
+        {
+            mpfr_set_zero(x, negative ? -1 : 1);
+            return;
+        }
+
+        // the value is significand * 2^lsb_exponent, which is set exactly
+        const uint64_t significand = exponent == 0 ? fraction : fraction | (uint64_t{1} << M);
+        const int64_t lsb_exponent = std::max<int64_t>(static_cast<int64_t>(exponent), 1) -
+                                     fmt::bias - static_cast<int64_t>(M);
+        mpfr_set_ui_2exp(x, significand, lsb_exponent, MPFR_RNDN);
+        if (negative)
+        {
+            mpfr_neg(x, x, MPFR_RNDN);
+        }
+    }
+
+    [[nodiscard]] uint64_t get(mpfr_srcptr x)
+    {
+        if (mpfr_nan_p(x))
+        {
+            return fmt::exponent_mask | (uint64_t{1} << (M - 1));
+        }
+        const uint64_t sign = mpfr_signbit(x) ? fmt::sign_mask : 0;
+        if (mpfr_inf_p(x))
+        {
+            return sign | fmt::exponent_mask;
+        }
+        if (mpfr_zero_p(x))
+        {
+            return sign;
+        }
+
+        // x = significand * 2^lsb_exponent where the significand has exactly M + 1 bits
+        const int64_t lsb_exponent = mpfr_get_z_2exp(significand, x);
+        mpz_abs(significand, significand);
+        const uint64_t bits = mpz_get_ui(significand);
+        const int64_t msb_exponent = lsb_exponent + static_cast<int64_t>(M);
+        if (msb_exponent >= 1 - fmt::bias)
+        {
+            const auto exponent = static_cast<uint64_t>(msb_exponent + fmt::bias);
+            return sign | (exponent << M) | (bits & fmt::fraction_mask);
+        }
+        // subnormal: the trailing bits below 2^(1 - bias - M) are zero after subnormalizing
+        const auto shift = static_cast<uint64_t>(1 - fmt::bias - static_cast<int64_t>(M) -
+                                                 lsb_exponent);
+        return sign | (bits >> shift);
+    }
+};
 
-    mpfr_t a_mpfr, b_mpfr, result_mpfr;
-
-    mpfr_init2(a_mpfr, 32);
-    mpfr_init2(b_mpfr, 32);
-    mpfr_init2(result_mpfr, 32);
-
-    F a_native = 4.0f;
-    F b_native = 4.0f;
-
-    mpfr_set_flt(a_mpfr, a_native, MPFR_RNDD);
-    mpfr_set_flt(b_mpfr, b_native, MPFR_RNDD);
-
-    mpfr_out_str(stdout, 10, 0, a_mpfr, MPFR_RNDD);
-
-    mpfr_clear(a_mpfr);
-    mpfr_clear(b_mpfr);
-    mpfr_clear(result_mpfr);
-
-    mpfr_free_cache();
-
-    //    using I = integer<W>;
-    //    static constexpr I aone{I::one()};
-    //    I a{-50};
-    //    I b = mul(div(I::max(), I{3}), I{2});
-    //
-    //    mpz_t a_mpir, b_mpir, result_mpir, aarith_in_mpir;
-    //    mpz_init_set_str(a_mpir, to_decimal(a).c_str(), 10);
-    //    mpz_init_set_str(b_mpir, to_decimal(b).c_str(), 10);
-    //    mpz_init_set_str(result_mpir, "0", 2);
-    //    mpz_init_set_str(aarith_in_mpir, "0", 2);
-    //
-    //    std::cout << "Checking addition for a bit-width of " << W << "..." << std::flush;
-    //
-    //    {
-    //        for (size_t i = 0; i < n_iter + 1; ++i)
-    //        {
-    //            for (size_t j = 0; j < n_iter; ++j)
-    //            {
-    //
-    //                const auto result = expanding_add(a, b);
-    //                mpz_add(result_mpir, a_mpir, b_mpir);
-    //                mpz_init_set_str(aarith_in_mpir, to_decimal(result).c_str(), 10);
-    //
-    //                if (mpz_cmp(result_mpir, aarith_in_mpir) != 0)
-    //                {
-    //                    std::cout << "Addition failed:\n";
-    //                    std::cout << "MPIR:\n";
-    //                    gmp_printf("\ta: %Zd\n", a_mpir);
-    //                    gmp_printf("\tb: %Zd\n", b_mpir);
-    //                    gmp_printf("\ta+b: %Zd\n", result_mpir);
-    //
-    //                    std::cout << "\naarith:\n"
-    //                              << "\ta: " << to_decimal(a) << "\n"
-    //                              << "\tb: " << to_decimal(b) << "\n"
-    //                              << "\ta+b: " << to_decimal(result) << "\n";
-    //                    exit(1);
-    //                }
-    //                b = b + aone;
-    //                mpz_add_ui(b_mpir, b_mpir, 1);
-    //            }
-    //            a = a + aone;
-    //            mpz_add_ui(a_mpir, a_mpir, 1);
-    //        }
-    //    }
-    //
-    //    std::cout << "\t done." << std::endl;
+template <size_t E, size_t M>
+[[nodiscard]] uint64_t aarith_result(const float_operation op, const uint64_t a, const uint64_t b,
+                                     const uint64_t c)
+{
+    using fmt = format<E, M>;
+    const auto x = fmt::to_float(a);
+    const auto y = fmt::to_float(b);
+    switch (op)
+    {
+    case float_operation::add:
+        return fmt::to_bits(add(x, y));
+    case float_operation::sub:
+        return fmt::to_bits(sub(x, y));
+    case float_operation::mul:
+        return fmt::to_bits(mul(x, y));
+    case float_operation::div:
+        return fmt::to_bits(div(x, y));
+    case float_operation::fma:
+    default:
+    {
+        // the product is exact and the sum is rounded once
+        using L = unnormalized_float<E, M, M + 3>;
+        return fmt::to_bits((L{x} * L{y} + L{fmt::to_float(c)}).round());
+    }
+    }
 }
 
-template <size_t W> void check_div()
+/**
+ * @brief The classes of operands of the stratified samples
+ */
+enum class stratum
 {
-    using I = integer<W>;
-    static constexpr I aone{I::one()};
-    I a{-50};
-    I b = mul(div(I::max(), I{3}), I{2});
+    zero,
+    subnormal,
+    normal,
+    near_tie,
+    special,
+    random,
+    // only for the last operand: close to the first operand (or the product) or its negation
+    neighbour
+};
+
+constexpr size_t lhs_strata = 6;
+constexpr size_t last_strata = 7;
 
-    mpz_t a_mpir, b_mpir, result_mpir, aarith_in_mpir;
-    mpz_init_set_str(a_mpir, to_decimal(a).c_str(), 10);
-    mpz_init_set_str(b_mpir, to_decimal(b).c_str(), 10);
-    mpz_init_set_str(result_mpir, "0", 2);
-    mpz_init_set_str(aarith_in_mpir, "0", 2);
+/**
+ * @brief Draws the operands of the stratified samples
+ */
+template <size_t E, size_t M> class stratified_sampler
+{
+public:
+    using fmt = format<E, M>;
+    static constexpr uint64_t neighbourhood = 16;
 
-    std::cout << "Checking division for a bit-width of " << W << "..." << std::flush;
+    template <class Generator>
+    [[nodiscard]] uint64_t operator()(const stratum s, const uint64_t close_to, Generator& g)
     {
-        for (size_t i = 0; i < n_iter; ++i)
+        switch (s)
         {
-            for (size_t j = 0; j < n_iter; ++j)
+        case stratum::zero:
+            return (g() & 1U) != 0 ? fmt::sign_mask : 0;
+        case stratum::subnormal:
+            return to_bits(subnormals.random_bits(g));
+        case stratum::normal:
+            return to_bits(normals.random_bits(g));
+        case stratum::near_tie:
+            return to_bits(ties.random_bits(g));
+        case stratum::special:
+            return to_bits(specials.random_bits(g));
+        case stratum::neighbour:
+            if (!fmt::is_nan(close_to))
             {
+                const uint64_t center = close_to ^ ((g() & 1U) != 0 ? fmt::sign_mask : 0);
+                floating_point_distribution<E, M, FloatGenerationModes::UlpNeighbourhood>
+                    neighbours{fmt::to_float(center), neighbourhood};
+                return to_bits(neighbours.random_bits(g));
+            }
+            return to_bits(random.random_bits(g));
+        case stratum::random:
+        default:
+            return to_bits(random.random_bits(g));
+        }
+    }
+
+private:
+    template <FloatGenerationModes Mode>
+    using distribution = floating_point_distribution<E, M, Mode>;
+
+    distribution<FloatGenerationModes::DenormalizedOnly> subnormals;
+    distribution<FloatGenerationModes::LogUniform> normals;
+    distribution<FloatGenerationModes::NearTie> ties;
+    distribution<FloatGenerationModes::Special> specials;
+    distribution<FloatGenerationModes::FullyRandom> random;
+
+    [[nodiscard]] static uint64_t to_bits(const word_array<fmt::width>& bits)
+    {
+        return bits.word(0);
+    }
+};
+
+/**
+ * @brief The operands with a given index, either all operands in order or stratified samples
+ */
+template <size_t E, size_t M> class operand_source
+{
+public:
+    using fmt = format<E, M>;
+
+    operand_source(const float_operation op, const bool exhaustive, const uint64_t samples,
+                   const uint64_t seed)
+        : arity(op == float_operation::fma ? 3 : 2)
+        , exhaustive(exhaustive)
+        , samples(samples)
+        , seed(seed)
+        , combinations(arity == 3 ? lhs_strata * lhs_strata * last_strata
+                                  : lhs_strata * last_strata)
+    {
+        if (exhaustive && arity * fmt::width >= 64)
+        {
+            throw std::invalid_argument("The format is too large to be checked exhaustively");
+        }
+        if (!exhaustive && samples > UINT64_MAX / combinations)
+        {
+            throw std::invalid_argument("Too many samples");
+        }
+    }
+
+    [[nodiscard]] uint64_t size() const
+    {
+        return exhaustive ? uint64_t{1} << (arity * fmt::width) : samples * combinations;
+    }
+
+    /**
+     * @brief Returns the operands of the chunk starting at index first
+     */
+    class chunk
+    {
+    public:
+        chunk(const operand_source& source, const uint64_t first)
+            : source(source)
+            , index(first)
+            , rng(source.seed, first)
+        {
+        }
 
+        void next(std::array<uint64_t, 3>& operands)
+        {
+            if (source.exhaustive)
+            {
+                constexpr uint64_t mask = UINT64_MAX >> (64U - fmt::width);
+                operands[0] = (index >> ((source.arity - 1) * fmt::width)) & mask;
+                operands[1] = (index >> ((source.arity - 2) * fmt::width)) & mask;
+                operands[2] = source.arity == 3 ? index & mask : 0;
+            }
+            else
+            {
+                // consecutive samples belong to different combinations of strata
+                uint64_t combination = index % source.combinations;
+                const auto last = static_cast<stratum>(combination % last_strata);
+                combination /= last_strata;
+                operands[0] = sampler(static_cast<stratum>(combination % lhs_strata), 0, rng);
+                if (source.arity == 3)
                 {
-                    const auto result = div(a, b);
-                    mpz_tdiv_q(result_mpir, a_mpir, b_mpir);
-                    mpz_init_set_str(aarith_in_mpir, to_decimal(result).c_str(), 10);
-
-                    if (mpz_cmp(result_mpir, aarith_in_mpir) != 0)
-                    {
-                        std::cout << "Division failed:\n";
-                        std::cout << "MPIR:\n";
-                        gmp_printf("\ta: %Zd\n", a_mpir);
-                        gmp_printf("\tb: %Zd\n", b_mpir);
-                        gmp_printf("\ta/b: %Zd\n", result_mpir);
-
-                        std::cout << "\naarith:\n"
-                                  << "\ta: " << to_decimal(a) << "\n"
-                                  << "\tb: " << to_decimal(b) << "\n"
-                                  << "\ta/b: " << to_decimal(result) << "\n";
-                        exit(1);
-                    }
+                    operands[1] = sampler(static_cast<stratum>(combination / lhs_strata), 0, rng);
+                    const auto product =
+                        fmt::to_bits(mul(fmt::to_float(operands[0]), fmt::to_float(operands[1])));
+                    operands[2] = sampler(last, product ^ fmt::sign_mask, rng);
                 }
+                else
                 {
-                    const auto result = div(b, a);
-                    mpz_tdiv_q(result_mpir, b_mpir, a_mpir);
-                    mpz_init_set_str(aarith_in_mpir, to_decimal(result).c_str(), 10);
-
-                    if (mpz_cmp(result_mpir, aarith_in_mpir) != 0)
-                    {
-                        std::cout << "Division failed:\n";
-                        std::cout << "MPIR:\n";
-                        gmp_printf("\ta: %Zd\n", a_mpir);
-                        gmp_printf("\tb: %Zd\n", b_mpir);
-                        gmp_printf("\tb/a: %Zd\n", result_mpir);
-
-                        std::cout << "\naarith:\n"
-                                  << "\ta: " << to_decimal(a) << "\n"
-                                  << "\tb: " << to_decimal(b) << "\n"
-                                  << "\tb/a: " << to_decimal(result) << "\n";
-                        exit(1);
-                    }
+                    operands[1] = sampler(last, operands[0], rng);
+                    operands[2] = 0;
                 }
-                b = b + aone;
-                mpz_add_ui(b_mpir, b_mpir, 1);
             }
-            a = a + aone;
-            mpz_add_ui(a_mpir, a_mpir, 1);
+            ++index;
+        }
+
+    private:
+        const operand_source& source;
+        uint64_t index;
+        // every chunk uses its own stream, so the samples do not depend on the threads
+        philox4x64 rng;
+        stratified_sampler<E, M> sampler;
+    };
+
+    const uint32_t arity;
+
+private:
+    bool exhaustive;
+    uint64_t samples;
+    uint64_t seed;
+    uint64_t combinations;
+};
+
+template <size_t E, size_t M>
+uint64_t check_chunk(const float_operation op, const operand_source<E, M>& source,
+                     const uint64_t first, uint64_t count,
+                     std::vector<mismatch_record>& mismatches)
+{
+    using fmt = format<E, M>;
+    constexpr size_t batch_size = 256;
+
+    std::array<std::array<uint64_t, 3>, batch_size> operands{};
+    std::array<uint64_t, batch_size> actual{};
+    std::array<uint64_t, batch_size> expected{};
+    mpfr_reference<E, M> reference;
+    typename operand_source<E, M>::chunk chunk{source, first};
+
+    uint64_t checked = 0;
+    while (count > 0)
+    {
+        const size_t n = std::min<uint64_t>(batch_size, count);
+        for (size_t k = 0; k < n; ++k)
+        {
+            chunk.next(operands[k]);
+        }
+        for (size_t k = 0; k < n; ++k)
+        {
+            const auto& [a, b, c] = operands[k];
+            actual[k] = aarith_result<E, M>(op, a, b, c);
+        }
+        for (size_t k = 0; k < n; ++k)
+        {
+            const auto& [a, b, c] = operands[k];
+            expected[k] = reference(op, a, b, c);
+        }
+        for (size_t k = 0; k < n; ++k)
+        {
+            const bool both_nan = fmt::is_nan(actual[k]) && fmt::is_nan(expected[k]);
+            if (actual[k] != expected[k] && !both_nan)
+            {
+                const auto& [a, b, c] = operands[k];
+                mismatches.push_back({a, b, c, expected[k], actual[k]});
+            }
         }
+        count -= n;
+        checked += n;
+    }
+    return checked;
+}
+
+template <size_t E, size_t M> int check_format(const options& opts)
+{
+    const float_operation op = parse_operation(opts.op);
+    const bool exhaustive = opts.mode == "exhaustive";
+    const operand_source<E, M> source{op, exhaustive, opts.samples, opts.seed};
+
+    std::string parameters = "mode=" + opts.mode;
+    if (!exhaustive)
+    {
+        parameters += " samples=" + std::to_string(opts.samples) +
+                      " seed=" + std::to_string(opts.seed);
     }
-    std::cout << "\t done." << std::endl;
+    return run_check(
+        opts.sharding,
+        "floating_point" + std::to_string(E) + "_" + std::to_string(M) + "_" + opts.op + "_mpfr",
+        parameters, operand_kind::floating_point, format<E, M>::width, source.size(),
+        source.arity,
+        [&](const uint64_t first, const uint64_t count, std::vector<mismatch_record>& mismatches) {
+            return check_chunk<E, M>(op, source, first, count, mismatches);
+        });
 }
 
-int main()
+int check(const options& opts)
 {
+    const auto is = [&](const size_t e, const size_t m) {
+        return opts.exponent_width == e && opts.mantissa_width == m;
+    };
+    if (is(3, 2))
+    {
+        return check_format<3, 2>(opts);
+    }
+    if (is(4, 3))
+    {
+        return check_format<4, 3>(opts);
+    }
+    if (is(5, 2))
+    {
+        return check_format<5, 2>(opts);
+    }
+    if (is(5, 10))
+    {
+        return check_format<5, 10>(opts);
+    }
+    if (is(8, 7))
+    {
+        return check_format<8, 7>(opts);
+    }
+    if (is(8, 23))
+    {
+        return check_format<8, 23>(opts);
+    }
+    if (is(11, 52))
+    {
+        return check_format<11, 52>(opts);
+    }
+    throw std::invalid_argument("Unsupported format");
+}
+
+} // namespace
 
-    check_add<float>();
-    //    check_add<double>();
-    //    check_add<512>();
-    //    check_add<1024>();
-    //
-    //    check_sub<128>();
-    //    check_sub<256>();
-    //    check_sub<512>();
-    //    check_sub<1024>();
-    //
-    //    check_mul<128>();
-    //    check_mul<256>();
-    //    check_mul<512>();
-    //    check_mul<1024>();
-    //
-    //    check_div<128>();
-    //    check_div<256>();
-    //    check_div<512>();
-    //    check_div<1024>();
-    //
-    //    check_mod<128>();
-    //    check_mod<256>();
-    //    check_mod<512>();
-    //    check_mod<1024>();
-    return 0;
-}
\ No newline at end of file
+int main(const int argc, char** argv)
+{
+    try
+    {
+        const options opts = parse_options(argc, argv);
+        if (!opts.sharding.dump_path.empty())
+        {
+            return dump_mismatch_report(opts.sharding.dump_path);
+        }
+        const int status = check(opts);
+        mpfr_free_cache();
+        return status;
+    }
+    catch (const std::invalid_argument& e)
+    {
+        std::cerr << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+}
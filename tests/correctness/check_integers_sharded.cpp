@@ -0,0 +1,498 @@
+#include "int_correctness_check_fun.hpp"
+#include "sharded_check.hpp"
+
+#include <aarith/integer.hpp>
+
+#ifdef AARITH_HAVE_MPIR
+#include <mpir.h>
+#endif
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * A correctness check of the integer operations that distributes the pairs of operands among
+ * processes (shards) and threads. The operand space of 32 bit operations has 2^64 pairs, which
+ * takes years even on many cores, so it has to be sampled using strides. A core checks about 10^8
+ * additions per second, so on a machine with 64 cores
+ *
+ *   check_integers_sharded --type uinteger --width 32 --op add --rhs-stride 65537
+ *
+ * checks every left operand against every 65537th right operand (2^48 pairs) overnight. Running
+ * the same command again resumes the check from its checkpoint. Mismatches are written to a binary
+ * report that can be printed using --dump.
+ */
+
+using namespace aarith;
+using namespace aarith::correctness;
+
+namespace {
+
+struct options
+{
+    std::string type{"uinteger"};
+    size_t width{8};
+    size_t word{64};
+    std::string op{"add"};
+    std::string reference{"native"};
+    uint64_t lhs_stride{1};
+    uint64_t rhs_stride{1};
+    shard_options sharding;
+};
+
+void print_usage()
+{
+    std::cerr << "usage: check_integers_sharded [options]\n"
+                 "  --type uinteger|integer    the type to check (default uinteger)\n"
+                 "  --width 8|16|32            the width of the integers (default 8)\n"
+                 "  --word 8|16|32|64          the width of the words (default 64)\n"
+                 "  --op NAME                  add, sub, mul, div or mod, additionally schoolbook\n"
+                 "                             and karazuba (uinteger) or booth, naive and\n"
+                 "                             inplace (integer) multiplication (default add)\n"
+                 "  --reference native|mpir    the reference results (default native)\n"
+                 "  --lhs-stride S             check every S-th left operand (default 1)\n"
+                 "  --rhs-stride S             check every S-th right operand (default 1)\n"
+              << shard_options::usage;
+}
+
+options parse_options(const int argc, char** argv)
+{
+    options opts;
+    for (int i = 1; i < argc; i += 2)
+    {
+        const std::string key{argv[i]};
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument("Missing value of " + key);
+        }
+        const std::string value{argv[i + 1]};
+        if (key == "--type")
+        {
+            opts.type = value;
+        }
+        else if (key == "--width")
+        {
+            opts.width = std::stoul(value);
+        }
+        else if (key == "--word")
+        {
+            opts.word = std::stoul(value);
+        }
+        else if (key == "--op")
+        {
+            opts.op = value;
+        }
+        else if (key == "--reference")
+        {
+            opts.reference = value;
+        }
+        else if (key == "--lhs-stride")
+        {
+            opts.lhs_stride = std::stoull(value);
+        }
+        else if (key == "--rhs-stride")
+        {
+            opts.rhs_stride = std::stoull(value);
+        }
+        else if (!opts.sharding.parse(key, value))
+        {
+            throw std::invalid_argument("Unknown option " + key);
+        }
+    }
+    opts.sharding.validate();
+    if (opts.lhs_stride == 0 || opts.rhs_stride == 0)
+    {
+        throw std::invalid_argument("The strides have to be positive");
+    }
+    return opts;
+}
+
+/**
+ * @brief The operations the results of aarith are compared against
+ */
+enum class reference_operation
+{
+    add,
+    sub,
+    mul,
+    div,
+    mod
+};
+
+template <size_t W> [[nodiscard]] constexpr uint64_t truncate(const uint64_t bits)
+{
+    return W == 64 ? bits : bits & ((uint64_t{1} << W) - 1U);
+}
+
+template <size_t W> [[nodiscard]] constexpr int64_t sign_extend(const uint64_t bits)
+{
+    return static_cast<int64_t>(bits << (64U - W)) >> (64U - W);
+}
+
+template <class Integer> [[nodiscard]] Integer from_bits(const uint64_t bits)
+{
+    Integer number;
+    for (size_t i = 0; i < Integer::word_count(); ++i)
+    {
+        number.set_word(
+            i, static_cast<typename Integer::word_type>(bits >> (i * Integer::word_width())));
+    }
+    return number;
+}
+
+template <class Integer> [[nodiscard]] uint64_t to_bits(const Integer& number)
+{
+    uint64_t bits = 0;
+    for (size_t i = 0; i < Integer::word_count(); ++i)
+    {
+        bits |= static_cast<uint64_t>(number.word(i)) << (i * Integer::word_width());
+    }
+    return bits;
+}
+
+/**
+ * @brief Computes the results using 64 bit integers, the widths checked are at most 32 bits, so
+ * no operation overflows
+ */
+template <reference_operation Op, bool Signed, size_t W> struct native_reference
+{
+    static_assert(W <= 32, "The products of the operands have to fit into 64 bits");
+
+    [[nodiscard]] uint64_t operator()(const uint64_t a_bits, const uint64_t b_bits) const
+    {
+        using T = std::conditional_t<Signed, int64_t, uint64_t>;
+        const T a = Signed ? static_cast<T>(sign_extend<W>(a_bits)) : static_cast<T>(a_bits);
+        const T b = Signed ? static_cast<T>(sign_extend<W>(b_bits)) : static_cast<T>(b_bits);
+
+        T result;
+        if constexpr (Op == reference_operation::add)
+        {
+            result = a + b;
+        }
+        else if constexpr (Op == reference_operation::sub)
+        {
+            result = a - b;
+        }
+        else if constexpr (Op == reference_operation::mul)
+        {
+            result = a * b;
+        }
+        else if constexpr (Op == reference_operation::div)
+        {
+            result = a / b;
+        }
+        else
+        {
+            result = a % b;
+        }
+        return truncate<W>(static_cast<uint64_t>(result));
+    }
+};
+
+#ifdef AARITH_HAVE_MPIR
+/**
+ * @brief Computes the results using the arbitrary precision integers of MPIR
+ */
+template <reference_operation Op, bool Signed, size_t W> class mpir_reference
+{
+public:
+    static_assert(sizeof(long) == sizeof(int64_t), "mpz_set_si has to accept 64 bit integers");
+
+    mpir_reference()
+    {
+        mpz_inits(a, b, result, nullptr);
+    }
+
+    mpir_reference(const mpir_reference&) = delete;
+    mpir_reference& operator=(const mpir_reference&) = delete;
+
+    ~mpir_reference()
+    {
+        mpz_clears(a, b, result, nullptr);
+    }
+
+    [[nodiscard]] uint64_t operator()(const uint64_t a_bits, const uint64_t b_bits)
+    {
+        if constexpr (Signed)
+        {
+            mpz_set_si(a, sign_extend<W>(a_bits));
+            mpz_set_si(b, sign_extend<W>(b_bits));
+        }
+        else
+        {
+            mpz_set_ui(a, a_bits);
+            mpz_set_ui(b, b_bits);
+        }
+
+        if constexpr (Op == reference_operation::add)
+        {
+            mpz_add(result, a, b);
+        }
+        else if constexpr (Op == reference_operation::sub)
+        {
+            mpz_sub(result, a, b);
+        }
+        else if constexpr (Op == reference_operation::mul)
+        {
+            mpz_mul(result, a, b);
+        }
+        else if constexpr (Op == reference_operation::div)
+        {
+            mpz_tdiv_q(result, a, b);
+        }
+        else
+        {
+            mpz_tdiv_r(result, a, b);
+        }
+
+        // the residue modulo 2^W is the two's complement bit pattern
+        mpz_fdiv_r_2exp(result, result, W);
+        return mpz_get_ui(result);
+    }
+
+private:
+    mpz_t a;
+    mpz_t b;
+    mpz_t result;
+};
+#endif
+
+/**
+ * @brief Checks a chunk of pairs in batches: the operands are collected first, then all results of
+ * aarith are computed and then all reference results
+ */
+template <class Integer, reference_operation Op, class Reference, class Function>
+uint64_t check_chunk(const operand_space& space, const uint64_t first, uint64_t count,
+                     const Function& fun, std::vector<mismatch_record>& mismatches)
+{
+    constexpr size_t W = Integer::width();
+    constexpr bool avoid_zero = Op == reference_operation::div || Op == reference_operation::mod;
+    constexpr size_t batch_size = 256;
+
+    std::array<uint64_t, batch_size> lhs{};
+    std::array<uint64_t, batch_size> rhs{};
+    std::array<uint64_t, batch_size> actual{};
+    std::array<uint64_t, batch_size> expected{};
+    Reference reference;
+
+    uint64_t i = first / space.rhs.count;
+    uint64_t j = first % space.rhs.count;
+    uint64_t checked = 0;
+    while (count > 0)
+    {
+        size_t n = 0;
+        for (; n < batch_size && count > 0; --count)
+        {
+            const uint64_t a = truncate<W>(space.lhs[i]);
+            const uint64_t b = truncate<W>(space.rhs[j]);
+            if (++j == space.rhs.count)
+            {
+                j = 0;
+                ++i;
+            }
+            if (avoid_zero && b == 0)
+            {
+                continue;
+            }
+            lhs[n] = a;
+            rhs[n] = b;
+            ++n;
+        }
+
+        for (size_t k = 0; k < n; ++k)
+        {
+            actual[k] = to_bits(fun(from_bits<Integer>(lhs[k]), from_bits<Integer>(rhs[k])));
+        }
+        for (size_t k = 0; k < n; ++k)
+        {
+            expected[k] = reference(lhs[k], rhs[k]);
+        }
+        for (size_t k = 0; k < n; ++k)
+        {
+            if (actual[k] != expected[k])
+            {
+                mismatches.push_back({lhs[k], rhs[k], 0, expected[k], actual[k]});
+            }
+        }
+        checked += n;
+    }
+    return checked;
+}
+
+[[nodiscard]] operand_set all_operands(const size_t width, const uint64_t stride)
+{
+    const uint64_t values = uint64_t{1} << width;
+    return {0, stride, values / stride + (values % stride != 0 ? 1 : 0)};
+}
+
+template <class Integer, reference_operation Op, class Reference, class Function>
+int check_operation(const options& opts, const Function& fun)
+{
+    constexpr size_t W = Integer::width();
+    using word_type = typename Integer::word_type;
+
+    const operand_space space{all_operands(W, opts.lhs_stride), all_operands(W, opts.rhs_stride)};
+    return run_check(
+        opts.sharding, description<Integer, word_type>(opts.op) + "_" + opts.reference,
+        "lhs-stride=" + std::to_string(opts.lhs_stride) +
+            " rhs-stride=" + std::to_string(opts.rhs_stride),
+        is_unsigned_v<Integer> ? operand_kind::unsigned_integer : operand_kind::signed_integer, W,
+        space.size(), 2,
+        [&](const uint64_t first, const uint64_t count, std::vector<mismatch_record>& mismatches) {
+            return check_chunk<Integer, Op, Reference>(space, first, count, fun, mismatches);
+        });
+}
+
+template <class Integer, reference_operation Op, class Function>
+int check_reference(const options& opts, const Function& fun)
+{
+    constexpr size_t W = Integer::width();
+    constexpr bool is_signed = !is_unsigned_v<Integer>;
+
+    if (opts.reference == "native")
+    {
+        return check_operation<Integer, Op, native_reference<Op, is_signed, W>>(opts, fun);
+    }
+    if (opts.reference == "mpir")
+    {
+#ifdef AARITH_HAVE_MPIR
+        return check_operation<Integer, Op, mpir_reference<Op, is_signed, W>>(opts, fun);
+#else
+        throw std::invalid_argument("The check was built without MPIR");
+#endif
+    }
+    throw std::invalid_argument("Unknown reference " + opts.reference);
+}
+
+template <class Integer> int check_type(const options& opts)
+{
+    using Op = reference_operation;
+    using I = Integer;
+    constexpr size_t W = Integer::width();
+    using word_type = typename Integer::word_type;
+
+    if (opts.op == "add")
+    {
+        return check_reference<I, Op::add>(opts, [](const I& a, const I& b) { return add(a, b); });
+    }
+    if (opts.op == "sub")
+    {
+        return check_reference<I, Op::sub>(opts, [](const I& a, const I& b) { return sub(a, b); });
+    }
+    if (opts.op == "mul")
+    {
+        return check_reference<I, Op::mul>(opts, [](const I& a, const I& b) { return mul(a, b); });
+    }
+    if (opts.op == "div")
+    {
+        return check_reference<I, Op::div>(opts, [](const I& a, const I& b) { return div(a, b); });
+    }
+    if (opts.op == "mod")
+    {
+        return check_reference<I, Op::mod>(opts,
+                                           [](const I& a, const I& b) { return remainder(a, b); });
+    }
+    if constexpr (is_unsigned_v<Integer>)
+    {
+        if (opts.op == "schoolbook")
+        {
+            return check_reference<I, Op::mul>(
+                opts, [](const I& a, const I& b) { return schoolbook_mul(a, b); });
+        }
+        if (opts.op == "karazuba")
+        {
+            return check_reference<I, Op::mul>(
+                opts, [](const I& a, const I& b) { return karazuba<W, word_type>(a, b); });
+        }
+    }
+    else
+    {
+        if (opts.op == "booth")
+        {
+            return check_reference<I, Op::mul>(
+                opts, [](const I& a, const I& b) { return booth_mul<W, word_type>(a, b); });
+        }
+        if (opts.op == "naive")
+        {
+            return check_reference<I, Op::mul>(
+                opts, [](const I& a, const I& b) { return naive_mul<W, word_type>(a, b); });
+        }
+        if (opts.op == "inplace")
+        {
+            return check_reference<I, Op::mul>(opts, [](const I& a, const I& b) {
+                return booth_inplace_mul<W, word_type>(a, b);
+            });
+        }
+    }
+    throw std::invalid_argument("Unknown operation " + opts.op + " of " + opts.type);
+}
+
+template <template <size_t, typename> class I, size_t W> int check_word(const options& opts)
+{
+    switch (opts.word)
+    {
+    case 8:
+        return check_type<I<W, uint8_t>>(opts);
+    case 16:
+        return check_type<I<W, uint16_t>>(opts);
+    case 32:
+        return check_type<I<W, uint32_t>>(opts);
+    case 64:
+        return check_type<I<W, uint64_t>>(opts);
+    default:
+        throw std::invalid_argument("The word width has to be 8, 16, 32 or 64");
+    }
+}
+
+template <template <size_t, typename> class I> int check_width(const options& opts)
+{
+    switch (opts.width)
+    {
+    case 8:
+        return check_word<I, 8>(opts);
+    case 16:
+        return check_word<I, 16>(opts);
+    case 32:
+        return check_word<I, 32>(opts);
+    default:
+        throw std::invalid_argument("The width has to be 8, 16 or 32");
+    }
+}
+
+} // namespace
+
+int main(const int argc, char** argv)
+{
+    try
+    {
+        const options opts = parse_options(argc, argv);
+        if (!opts.sharding.dump_path.empty())
+        {
+            return dump_mismatch_report(opts.sharding.dump_path);
+        }
+        if (opts.type == "uinteger")
+        {
+            return check_width<uinteger>(opts);
+        }
+        if (opts.type == "integer")
+        {
+            return check_width<integer>(opts);
+        }
+        throw std::invalid_argument("The type has to be uinteger or integer");
+    }
+    catch (const std::invalid_argument& e)
+    {
+        std::cerr << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+}
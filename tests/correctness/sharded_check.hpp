@@ -0,0 +1,666 @@
+#pragma once
+
+#include <aarith/core/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Infrastructure of correctness checks that are too large for a single thread: the operand space
+ * is split into chunks, the chunks are distributed among processes (shards) and, within a process,
+ * among the threads of a pool. The progress of a shard is checkpointed so that an interrupted run
+ * resumes where it stopped, and mismatches are written to a compact binary report.
+ */
+namespace aarith::correctness {
+
+/**
+ * @brief The operands first, first + stride, ..., first + (count - 1) * stride as bit patterns
+ */
+struct operand_set
+{
+    uint64_t first{0};
+    uint64_t stride{1};
+    uint64_t count{0};
+
+    [[nodiscard]] uint64_t operator[](const uint64_t index) const
+    {
+        return first + index * stride;
+    }
+};
+
+/**
+ * @brief All pairs (a, b) of two operand sets, the pair with index i is (a[i / |b|], b[i % |b|])
+ */
+struct operand_space
+{
+    operand_set lhs;
+    operand_set rhs;
+
+    [[nodiscard]] uint64_t size() const
+    {
+        if (rhs.count != 0 && lhs.count > UINT64_MAX / rhs.count)
+        {
+            throw std::out_of_range(
+                "The operand space has 2^64 or more pairs, use strides to sample it");
+        }
+        return lhs.count * rhs.count;
+    }
+};
+
+/**
+ * @brief Assigns the chunks of an operand space to a shard
+ *
+ * The operands (pairs, triples etc.) are numbered. Chunk c contains the operands
+ * [c * chunk_size, (c + 1) * chunk_size) and belongs to shard c % shards. Interleaving the chunks
+ * balances operations whose costs depend on the operands.
+ */
+struct shard_plan
+{
+    uint64_t operands{0};
+    uint64_t chunk_size{uint64_t{1} << 20U};
+    uint64_t shard{0};
+    uint64_t shards{1};
+
+    [[nodiscard]] uint64_t chunks() const
+    {
+        return operands / chunk_size + (operands % chunk_size != 0 ? 1 : 0);
+    }
+
+    /**
+     * @brief Returns the number of chunks belonging to the shard
+     */
+    [[nodiscard]] uint64_t local_chunks() const
+    {
+        const uint64_t all = chunks();
+        return all / shards + (shard < all % shards ? 1 : 0);
+    }
+
+    /**
+     * @brief Returns the first operand of the given chunk of the shard
+     */
+    [[nodiscard]] uint64_t first_operand(const uint64_t local_chunk) const
+    {
+        return (shard + local_chunk * shards) * chunk_size;
+    }
+
+    /**
+     * @brief Returns the number of operands of the given chunk of the shard
+     */
+    [[nodiscard]] uint64_t operand_count(const uint64_t local_chunk) const
+    {
+        return std::min(chunk_size, operands - first_operand(local_chunk));
+    }
+};
+
+/**
+ * @brief The state of a shard stored in a checkpoint
+ */
+struct checkpoint_state
+{
+    // all chunks below the watermark have been checked
+    uint64_t watermark{0};
+    // the chunks above the watermark that have been checked as well
+    std::set<uint64_t> finished;
+    // the number of mismatches reported by the checked chunks
+    uint64_t reported{0};
+};
+
+/**
+ * @brief The progress of a shard: the checked chunks and the number of reported mismatches
+ *
+ * The file stores a signature of the check and of the shard, so a checkpoint is never applied to
+ * a different check. It is replaced atomically (written to a temporary file and renamed).
+ */
+class checkpoint
+{
+public:
+    checkpoint(std::string path, std::string signature)
+        : path(std::move(path))
+        , signature(std::move(signature))
+    {
+    }
+
+    /**
+     * @brief Returns the stored state, the empty state if there is no checkpoint file
+     */
+    [[nodiscard]] checkpoint_state load() const
+    {
+        checkpoint_state state;
+        std::ifstream file{path};
+        if (!file)
+        {
+            return state;
+        }
+        std::string header;
+        std::string stored_signature;
+        uint64_t finished = 0;
+        std::getline(file, header);
+        std::getline(file, stored_signature);
+        file >> state.watermark >> state.reported >> finished;
+        for (uint64_t i = 0; i < finished && file; ++i)
+        {
+            uint64_t chunk = 0;
+            file >> chunk;
+            state.finished.insert(chunk);
+        }
+        if (header != magic || !file)
+        {
+            throw std::runtime_error("Malformed checkpoint " + path);
+        }
+        if (stored_signature != signature)
+        {
+            throw std::runtime_error("The checkpoint " + path + " belongs to a different check (" +
+                                     stored_signature + ")");
+        }
+        return state;
+    }
+
+    void store(const checkpoint_state& state) const
+    {
+        const std::string temporary = path + ".tmp";
+        {
+            std::ofstream file{temporary, std::ios::trunc};
+            file << magic << "\n"
+                 << signature << "\n"
+                 << state.watermark << " " << state.reported << " " << state.finished.size();
+            for (const uint64_t chunk : state.finished)
+            {
+                file << " " << chunk;
+            }
+            file << "\n";
+            if (!file.flush())
+            {
+                throw std::runtime_error("Could not write checkpoint " + temporary);
+            }
+        }
+        if (std::rename(temporary.c_str(), path.c_str()) != 0)
+        {
+            throw std::runtime_error("Could not replace checkpoint " + path);
+        }
+    }
+
+private:
+    static constexpr const char* magic = "aarith-checkpoint 2";
+
+    std::string path;
+    std::string signature;
+};
+
+/**
+ * @brief The kind of numbers whose bit patterns are stored in a mismatch report
+ */
+enum class operand_kind : uint32_t
+{
+    unsigned_integer = 0,
+    signed_integer = 1,
+    floating_point = 2
+};
+
+/**
+ * @brief The header of a mismatch report, followed by the records
+ */
+struct mismatch_report_header
+{
+    std::array<char, 8> magic{'A', 'A', 'R', 'M', 'I', 'S', 'M', '1'};
+    operand_kind kind{operand_kind::unsigned_integer};
+    uint32_t width{0};
+    // the number of operands of the operation (two or three)
+    uint32_t arity{2};
+    uint32_t reserved{0};
+    std::array<char, 48> operation{};
+};
+
+/**
+ * @brief A mismatch: the operands, the expected result and the result computed by aarith
+ *
+ * All values are bit patterns (zero-extended to 64 bits), stored in the byte order of the machine
+ * that runs the check. The third operand is zero for binary operations.
+ */
+struct mismatch_record
+{
+    uint64_t lhs;
+    uint64_t rhs;
+    uint64_t third;
+    uint64_t expected;
+    uint64_t actual;
+};
+
+/**
+ * @brief Reads a mismatch report written by mismatch_report
+ */
+inline std::vector<mismatch_record> read_mismatch_report(const std::string& path,
+                                                         mismatch_report_header& header)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != mismatch_report_header{}.magic)
+    {
+        throw std::runtime_error("Malformed mismatch report " + path);
+    }
+    std::vector<mismatch_record> records;
+    mismatch_record record{};
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        records.push_back(record);
+    }
+    return records;
+}
+
+/**
+ * @brief Appends mismatches to a binary report file that is shared by the threads
+ *
+ * The file is created lazily, i.e., only checks that find mismatches leave a report. When an
+ * interrupted run is resumed, the report is first truncated to the mismatches of the chunks in the
+ * checkpoint (@see truncate), so the chunks that are checked again do not repeat their mismatches.
+ */
+class mismatch_report
+{
+public:
+    mismatch_report(std::string path, const operand_kind kind, const uint32_t width,
+                    const std::string& operation, const uint32_t arity = 2)
+        : path(std::move(path))
+    {
+        header.kind = kind;
+        header.width = width;
+        header.arity = arity;
+        std::strncpy(header.operation.data(), operation.c_str(), header.operation.size() - 1);
+    }
+
+    void write(const std::vector<mismatch_record>& records)
+    {
+        if (records.empty())
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!file.is_open())
+        {
+            const bool exists = static_cast<bool>(std::ifstream{path});
+            file.open(path, std::ios::binary | std::ios::app);
+            if (!exists)
+            {
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            }
+        }
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(mismatch_record)));
+        if (!file.flush())
+        {
+            throw std::runtime_error("Could not write mismatch report " + path);
+        }
+        written += records.size();
+    }
+
+    /**
+     * @brief Drops all but the first records of an existing report (removes it if none remain)
+     *
+     * Has to be called before the first write.
+     */
+    void truncate(const uint64_t records)
+    {
+        if (!std::ifstream{path})
+        {
+            return;
+        }
+        if (records == 0)
+        {
+            std::remove(path.c_str());
+            return;
+        }
+        mismatch_report_header existing;
+        auto kept = read_mismatch_report(path, existing);
+        kept.resize(std::min<uint64_t>(records, kept.size()));
+        std::ofstream rewritten{path, std::ios::binary | std::ios::trunc};
+        rewritten.write(reinterpret_cast<const char*>(&existing), sizeof(existing));
+        rewritten.write(reinterpret_cast<const char*>(kept.data()),
+                        static_cast<std::streamsize>(kept.size() * sizeof(mismatch_record)));
+        if (!rewritten.flush())
+        {
+            throw std::runtime_error("Could not truncate mismatch report " + path);
+        }
+        previous = kept.size();
+    }
+
+    /**
+     * @brief Returns the number of records written by this run
+     */
+    [[nodiscard]] uint64_t size() const
+    {
+        return written;
+    }
+
+    /**
+     * @brief Returns the number of records in the file (including those of earlier runs)
+     */
+    [[nodiscard]] uint64_t records() const
+    {
+        return previous + written;
+    }
+
+private:
+    std::string path;
+    mismatch_report_header header;
+    std::ofstream file;
+    std::mutex mutex;
+    uint64_t written{0};
+    uint64_t previous{0};
+};
+
+/**
+ * @brief The outcome of (a part of) a sharded check
+ */
+struct sharded_check_result
+{
+    uint64_t checked{0};
+    uint64_t mismatches{0};
+    uint64_t completed_chunks{0};
+    uint64_t remaining_chunks{0};
+    double seconds{0.0};
+};
+
+/**
+ * @brief Checks the chunks of a shard using the threads of a pool
+ *
+ * The chunks are handed out in ascending order. The finished chunks and the number of reported
+ * mismatches are checkpointed (at most once per `checkpoint_interval`). A resumed run skips the
+ * chunks of the checkpoint and truncates the report to their mismatches, so it repeats at most the
+ * chunks that finished after the last checkpoint, without reporting their mismatches twice.
+ *
+ * @param pool The threads to use
+ * @param plan The chunks of the shard
+ * @param progress The checkpoint of the shard
+ * @param report The report the mismatches are written to
+ * @param check_chunk Checks the operands [first, first + count), appends the mismatches to its
+ * third argument and returns the number of operands checked
+ * @param max_chunks The maximal number of chunks to check in this run (the chunks of the
+ * checkpoint do not count)
+ * @param checkpoint_interval The minimal time between two checkpoints
+ */
+template <class CheckChunk>
+sharded_check_result
+run_sharded_check(thread_pool& pool, const shard_plan& plan, const checkpoint& progress,
+                  mismatch_report& report, CheckChunk check_chunk,
+                  const uint64_t max_chunks = UINT64_MAX,
+                  const std::chrono::steady_clock::duration checkpoint_interval =
+                      std::chrono::seconds{10})
+{
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+
+    const uint64_t local_chunks = plan.local_chunks();
+    const checkpoint_state resumed = progress.load();
+    // the mismatches of chunks that finished after the checkpoint are reported again
+    report.truncate(resumed.reported);
+
+    checkpoint_state state{resumed};
+    const uint64_t first_chunk = std::min(state.watermark, local_chunks);
+    const uint64_t previously_finished = state.finished.size();
+
+    std::atomic<uint64_t> next_chunk{first_chunk};
+    std::atomic<uint64_t> started{0};
+    std::atomic<uint64_t> checked{0};
+    std::mutex progress_mutex;
+    auto last_store = start;
+
+    pool.parallel_for(pool.size(), [&](size_t) {
+        std::vector<mismatch_record> mismatches;
+        for (uint64_t chunk = next_chunk++; chunk < local_chunks; chunk = next_chunk++)
+        {
+            if (resumed.finished.count(chunk) != 0)
+            {
+                continue;
+            }
+            if (started++ >= max_chunks)
+            {
+                break;
+            }
+            mismatches.clear();
+            checked +=
+                check_chunk(plan.first_operand(chunk), plan.operand_count(chunk), mismatches);
+
+            // the chunk and its mismatches become part of the checkpoint together
+            std::lock_guard<std::mutex> lock{progress_mutex};
+            report.write(mismatches);
+            state.finished.insert(chunk);
+            while (!state.finished.empty() && *state.finished.begin() == state.watermark)
+            {
+                state.finished.erase(state.finished.begin());
+                ++state.watermark;
+            }
+            state.reported = report.records();
+            const auto now = clock::now();
+            if (now - last_store >= checkpoint_interval)
+            {
+                progress.store(state);
+                last_store = now;
+                std::cerr << "checked " << state.watermark + state.finished.size() << "/"
+                          << local_chunks << " chunks\n";
+            }
+        }
+    });
+    progress.store(state);
+
+    sharded_check_result result;
+    result.checked = checked;
+    result.mismatches = report.size();
+    result.completed_chunks =
+        state.watermark + state.finished.size() - first_chunk - previously_finished;
+    result.remaining_chunks = local_chunks - state.watermark - state.finished.size();
+    result.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    return result;
+}
+
+/**
+ * @brief The command line options shared by all sharded checks
+ */
+struct shard_options
+{
+    uint64_t shard{0};
+    uint64_t shards{1};
+    size_t threads{0};
+    uint64_t chunk_size{uint64_t{1} << 20U};
+    uint64_t max_chunks{UINT64_MAX};
+    bool resume{true};
+    std::string checkpoint_path;
+    std::string report_path;
+    std::string dump_path;
+
+    static constexpr const char* usage =
+        "  --shard I/N                check the I-th of N shards (default 0/1)\n"
+        "  --threads T                the number of threads (default: all cores)\n"
+        "  --chunk-size S             the number of operands per chunk (default 2^20)\n"
+        "  --max-chunks C             stop after checking C chunks\n"
+        "  --resume yes|no            resume from the checkpoint or start over (default yes)\n"
+        "  --checkpoint FILE          the checkpoint file\n"
+        "                             (default <check>_shard<I>of<N>.checkpoint)\n"
+        "  --report FILE              the mismatch report\n"
+        "                             (default <check>_shard<I>of<N>.mismatches)\n"
+        "  --dump FILE                print a mismatch report and exit\n";
+
+    /**
+     * @brief Parses an option, returns false if the option is not one of the shared options
+     */
+    bool parse(const std::string& key, const std::string& value)
+    {
+        if (key == "--shard")
+        {
+            const auto slash = value.find('/');
+            if (slash == std::string::npos)
+            {
+                throw std::invalid_argument("The shard has to be given as I/N");
+            }
+            shard = std::stoull(value.substr(0, slash));
+            shards = std::stoull(value.substr(slash + 1));
+        }
+        else if (key == "--threads")
+        {
+            threads = std::stoul(value);
+        }
+        else if (key == "--chunk-size")
+        {
+            chunk_size = std::stoull(value);
+        }
+        else if (key == "--max-chunks")
+        {
+            max_chunks = std::stoull(value);
+        }
+        else if (key == "--resume")
+        {
+            if (value != "yes" && value != "no")
+            {
+                throw std::invalid_argument("--resume has to be yes or no");
+            }
+            resume = value == "yes";
+        }
+        else if (key == "--checkpoint")
+        {
+            checkpoint_path = value;
+        }
+        else if (key == "--report")
+        {
+            report_path = value;
+        }
+        else if (key == "--dump")
+        {
+            dump_path = value;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    void validate() const
+    {
+        if (shards == 0 || shard >= shards)
+        {
+            throw std::invalid_argument("The shard has to be in [0, N)");
+        }
+        if (chunk_size == 0)
+        {
+            throw std::invalid_argument("The chunk size has to be positive");
+        }
+    }
+};
+
+/**
+ * @brief Runs the shard of a check given on the command line and prints a summary
+ *
+ * @param opts The options of the shard
+ * @param check The name of the check, the prefix of the default file names
+ * @param parameters The parameters that determine the operands (part of the checkpoint signature)
+ * @param kind The kind of the operands
+ * @param width The width of the operands
+ * @param operands The number of operands (pairs, triples etc.) of the check
+ * @param arity The number of operands of the operation
+ * @param check_chunk Checks the operands [first, first + count) (see run_sharded_check)
+ * @return The exit code: 0 if no mismatches have been found (by any run of the shard), 1 otherwise
+ */
+template <class CheckChunk>
+int run_check(const shard_options& opts, const std::string& check, const std::string& parameters,
+              const operand_kind kind, const size_t width, const uint64_t operands,
+              const uint32_t arity, CheckChunk check_chunk)
+{
+    const std::string shard_name =
+        "_shard" + std::to_string(opts.shard) + "of" + std::to_string(opts.shards);
+    const std::string signature = check + " " + parameters +
+                                  " chunk-size=" + std::to_string(opts.chunk_size) + " shard=" +
+                                  std::to_string(opts.shard) + "/" + std::to_string(opts.shards);
+    const std::string checkpoint_path =
+        opts.checkpoint_path.empty() ? check + shard_name + ".checkpoint" : opts.checkpoint_path;
+    const std::string report_path =
+        opts.report_path.empty() ? check + shard_name + ".mismatches" : opts.report_path;
+
+    if (!opts.resume)
+    {
+        std::remove(checkpoint_path.c_str());
+        std::remove(report_path.c_str());
+    }
+
+    const shard_plan plan{operands, opts.chunk_size, opts.shard, opts.shards};
+    const checkpoint progress{checkpoint_path, signature};
+    mismatch_report report{report_path, kind, static_cast<uint32_t>(width), check, arity};
+    thread_pool pool{opts.threads == 0 ? std::max(1U, std::thread::hardware_concurrency())
+                                       : opts.threads};
+
+    const auto result =
+        run_sharded_check(pool, plan, progress, report, check_chunk, opts.max_chunks);
+
+    std::cout << signature << "\n"
+              << "checked " << result.checked << " operands in " << result.seconds << " s ("
+              << static_cast<double>(result.checked) / result.seconds << " operands/s) using "
+              << pool.size() << " threads\n"
+              << result.completed_chunks << " chunks completed, " << result.remaining_chunks
+              << " of " << plan.local_chunks() << " chunks remaining\n"
+              << result.mismatches << " mismatches found\n";
+
+    // the report is created with the first mismatch, possibly by an earlier run of the shard
+    if (std::ifstream{report_path})
+    {
+        std::cout << "ERROR in " << check << ", see " << report_path << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Prints a mismatch report, integers in decimal and floating-point numbers as bit patterns
+ */
+inline int dump_mismatch_report(const std::string& path)
+{
+    mismatch_report_header header;
+    const auto records = read_mismatch_report(path, header);
+    const auto print = [&](const uint64_t bits) {
+        if (header.kind == operand_kind::signed_integer)
+        {
+            const size_t shift = 64U - header.width;
+            std::cout << (static_cast<int64_t>(bits << shift) >> shift);
+        }
+        else if (header.kind == operand_kind::floating_point)
+        {
+            std::cout << "0x" << std::hex << std::setw(static_cast<int>((header.width + 3) / 4))
+                      << std::setfill('0') << bits << std::dec;
+        }
+        else
+        {
+            std::cout << bits;
+        }
+    };
+
+    std::cout << header.operation.data() << ": " << records.size() << " mismatches\n"
+              << (header.arity == 3 ? "a;b;c;expected;actual\n" : "a;b;expected;actual\n");
+    for (const auto& record : records)
+    {
+        print(record.lhs);
+        std::cout << ";";
+        print(record.rhs);
+        std::cout << ";";
+        if (header.arity == 3)
+        {
+            print(record.third);
+            std::cout << ";";
+        }
+        print(record.expected);
+        std::cout << ";";
+        print(record.actual);
+        std::cout << "\n";
+    }
+    return 0;
+}
+
+} // namespace aarith::correctness
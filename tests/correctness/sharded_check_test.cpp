@@ -0,0 +1,146 @@
+#include "sharded_check.hpp"
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace aarith;
+using namespace aarith::correctness;
+
+namespace {
+
+/**
+ * @brief A check with one known mismatch per chunk (the first operand of the chunk)
+ */
+uint64_t check_with_mismatches(const uint64_t first, const uint64_t count,
+                               std::vector<mismatch_record>& mismatches)
+{
+    mismatches.push_back(mismatch_record{first, 0, 0, first, first + 1});
+    return count;
+}
+
+/**
+ * @brief Returns the first operands of the reported mismatches in ascending order
+ */
+std::vector<uint64_t> reported_operands(const std::string& path)
+{
+    mismatch_report_header header;
+    std::vector<uint64_t> operands;
+    for (const auto& record : read_mismatch_report(path, header))
+    {
+        operands.push_back(record.lhs);
+    }
+    std::sort(operands.begin(), operands.end());
+    return operands;
+}
+
+} // namespace
+
+SCENARIO("Resuming an interrupted sharded check", "[correctness][sharded]")
+{
+    const std::string checkpoint_path = "sharded_check_test.checkpoint";
+    const std::string report_path = "sharded_check_test.mismatches";
+    std::remove(checkpoint_path.c_str());
+    std::remove(report_path.c_str());
+
+    const shard_plan plan{64, 8, 0, 1};
+    const checkpoint progress{checkpoint_path, "test"};
+    const std::vector<uint64_t> all_chunks{0, 8, 16, 24, 32, 40, 48, 56};
+
+    GIVEN("A run that stops after some chunks (--max-chunks)")
+    {
+        thread_pool pool{2};
+        {
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            const auto result =
+                run_sharded_check(pool, plan, progress, report, check_with_mismatches, 3);
+            REQUIRE(result.completed_chunks == 3);
+            REQUIRE(result.remaining_chunks == 5);
+        }
+
+        THEN("The resumed run reports every mismatch exactly once")
+        {
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            const auto result =
+                run_sharded_check(pool, plan, progress, report, check_with_mismatches);
+            CHECK(result.completed_chunks == 5);
+            CHECK(result.remaining_chunks == 0);
+            CHECK(reported_operands(report_path) == all_chunks);
+        }
+    }
+
+    GIVEN("A run that is interrupted while chunks above the watermark have finished")
+    {
+        thread_pool pool{2};
+        {
+            // chunk 0 waits until two later chunks are checked and then fails
+            std::atomic<int> later_chunks{0};
+            const auto interrupted = [&](const uint64_t first, const uint64_t count,
+                                         std::vector<mismatch_record>& mismatches) {
+                if (first == 0)
+                {
+                    while (later_chunks < 2)
+                    {
+                        std::this_thread::yield();
+                    }
+                    throw std::runtime_error("interrupted");
+                }
+                ++later_chunks;
+                return check_with_mismatches(first, count, mismatches);
+            };
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            REQUIRE_THROWS_AS(run_sharded_check(pool, plan, progress, report, interrupted, 3,
+                                                std::chrono::seconds{0}),
+                              std::runtime_error);
+        }
+        REQUIRE(progress.load().finished.size() == 2);
+
+        THEN("The resumed run reports every mismatch exactly once")
+        {
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            const auto result =
+                run_sharded_check(pool, plan, progress, report, check_with_mismatches);
+            CHECK(result.completed_chunks == 6);
+            CHECK(result.remaining_chunks == 0);
+            CHECK(reported_operands(report_path) == all_chunks);
+        }
+    }
+
+    GIVEN("A run that is interrupted before its chunks are checkpointed")
+    {
+        thread_pool pool{1};
+        {
+            const auto interrupted = [](const uint64_t first, const uint64_t count,
+                                        std::vector<mismatch_record>& mismatches) {
+                if (first == 16)
+                {
+                    throw std::runtime_error("interrupted");
+                }
+                return check_with_mismatches(first, count, mismatches);
+            };
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            REQUIRE_THROWS_AS(run_sharded_check(pool, plan, progress, report, interrupted,
+                                                UINT64_MAX, std::chrono::hours{1}),
+                              std::runtime_error);
+            // the mismatches of chunks 0 and 8 are written but not checkpointed
+            REQUIRE(report.records() == 2);
+        }
+
+        THEN("The resumed run reports every mismatch exactly once")
+        {
+            mismatch_report report{report_path, operand_kind::unsigned_integer, 8, "test"};
+            static_cast<void>(
+                run_sharded_check(pool, plan, progress, report, check_with_mismatches));
+            CHECK(reported_operands(report_path) == all_chunks);
+        }
+    }
+
+    std::remove(checkpoint_path.c_str());
+    std::remove(report_path.c_str());
+}
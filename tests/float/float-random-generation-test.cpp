@@ -4,6 +4,12 @@
 #include "../test-signature-ranges.hpp"
 #include "gen_float.hpp"
 
+#include <array>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <vector>
+
 using namespace aarith;
 
 // This test basically checks that the thing compiles...
@@ -28,3 +34,222 @@ TEMPLATE_TEST_CASE_SIG("Generating ten floating points yields ten different resu
         last = curr;
     }
 }
+
+TEMPLATE_TEST_CASE_SIG("The generated numbers belong to their mode",
+                       "[floating_point][utility][random]",
+                       ((size_t E, size_t M, typename WordType), E, M, WordType), (8, 23, uint64_t),
+                       (11, 52, uint64_t), (5, 10, uint64_t), (15, 112, uint64_t))
+{
+    using F = floating_point<E, M, WordType>;
+    using Modes = FloatGenerationModes;
+
+    xoshiro256starstar rng{E * M};
+
+    floating_point_distribution<E, M, Modes::NormalizedOnly, WordType> normalized;
+    floating_point_distribution<E, M, Modes::DenormalizedOnly, WordType> denormalized;
+    floating_point_distribution<E, M, Modes::NormalizedAndSpecial, WordType> normalized_special;
+    floating_point_distribution<E, M, Modes::NonSpecial, WordType> non_special;
+    floating_point_distribution<E, M, Modes::Special, WordType> special;
+    floating_point_distribution<E, M, Modes::LogUniform, WordType> log_uniform;
+
+    size_t negative = 0;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const F n = normalized(rng);
+        REQUIRE(isNormal(n));
+        negative += n.is_negative() ? 1 : 0;
+
+        REQUIRE(denormalized(rng).get_exponent() == F::IntegerExp::zero());
+
+        const F ns = normalized_special(rng);
+        REQUIRE((isNormal(ns) || isInfinite(ns) || isNaN(ns)));
+
+        REQUIRE(isFinite(non_special(rng)));
+
+        const F s = special(rng);
+        REQUIRE((isInfinite(s) || isNaN(s)));
+
+        REQUIRE(isNormal(log_uniform(rng)));
+    }
+    // the sign is a single random bit
+    CHECK(negative > 400);
+    CHECK(negative < 600);
+}
+
+SCENARIO("Generating log-uniformly distributed floating-point numbers",
+         "[floating_point][utility][random]")
+{
+    using F = floating_point<8, 23>;
+    using Exp = F::IntegerExp;
+    using Distribution = floating_point_distribution<8, 23, FloatGenerationModes::LogUniform>;
+
+    GIVEN("A range of binades")
+    {
+        Distribution distribution{Exp{120U}, Exp{123U}};
+        xoshiro256starstar rng;
+
+        THEN("The numbers are distributed evenly among the binades")
+        {
+            std::array<size_t, 4> binades{};
+            for (size_t i = 0; i < 4000; ++i)
+            {
+                const F f = distribution(rng);
+                const auto exponent = f.get_exponent().word(0);
+                REQUIRE(exponent >= 120U);
+                REQUIRE(exponent <= 123U);
+                ++binades[exponent - 120U];
+            }
+            for (const size_t count : binades)
+            {
+                CHECK(count > 850);
+                CHECK(count < 1150);
+            }
+        }
+    }
+
+    GIVEN("Binades that are not normalized")
+    {
+        THEN("The distribution can not be created")
+        {
+            CHECK_THROWS_AS(Distribution(Exp::zero(), Exp{3U}), std::invalid_argument);
+            CHECK_THROWS_AS(Distribution(Exp{3U}, Exp::max()), std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Generating floating-point numbers in the neighbourhood of a number",
+         "[floating_point][utility][random]")
+{
+    using F = floating_point<8, 23>;
+    using Distribution = floating_point_distribution<8, 23, FloatGenerationModes::UlpNeighbourhood>;
+    xoshiro256starstar rng;
+
+    GIVEN("A normalized number")
+    {
+        const F center{1.0F};
+        Distribution distribution{center, 5};
+
+        THEN("The numbers are at most the given number of ULPs away")
+        {
+            std::set<float> values;
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                values.insert(static_cast<float>(distribution(rng)));
+            }
+            // the binade changes at one, i.e., the ULPs below one are half as large
+            CHECK(values.size() == 11);
+            CHECK(*values.begin() == std::nextafter(1.0F, 0.0F) - 4 * std::ldexp(1.0F, -24));
+            CHECK(*values.rbegin() == 1.0F + 5 * std::ldexp(1.0F, -23));
+        }
+    }
+
+    GIVEN("Zero")
+    {
+        Distribution distribution{F::zero(), 2};
+
+        THEN("The neighbourhood extends to both signs")
+        {
+            std::set<float> values;
+            for (size_t i = 0; i < 500; ++i)
+            {
+                const F f = distribution(rng);
+                REQUIRE((isZero(f) || isSubnormal(f)));
+                values.insert(static_cast<float>(f));
+            }
+            CHECK(values.size() == 5);
+        }
+    }
+
+    GIVEN("The largest finite number")
+    {
+        Distribution distribution{F{std::numeric_limits<float>::max()}, 3};
+
+        THEN("The neighbourhood is clamped to infinity")
+        {
+            bool infinity = false;
+            for (size_t i = 0; i < 500; ++i)
+            {
+                const F f = distribution(rng);
+                REQUIRE_FALSE(isNaN(f));
+                infinity = infinity || isInfinite(f);
+            }
+            CHECK(infinity);
+        }
+    }
+
+    GIVEN("NaN")
+    {
+        THEN("The distribution can not be created")
+        {
+            CHECK_THROWS_AS(Distribution(F::NaN(), 1), std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Generating floating-point numbers close to ties", "[floating_point][utility][random]")
+{
+    GIVEN("A distribution of single precision numbers close to the ties of half precision")
+    {
+        floating_point_distribution<8, 23, FloatGenerationModes::NearTie> distribution{13};
+        xoshiro256starstar rng;
+
+        THEN("The rounded away bits are a tie or one ULP away from it")
+        {
+            std::set<uint64_t> patterns;
+            for (size_t i = 0; i < 300; ++i)
+            {
+                const auto f = distribution(rng);
+                REQUIRE(isNormal(f));
+                patterns.insert(f.get_mantissa().word(0) & ((uint64_t{1} << 13U) - 1U));
+            }
+            CHECK(patterns == std::set<uint64_t>{0x0fff, 0x1000, 0x1001});
+        }
+    }
+
+    GIVEN("An invalid number of tie bits")
+    {
+        using Distribution = floating_point_distribution<8, 23, FloatGenerationModes::NearTie>;
+        THEN("The distribution can not be created")
+        {
+            CHECK_THROWS_AS(Distribution(1), std::invalid_argument);
+            CHECK_THROWS_AS(Distribution(24), std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Generating batches of packed floating-point numbers", "[floating_point][utility][random]")
+{
+    GIVEN("Two identically seeded generators")
+    {
+        using F = floating_point<11, 52>;
+        philox4x64 rng_single{7};
+        philox4x64 rng_batch{7};
+
+        THEN("The packed batch contains the encodings of the numbers generated one by one")
+        {
+            floating_point_distribution<11, 52, FloatGenerationModes::NormalizedOnly> distribution;
+            std::vector<word_array<64>> batch(100);
+            distribution.generate_bits(batch.begin(), batch.end(), rng_batch);
+            for (const auto& bits : batch)
+            {
+                REQUIRE(bits == as_word_array(distribution(rng_single)));
+            }
+        }
+        THEN("Fully random numbers are random bits")
+        {
+            floating_point_distribution<11, 52, FloatGenerationModes::FullyRandom> distribution;
+            std::vector<word_array<64>> batch(100);
+            distribution.generate_bits(batch.begin(), batch.end(), rng_batch);
+            for (const auto& bits : batch)
+            {
+                REQUIRE(bits.word(0) == rng_single());
+            }
+            std::vector<F> floats(10);
+            distribution.generate(floats.begin(), floats.end(), rng_batch);
+            for (const auto& f : floats)
+            {
+                REQUIRE(as_word_array(f).word(0) == rng_single());
+            }
+        }
+    }
+}
@@ -174,6 +174,32 @@ TEMPLATE_TEST_CASE_SIG("Floating point addition matches its native counterparts"
     }
 }
 
+TEMPLATE_TEST_CASE_SIG("Floating point addition and subtraction round like their native counterparts",
+                       "[floating_point][arithmetic][addition][subtraction]",
+                       AARITH_FLOAT_TEST_SIGNATURE_WITH_NATIVE_TYPE,
+                       AARITH_FLOAT_TEMPLATE_NATIVE_RANGE_WITH_TYPE)
+{
+    using F = floating_point<E, M>;
+
+    F a = GENERATE(take(100, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+    F b = GENERATE(take(100, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+
+    // force some massive cancellation to exercise the near path
+    const uinteger<M + 1> low_bits{b.get_full_mantissa().word(0) & 0xFFU};
+    F c{a.get_sign(), a.get_exponent(), a.get_full_mantissa() ^ low_bits};
+    c.set_sign(!c.get_sign());
+
+    const Native a_native = static_cast<Native>(a);
+    const Native b_native = static_cast<Native>(b);
+    const Native c_native = static_cast<Native>(c);
+
+    CAPTURE(a, b, c);
+    CHECK(F{a_native + b_native} == a + b);
+    CHECK(F{a_native - b_native} == a - b);
+    CHECK(F{a_native + c_native} == a + c);
+    REQUIRE(F{c_native - a_native} == c - a);
+}
+
 TEMPLATE_TEST_CASE_SIG("Adding to infinity", "[floating_point][arithmetic][addition]",
                        AARITH_FLOAT_TEST_SIGNATURE, AARITH_FLOAT_TEMPLATE_RANGE)
 {
@@ -0,0 +1,161 @@
+#include <aarith/float.hpp>
+
+#include "../test-signature-ranges.hpp"
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+#include <cfenv>
+
+using namespace aarith;
+
+template <class Rounding, int NativeMode, size_t E, size_t M, typename Native>
+void check_rounding_mode(const floating_point<E, M>& a, const floating_point<E, M>& b)
+{
+    using F = floating_point<E, M>;
+
+    // volatile prevents the compiler from evaluating the native operations at compile time
+    volatile Native a_native = static_cast<Native>(a);
+    volatile Native b_native = static_cast<Native>(b);
+
+    std::fesetround(NativeMode);
+    const Native sum = a_native + b_native;
+    const Native difference = a_native - b_native;
+    const Native product = a_native * b_native;
+    const Native quotient = a_native / b_native;
+    std::fesetround(FE_TONEAREST);
+
+    CAPTURE(a, b);
+    CHECK(bit_equal(add<Rounding>(a, b), F{sum}));
+    CHECK(bit_equal(sub<Rounding>(a, b), F{difference}));
+    CHECK(bit_equal(mul<Rounding>(a, b), F{product}));
+    if (!b.is_zero())
+    {
+        REQUIRE(bit_equal(div<Rounding>(a, b), F{quotient}));
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Rounding policies match the native rounding modes",
+                       "[floating_point][arithmetic][rounding]",
+                       AARITH_FLOAT_TEST_SIGNATURE_WITH_NATIVE_TYPE,
+                       AARITH_FLOAT_TEMPLATE_NATIVE_RANGE_WITH_TYPE)
+{
+    using F = floating_point<E, M>;
+
+    F a = GENERATE(take(30, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+    F b = GENERATE(take(30, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+
+    check_rounding_mode<round_to_nearest_even, FE_TONEAREST, E, M, Native>(a, b);
+    check_rounding_mode<round_toward_zero, FE_TOWARDZERO, E, M, Native>(a, b);
+    check_rounding_mode<round_toward_positive, FE_UPWARD, E, M, Native>(a, b);
+    check_rounding_mode<round_toward_negative, FE_DOWNWARD, E, M, Native>(a, b);
+}
+
+SCENARIO("Rounding toward negative infinity produces negative zero on cancellation",
+         "[floating_point][arithmetic][rounding]")
+{
+    using F = floating_point<8, 23>;
+
+    const F one{F::one()};
+
+    REQUIRE(sub<round_toward_negative>(one, one).is_neg_zero());
+    REQUIRE(sub<round_toward_zero>(one, one).is_zero());
+    REQUIRE_FALSE(sub<round_toward_zero>(one, one).get_sign());
+}
+
+SCENARIO("Stochastic rounding", "[floating_point][arithmetic][rounding]")
+{
+    using F = floating_point<8, 23>;
+    using R = round_stochastic<>;
+
+    GIVEN("A sum that lies exactly between two representable numbers")
+    {
+        const F one{F::one()};
+        const F half_ulp{false, uinteger<8>{127U - 24U}, uinteger<24>::msb_one()};
+        const F down{F::one()};
+        const F up = add(one, mul(half_ulp, F{2.0F}));
+
+        THEN("Both neighbours should be hit")
+        {
+            R::seed(42); // NOLINT
+            size_t ups = 0;
+            constexpr size_t samples = 1000;
+            for (size_t i = 0; i < samples; ++i)
+            {
+                const F sum = add<R>(one, half_ulp);
+                CHECK((sum == up || sum == down));
+                ups += (sum == up) ? 1 : 0;
+            }
+            CHECK(ups > samples / 4);
+            REQUIRE(ups < 3 * samples / 4);
+        }
+
+        THEN("The rounding should be reproducible after reseeding")
+        {
+            R::seed(1);
+            const F first = add<R>(one, half_ulp);
+            const F second = add<R>(one, half_ulp);
+            R::seed(1);
+            CHECK(add<R>(one, half_ulp) == first);
+            REQUIRE(add<R>(one, half_ulp) == second);
+        }
+    }
+}
+
+SCENARIO("Special-value policies", "[floating_point][arithmetic][special_values]")
+{
+    using F = floating_point<8, 23>;
+
+    const F largest{false, uinteger<8>{254U}, uinteger<24>::all_ones()};
+    const F smallest_normal{F::smallest_normalized()};
+    const F subnormal{F::smallest_denormalized()};
+
+    GIVEN("Operations that overflow")
+    {
+        THEN("IEEE semantics produce infinity")
+        {
+            CHECK(add<round_to_nearest_even>(largest, largest).is_pos_inf());
+            REQUIRE(mul<round_to_nearest_even>(largest, F{-2.0F}).is_neg_inf());
+        }
+        THEN("Finite-only semantics saturate")
+        {
+            CHECK(add<round_to_nearest_even, finite_only>(largest, largest) == largest);
+            CHECK(mul<round_to_nearest_even, finite_only>(largest, F{-2.0F}) == negate(largest));
+            REQUIRE(div<round_to_nearest_even, finite_only>(F::one(), F::zero()) == largest);
+        }
+        THEN("Directed rounding saturates in the direction of zero")
+        {
+            CHECK(add<round_toward_zero>(largest, largest) == largest);
+            CHECK(mul<round_toward_positive>(largest, F{-2.0F}) == negate(largest));
+            REQUIRE(mul<round_toward_negative>(largest, F{-2.0F}).is_neg_inf());
+        }
+    }
+
+    GIVEN("Subnormal numbers")
+    {
+        THEN("Flushing to zero ignores subnormal inputs")
+        {
+            CHECK(add<round_to_nearest_even, flush_to_zero>(subnormal, subnormal).is_zero());
+            CHECK(mul<round_to_nearest_even, flush_to_zero>(subnormal, F{4.0F}).is_zero());
+            REQUIRE(add<round_to_nearest_even, finite_only_flush_to_zero>(subnormal, F::one()) ==
+                    F::one());
+        }
+        THEN("Flushing to zero replaces subnormal results")
+        {
+            const F half{0.5F};
+            CHECK(mul<round_to_nearest_even>(smallest_normal, half).is_denormalized());
+            CHECK(mul<round_to_nearest_even, flush_to_zero>(smallest_normal, half).is_zero());
+            REQUIRE(div<round_to_nearest_even, flush_to_zero>(negate(smallest_normal), F{2.0F})
+                        .is_neg_zero());
+        }
+    }
+
+    GIVEN("NaN and infinity")
+    {
+        THEN("IEEE semantics are retained by the flushing policy")
+        {
+            CHECK(add<round_to_nearest_even, flush_to_zero>(F::pos_infinity(), F::neg_infinity())
+                      .is_nan());
+            REQUIRE(mul<round_to_nearest_even, flush_to_zero>(F::NaN(), F::one()).is_nan());
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <aarith/float.hpp>
+
+#include "../test-signature-ranges.hpp"
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE_SIG("Accumulating a single product or sum rounds like the native operation",
+                       "[floating_point][arithmetic][kulisch]",
+                       AARITH_FLOAT_TEST_SIGNATURE_WITH_NATIVE_TYPE,
+                       AARITH_FLOAT_TEMPLATE_NATIVE_RANGE_WITH_TYPE)
+{
+    using F = floating_point<E, M>;
+
+    F a = GENERATE(take(40, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+    F b = GENERATE(take(40, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+
+    const Native a_native = static_cast<Native>(a);
+    const Native b_native = static_cast<Native>(b);
+
+    kulisch_accumulator<E, M> product;
+    product.accumulate_product(a, b);
+
+    kulisch_accumulator<E, M> sum;
+    sum.accumulate(a);
+    sum.accumulate(b);
+
+    CAPTURE(a, b);
+    CHECK(product.round() == F{a_native * b_native});
+    REQUIRE(sum.round() == F{a_native + b_native});
+}
+
+SCENARIO("Accumulating values exactly", "[floating_point][arithmetic][kulisch]")
+{
+    using F = floating_point<11, 52>;
+
+    GIVEN("Values that cancel out")
+    {
+        const std::vector<F> values{F{1e300}, F{1.0}, F{-1e300}, F{1e-300}, F{-1e-300}};
+
+        THEN("The small values should survive")
+        {
+            kulisch_accumulator<11, 52> acc;
+            for (const auto& v : values)
+            {
+                acc.accumulate(v);
+            }
+            REQUIRE(acc.round() == F{1.0});
+        }
+    }
+
+    GIVEN("Products that cancel out")
+    {
+        kulisch_accumulator<11, 52> acc;
+        acc.accumulate_product(F{1e300}, F{1e300});
+        acc.accumulate_product(F{3.0}, F{0.5});
+        acc.accumulate_product(F{-1e300}, F{1e300});
+
+        THEN("The result should be exact and can be rounded to any format")
+        {
+            CHECK(acc.round() == F{1.5});
+            REQUIRE(acc.round<8, 23>() == floating_point<8, 23>{1.5F});
+        }
+    }
+
+    GIVEN("Special values")
+    {
+        kulisch_accumulator<11, 52> acc;
+        acc.accumulate(F{1.0});
+
+        WHEN("Adding infinity")
+        {
+            acc.accumulate(F::neg_infinity());
+            THEN("The result should be infinite")
+            {
+                REQUIRE(acc.round().is_neg_inf());
+            }
+            AND_WHEN("Adding infinity of the opposite sign")
+            {
+                acc.accumulate_product(F::pos_infinity(), F{2.0});
+                THEN("The result should be NaN")
+                {
+                    REQUIRE(acc.round().is_nan());
+                }
+            }
+        }
+        WHEN("Multiplying infinity and zero")
+        {
+            acc.accumulate_product(F::pos_infinity(), F::zero());
+            THEN("The result should be NaN")
+            {
+                REQUIRE(acc.round().is_nan());
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Parallel exact dot products do not depend on the number of threads",
+                       "[floating_point][arithmetic][kulisch]", AARITH_FLOAT_TEST_SIGNATURE,
+                       (8, 23), (11, 52))
+{
+    using F = floating_point<E, M>;
+
+    std::mt19937 rng{std::random_device{}()};
+    floating_point_distribution<E, M> distribution;
+
+    // long enough for four threads
+    const size_t length = 4 * kulisch_min_length_per_thread + 100;
+    std::vector<F> a;
+    std::vector<F> b;
+    for (size_t i = 0; i < length; ++i)
+    {
+        a.push_back(distribution(rng));
+        b.push_back(distribution(rng));
+    }
+
+    thread_pool serial{1};
+    thread_pool three{3};
+    thread_pool four{4};
+
+    const auto sequential = exact_dot_product<E, M>(a.begin(), a.end(), b.begin(), serial);
+    const auto parallel = exact_dot_product<E, M>(a.begin(), a.end(), b.begin(), four);
+
+    CHECK(sequential.get_register() == parallel.get_register());
+    REQUIRE(bit_equal(sequential.round(), parallel.round()));
+
+    const auto sum_sequential = exact_sum<E, M>(a.begin(), a.end(), serial);
+    const auto sum_parallel = exact_sum<E, M>(a.begin(), a.end(), three);
+    REQUIRE(sum_sequential.get_register() == sum_parallel.get_register());
+
+    // short inputs are accumulated by the calling thread only
+    const auto short_sequential = exact_sum<E, M>(a.begin(), a.begin() + 200, serial);
+    const auto short_parallel = exact_sum<E, M>(a.begin(), a.begin() + 200, four);
+    REQUIRE(short_sequential.get_register() == short_parallel.get_register());
+}
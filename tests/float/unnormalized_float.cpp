@@ -0,0 +1,132 @@
+#include <aarith/float.hpp>
+
+#include "../test-signature-ranges.hpp"
+#include "gen_float.hpp"
+
+#include <catch.hpp>
+#include <cmath>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE_SIG("Single operations on unnormalized floats round like the native ones",
+                       "[floating_point][arithmetic][unnormalized]",
+                       AARITH_FLOAT_TEST_SIGNATURE_WITH_NATIVE_TYPE,
+                       AARITH_FLOAT_TEMPLATE_NATIVE_RANGE_WITH_TYPE)
+{
+    using F = floating_point<E, M>;
+    using L = unnormalized_float<E, M>;
+
+    F a = GENERATE(take(50, random_float<E, M, FloatGenerationModes::FullyRandom>()));
+    F b = GENERATE(take(50, random_float<E, M, FloatGenerationModes::FullyRandom>()));
+
+    const Native a_native = static_cast<Native>(a);
+    const Native b_native = static_cast<Native>(b);
+
+    const F sum = L{a} + L{b};
+    const F difference = L{a} - L{b};
+    const F product = L{a} * L{b};
+
+    CAPTURE(a, b, sum, difference, product);
+    if (a.is_nan() || b.is_nan())
+    {
+        CHECK(sum.is_nan());
+        CHECK(difference.is_nan());
+        REQUIRE(product.is_nan());
+    }
+    else
+    {
+        CHECK(bit_equal(sum, F{a_native + b_native}));
+        CHECK(bit_equal(difference, F{a_native - b_native}));
+        REQUIRE(bit_equal(product, F{a_native * b_native}));
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Chained operations on unnormalized floats are rounded only once",
+                       "[floating_point][arithmetic][unnormalized]",
+                       AARITH_FLOAT_TEST_SIGNATURE_WITH_NATIVE_TYPE,
+                       AARITH_FLOAT_TEMPLATE_NATIVE_RANGE_WITH_TYPE)
+{
+    using F = floating_point<E, M>;
+    using L = unnormalized_float<E, M, M + 3>;
+
+    F a = GENERATE(take(30, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+    F b = GENERATE(take(30, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+    F c = GENERATE(take(10, random_float<E, M, FloatGenerationModes::NonSpecial>()));
+
+    WHEN("Computing a*b+c")
+    {
+        THEN("The result should be that of a fused multiply-add")
+        {
+            const Native expected = std::fma(static_cast<Native>(a), static_cast<Native>(b),
+                                             static_cast<Native>(c));
+            const F fused = L{a} * L{b} + L{c};
+
+            CAPTURE(a, b, c, fused, expected);
+            if (std::isnan(expected))
+            {
+                REQUIRE(fused.is_nan());
+            }
+            else
+            {
+                REQUIRE(bit_equal(fused, F{expected}));
+            }
+        }
+    }
+}
+
+SCENARIO("Special values in unnormalized floats", "[floating_point][arithmetic][unnormalized]")
+{
+    using F = floating_point<8, 23>;
+    using L = unnormalized_float<8, 23>;
+
+    GIVEN("Infinity and zero")
+    {
+        const L inf{F::pos_infinity()};
+        const L zero{F::zero()};
+        const L one{F::one()};
+
+        THEN("The IEEE 754 rules should be followed")
+        {
+            CHECK(F{inf * zero}.is_nan());
+            CHECK(F{inf - inf}.is_nan());
+            CHECK(F{inf + one}.is_pos_inf());
+            CHECK(F{one - one} == F::zero());
+            CHECK_FALSE(F{one - one}.get_sign());
+            REQUIRE(F{-zero + -zero}.get_sign());
+        }
+    }
+
+    GIVEN("A chain that overflows in between")
+    {
+        const F largest{false, uinteger<8>{254U}, uinteger<24>::all_ones()};
+        const L big{largest};
+        const L two{F{2.0F}};
+
+        THEN("The result is only rounded at the end and therefore does not overflow")
+        {
+            const F result = big * two - big;
+            REQUIRE(result == largest);
+        }
+    }
+}
+
+SCENARIO("Fused multiply-adds whose addend cancels the leading bit of the product",
+         "[floating_point][arithmetic][unnormalized]")
+{
+    GIVEN("The tiny floats with E = 3 and M = 2")
+    {
+        using F = floating_point<3, 2>;
+        using L = unnormalized_float<3, 2, 2 + 3>;
+
+        const F a{false, uinteger<3>{1U}, uinteger<2>{1U}};
+        const F b{false, uinteger<3>{3U}, uinteger<2>{3U}};
+        const F c{true, uinteger<3>{3U}, uinteger<2>{0U}};
+
+        THEN("a*b+c should be rounded once")
+        {
+            // 0.3125 * 1.75 - 1 = -0.453125 lies below the midpoint of -0.4375 and -0.5
+            const F expected{true, uinteger<3>{1U}, uinteger<2>{3U}};
+            REQUIRE(bit_equal(F{L{a} * L{b} + L{c}}, expected));
+        }
+    }
+}
@@ -0,0 +1,206 @@
+#include <catch.hpp>
+
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+
+#include <sstream>
+
+using namespace aarith;
+
+TEMPLATE_TEST_CASE_SIG("Runtime-width unsigned integers match the fixed-width unsigned integers",
+                       "[integer][unsigned][dynamic]", ((size_t W), W), 8, 64, 65, 150, 256, 257,
+                       1000)
+{
+    using U = uinteger<W, uint64_t>;
+    using namespace integer_operators;
+
+    const U a = GENERATE(take(15, random_uinteger<W, uint64_t>()));
+    const U b = GENERATE(take(5, random_uinteger<W, uint64_t>()));
+
+    const dyn_uinteger a_{a};
+    const dyn_uinteger b_{b};
+
+    THEN("The bits are the same")
+    {
+        CHECK(a_.width() == W);
+        CHECK(a_.word_count() == U::word_count());
+        CHECK(static_cast<U>(a_) == a);
+        for (size_t i = 0; i < W; ++i)
+        {
+            CHECK(a_.bit(i) == a.bit(i));
+        }
+    }
+
+    THEN("The arithmetic results are the same")
+    {
+        CHECK(static_cast<U>(a_ + b_) == add(a, b));
+        CHECK(static_cast<U>(a_ - b_) == sub(a, b));
+        CHECK(static_cast<U>(a_ * b_) == mul(a, b));
+        if (!b.is_zero())
+        {
+            CHECK(static_cast<U>(a_ / b_) == div(a, b));
+            CHECK(static_cast<U>(a_ % b_) == remainder(a, b));
+        }
+
+        dyn_uinteger x{a_};
+        x += b_;
+        CHECK(static_cast<U>(x) == add(a, b));
+        x -= b_;
+        CHECK(x == a_);
+        x *= b_;
+        CHECK(static_cast<U>(x) == mul(a, b));
+    }
+
+    THEN("Comparisons, shifts and bitwise operations are the same")
+    {
+        CHECK((a_ < b_) == (a < b));
+        CHECK((a_ == b_) == (a == b));
+        CHECK((a_ >= b_) == (a >= b));
+
+        for (const size_t shift : {size_t{0}, size_t{1}, size_t{63}, size_t{64}, W - 1, W, W + 5})
+        {
+            CHECK(static_cast<U>(a_ << shift) == (a << shift));
+            CHECK(static_cast<U>(a_ >> shift) == (a >> shift));
+        }
+
+        CHECK(static_cast<U>(a_ & b_) == (a & b));
+        CHECK(static_cast<U>(a_ | b_) == (a | b));
+        CHECK(static_cast<U>(a_ ^ b_) == (a ^ b));
+        CHECK(static_cast<U>(~a_) == ~a);
+        CHECK(count_leading_zeroes(a_) == count_leading_zeroes(a));
+    }
+
+    THEN("The string representations are the same")
+    {
+        CHECK(to_decimal(a_) == to_decimal(a));
+        CHECK(to_binary(a_) == to_binary(a));
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Runtime-width signed integers match the fixed-width signed integers",
+                       "[integer][signed][dynamic]", ((size_t W), W), 8, 64, 65, 150, 256, 257,
+                       1000)
+{
+    using I = integer<W, uint64_t>;
+    using namespace integer_operators;
+
+    const I a = GENERATE(take(15, random_integer<W, uint64_t>()));
+    const I b = GENERATE(take(5, random_integer<W, uint64_t>()));
+
+    const dyn_integer a_{a};
+    const dyn_integer b_{b};
+
+    THEN("The bits are the same")
+    {
+        CHECK(static_cast<I>(a_) == a);
+        CHECK(a_.is_negative() == a.is_negative());
+    }
+
+    THEN("The arithmetic results are the same")
+    {
+        CHECK(static_cast<I>(a_ + b_) == add(a, b));
+        CHECK(static_cast<I>(a_ - b_) == sub(a, b));
+        CHECK(static_cast<I>(a_ * b_) == mul(a, b));
+        CHECK(static_cast<I>(-a_) == -a);
+        CHECK(static_cast<I>(abs(a_)) == abs(a));
+        if (!b.is_zero() && !(a == I::min() && b == I::minus_one()))
+        {
+            CHECK(static_cast<I>(a_ / b_) == div(a, b));
+            CHECK(static_cast<I>(a_ % b_) == remainder(a, b));
+        }
+    }
+
+    THEN("Comparisons and shifts are the same")
+    {
+        CHECK((a_ < b_) == (a < b));
+        CHECK((a_ > b_) == (a > b));
+        CHECK((a_ == b_) == (a == b));
+
+        for (const size_t shift : {size_t{0}, size_t{1}, size_t{63}, size_t{64}, W - 1, W, W + 5})
+        {
+            CHECK(static_cast<I>(a_ << shift) == (a << shift));
+            CHECK(static_cast<I>(a_ >> shift) == (a >> shift));
+        }
+    }
+
+    THEN("The casts are the same")
+    {
+        CHECK(static_cast<integer<2 * W, uint64_t>>(width_cast(a_, 2 * W)) ==
+              width_cast<2 * W>(a));
+        CHECK(static_cast<integer<W / 2, uint64_t>>(width_cast(a_, W / 2)) ==
+              width_cast<W / 2>(a));
+    }
+
+    THEN("The string representations are the same")
+    {
+        CHECK(to_decimal(a_) == to_decimal(a));
+    }
+}
+
+SCENARIO("Constructing runtime-width integers", "[integer][dynamic]")
+{
+    using namespace integer_operators;
+
+    GIVEN("Small values")
+    {
+        const dyn_integer a{100, -5};
+        const dyn_integer b{100, 3};
+
+        THEN("They are sign-extended to the width")
+        {
+            CHECK(static_cast<integer<100>>(a) == integer<100>{-5});
+            CHECK(to_decimal(a) == "-5");
+            CHECK(to_decimal(a / b) == "-1");
+            CHECK(to_decimal(a % b) == "-2");
+            CHECK(dyn_integer::max(100) > dyn_integer::min(100));
+            CHECK(dyn_uinteger::max(100) == static_cast<dyn_uinteger>(uinteger<100>::max()));
+        }
+    }
+
+    GIVEN("Integers of different widths")
+    {
+        const dyn_uinteger a{64, 1U};
+        const dyn_uinteger b{65, 1U};
+
+        THEN("Operations on them throw")
+        {
+            CHECK_THROWS_AS(a + b, std::invalid_argument);
+            CHECK_THROWS_AS(a < b, std::invalid_argument);
+            CHECK_THROWS_AS(static_cast<uinteger<65>>(a), std::invalid_argument);
+            CHECK_THROWS_AS(dyn_uinteger{0}, std::invalid_argument);
+        }
+    }
+
+    GIVEN("A division by zero")
+    {
+        THEN("It throws")
+        {
+            CHECK_THROWS_AS(dyn_uinteger(300, 1U) / dyn_uinteger(300), std::runtime_error);
+        }
+    }
+
+    GIVEN("Wide integers that are copied and moved")
+    {
+        std::vector<dyn_uinteger> values;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            values.emplace_back(dyn_uinteger::max(1000) >> i);
+        }
+
+        THEN("The pooled limbs are not shared")
+        {
+            dyn_uinteger copy{values[10]};
+            copy = values[20];
+            values[20] = dyn_uinteger{1000};
+            CHECK(copy == dyn_uinteger::max(1000) >> 20);
+            CHECK(values[20].is_zero());
+
+            dyn_uinteger moved{std::move(copy)};
+            CHECK(moved == dyn_uinteger::max(1000) >> 20);
+
+            std::stringstream out;
+            out << dyn_uinteger{1000, 1234567890123U} * dyn_uinteger{1000, 1000000000U};
+            CHECK(out.str() == "1234567890123000000000");
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#include <catch.hpp>
+
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+
+using namespace aarith;
+
+namespace {
+
+/**
+ * The shift-and-add multiplication that was used before the word-wise multiplication.
+ */
+template <typename I> I shift_and_add_mul(const I& a, const I& b)
+{
+    using U = uinteger<I::width(), typename I::word_type>;
+    const U a_{a};
+    const U b_{b};
+    U result;
+    for (size_t i = 0; i < I::width(); ++i)
+    {
+        if (b_.bit(i))
+        {
+            result = add(result, a_ << i);
+        }
+    }
+    return I{result};
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("In-place arithmetic matches the value-returning arithmetic",
+                       "[integer][unsigned][arithmetic][inplace]",
+                       ((size_t W, typename WordType), W, WordType), (8, uint64_t), (64, uint64_t),
+                       (65, uint64_t), (150, uint64_t), (256, uint64_t), (1000, uint64_t),
+                       (24, uint8_t), (150, uint16_t), (200, uint32_t))
+{
+    using U = uinteger<W, WordType>;
+    using I = integer<W, WordType>;
+
+    const U a = GENERATE(take(20, random_uinteger<W, WordType>()));
+    const U b = GENERATE(take(5, random_uinteger<W, WordType>()));
+
+    THEN("Unsigned addition, subtraction and multiply-accumulate are computed modulo 2^W")
+    {
+        U sum{a};
+        const bool carry = add_inplace(sum, b);
+        CHECK(sum == add(a, b));
+        CHECK(carry == static_cast<bool>(expanding_add(a, b).msb()));
+
+        U difference{a};
+        const bool borrow = sub_inplace(difference, b);
+        CHECK(difference == sub(a, b));
+        CHECK(borrow == (a < b));
+
+        U acc{a};
+        mul_add_inplace(acc, a, b);
+        CHECK(acc == add(a, shift_and_add_mul(a, b)));
+        CHECK(mul(a, b) == shift_and_add_mul(a, b));
+    }
+
+    THEN("Signed addition, subtraction and multiply-accumulate are computed modulo 2^W")
+    {
+        const I a_{a};
+        const I b_{b};
+
+        I sum{a_};
+        add_inplace(sum, b_);
+        CHECK(sum == add(a_, b_));
+
+        I difference{a_};
+        sub_inplace(difference, b_);
+        CHECK(difference == sub(a_, b_));
+
+        I acc{b_};
+        mul_add_inplace(acc, a_, b_);
+        CHECK(acc == add(b_, shift_and_add_mul(a_, b_)));
+        CHECK(mul(a_, b_) == booth_mul(a_, b_));
+    }
+
+    THEN("The compound operators match the binary operators")
+    {
+        using namespace integer_operators;
+
+        U x{a};
+        x += b;
+        CHECK(x == a + b);
+        x = a;
+        x -= b;
+        CHECK(x == a - b);
+        x = a;
+        x *= b;
+        CHECK(x == a * b);
+        if (!b.is_zero())
+        {
+            x = a;
+            x /= b;
+            CHECK(x == a / b);
+            x = a;
+            x %= b;
+            CHECK(x == a % b);
+        }
+
+        U shifted{a};
+        CHECK(shift_left_inplace(shifted, 3) == (a << 3));
+        shifted = a;
+        CHECK(shift_right_inplace(shifted, 5) == (a >> 5));
+
+        I signed_shifted{a};
+        CHECK(shift_right_inplace(signed_shifted, 5) == (I{a} >> 5));
+    }
+}
+
+SCENARIO("In-place operations extend narrower operands", "[integer][arithmetic][inplace]")
+{
+    GIVEN("A wide accumulator and narrow operands")
+    {
+        using Wide = integer<150>;
+        using Narrow = integer<10>;
+
+        const Narrow minus_three{-3};
+        const Narrow five{5};
+
+        THEN("Negative operands are sign-extended")
+        {
+            Wide acc{Wide{7}};
+            add_inplace(acc, minus_three);
+            CHECK(acc == Wide{4});
+
+            sub_inplace(acc, minus_three);
+            CHECK(acc == Wide{7});
+
+            mul_add_inplace(acc, minus_three, five);
+            CHECK(acc == Wide{-8});
+        }
+
+        THEN("The carry out of a partially used word is reported")
+        {
+            using U = uinteger<70>;
+            U all_ones{U::all_ones()};
+            CHECK(add_inplace(all_ones, uinteger<8>{1U}));
+            CHECK(all_ones.is_zero());
+            CHECK(sub_inplace(all_ones, uinteger<8>{1U}));
+            CHECK(all_ones == U::all_ones());
+        }
+    }
+}
@@ -0,0 +1,190 @@
+#include <catch.hpp>
+
+#include "gen_integer.hpp"
+#include <aarith/core.hpp>
+#include <aarith/integer.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__)
+#include <pthread.h>
+#endif
+
+using namespace aarith;
+
+SCENARIO("Allocating scratch memory from the limb arena", "[core][arena]")
+{
+    GIVEN("An empty arena")
+    {
+        limb_arena arena;
+
+        THEN("Rewinding to a marker releases all memory allocated after it")
+        {
+            limb* first = arena.allocate(10);
+            const auto marker = arena.mark();
+            limb* second = arena.allocate(20);
+            CHECK(second == first + 10);
+
+            arena.rewind(marker);
+            CHECK(arena.allocate(5) == second);
+
+            arena.reset();
+            CHECK(arena.allocate(1) == first);
+        }
+
+        THEN("Requests larger than the current chunk are served by new chunks")
+        {
+            const size_t large = 3 * limb_arena::initial_chunk_size;
+            limb* memory = arena.allocate_zeroed(large);
+            CHECK(memory[large - 1] == 0U);
+            CHECK(arena.capacity() >= large);
+
+            // the chunks are kept
+            const size_t capacity = arena.capacity();
+            arena.reset();
+            static_cast<void>(arena.allocate(large));
+            CHECK(arena.capacity() == capacity);
+        }
+
+        THEN("Scratch scopes rewind the arena when they end")
+        {
+            const auto before = arena.mark();
+            {
+                scratch_scope outer{arena};
+                static_cast<void>(outer.allocate(100));
+                {
+                    scratch_scope inner{arena};
+                    static_cast<void>(inner.allocate(200));
+                }
+                CHECK(arena.mark().used == before.used + 100);
+            }
+            CHECK(arena.mark().used == before.used);
+        }
+    }
+}
+
+SCENARIO("Multiplying limbs using the Karazuba algorithm", "[core][arena][arithmetic]")
+{
+    GIVEN("Random numbers of various lengths")
+    {
+        const size_t n = GENERATE(1, 23, 24, 25, 64, 100, 257);
+
+        std::mt19937_64 rng{n};
+        std::vector<limb> a(n);
+        std::vector<limb> b(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = rng();
+            b[i] = rng();
+        }
+        // the sums of the halves overflow for all ones
+        if (n == 64)
+        {
+            std::fill(a.begin(), a.end(), ~limb{0});
+            std::fill(b.begin(), b.end(), ~limb{0});
+        }
+
+        THEN("The product matches the schoolbook product")
+        {
+            std::vector<limb> expected(2 * n);
+            std::vector<limb> product(2 * n);
+            mul_limbs(expected.data(), a.data(), n, b.data(), n);
+
+            scratch_scope scratch;
+            karazuba_limbs(product.data(), a.data(), b.data(), n, scratch);
+            CHECK(product == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Wide integer algorithms using the arena match the other algorithms",
+                       "[integer][arena][arithmetic]", ((size_t W), W), 2048, 4096)
+{
+    static_assert(uses_limb_arena<W, uint64_t>());
+    using U = uinteger<W, uint64_t>;
+    using namespace integer_operators;
+
+    const U a = GENERATE(take(3, random_uinteger<W, uint64_t>()));
+    const U b = GENERATE(take(2, random_uinteger<W, uint64_t>()));
+
+    THEN("The results are the same")
+    {
+        CHECK(expanding_karazuba(a, b) == expanding_mul(a, b));
+        CHECK(karazuba(a, b) == mul(a, b));
+
+        const auto d = b >> (W / 2);
+        if (!d.is_zero())
+        {
+            const auto [q, r] = restoring_division(a, d);
+            CHECK(r < d);
+            CHECK(add(mul(q, d), r) == a);
+        }
+
+        CHECK(to_decimal(a) == remove_leading_zeroes(to_hex(to_bcd(a))));
+        CHECK(to_decimal(U::zero()) == "0");
+        CHECK(to_decimal(U::max()) == remove_leading_zeroes(to_hex(to_bcd(U::max()))));
+    }
+}
+
+#if defined(__unix__)
+
+namespace {
+
+constexpr size_t wide_width = 65536;
+
+struct wide_results
+{
+    bool karazuba_matches{false};
+    bool division_matches{false};
+    size_t decimal_digits{0};
+};
+
+void* wide_arithmetic(void* argument)
+{
+    auto& results = *static_cast<wide_results*>(argument);
+
+    using U = uinteger<wide_width>;
+    U a = U::max();
+    U b = U::max() >> (wide_width / 2);
+
+    const auto product = expanding_karazuba(a, b);
+    const auto expected = expanding_mul(a, b);
+    results.karazuba_matches = product == expected;
+
+    const auto [q, r] = restoring_division(a, b);
+    results.division_matches = add(mul(q, b), r) == a && r < b;
+
+    results.decimal_digits = to_decimal(a).size();
+    return nullptr;
+}
+
+} // namespace
+
+SCENARIO("Wide integer arithmetic on threads with small stacks", "[integer][arena]")
+{
+    GIVEN("A thread with a stack of 256 KB")
+    {
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+        pthread_attr_setstacksize(&attributes, 256 * 1024);
+
+        THEN("Multiplying, dividing and printing 65536 bit integers works")
+        {
+            wide_results results;
+            pthread_t thread;
+            REQUIRE(pthread_create(&thread, &attributes, &wide_arithmetic, &results) == 0);
+            pthread_join(thread, nullptr);
+
+            CHECK(results.karazuba_matches);
+            CHECK(results.division_matches);
+            // 2^65536 has 19729 decimal digits
+            CHECK(results.decimal_digits == 19729);
+        }
+
+        pthread_attr_destroy(&attributes);
+    }
+}
+
+#endif
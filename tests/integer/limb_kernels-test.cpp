@@ -0,0 +1,94 @@
+#include <catch.hpp>
+
+#include "gen_integer.hpp"
+#include <aarith/integer.hpp>
+
+using namespace aarith;
+
+namespace {
+
+/**
+ * Copies the bits of an integer of 64-bit words into an integer of 32-bit words (whose
+ * operations never call the limb kernels).
+ */
+template <size_t W> uinteger<W, uint32_t> narrow_words(const uinteger<W, uint64_t>& value)
+{
+    uinteger<W, uint32_t> result;
+    for (size_t i = 0; i < result.word_count(); ++i)
+    {
+        result.set_word(i, static_cast<uint32_t>(value.word(i / 2) >> (32U * (i % 2))));
+    }
+    return result;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE_SIG("The limb kernels match the word-by-word algorithms",
+                       "[integer][unsigned][kernels]", ((size_t W), W), 256, 300, 1000, 2048)
+{
+    using U = uinteger<W, uint64_t>;
+    using namespace integer_operators;
+
+    const U a = GENERATE(take(10, random_uinteger<W, uint64_t>()));
+    const U b = GENERATE(take(5, random_uinteger<W, uint64_t>()));
+    const U small = b >> (W - 70);
+
+    const auto a_ = narrow_words(a);
+    const auto b_ = narrow_words(b);
+    const auto small_ = narrow_words(small);
+
+    THEN("Adding, subtracting and multiplying yields the same results")
+    {
+        CHECK(to_binary(add(a, b)) == to_binary(add(a_, b_)));
+        CHECK(to_binary(sub(a, b)) == to_binary(sub(a_, b_)));
+        CHECK(to_binary(mul(a, b)) == to_binary(mul(a_, b_)));
+        CHECK(to_binary(expanding_mul(a, b)) == to_binary(expanding_mul(a_, b_)));
+
+        U c{a};
+        auto c_{a_};
+        CHECK(add_inplace(c, b) == add_inplace(c_, b_));
+        CHECK(sub_inplace(c, b) == sub_inplace(c_, b_));
+        CHECK(c == a);
+    }
+
+    THEN("Dividing yields the same results")
+    {
+        CHECK(to_binary(div(a, b)) == to_binary(div(a_, b_)));
+        CHECK(to_binary(remainder(a, b)) == to_binary(remainder(a_, b_)));
+        CHECK(to_binary(div(a, small)) == to_binary(div(a_, small_)));
+        CHECK(to_binary(remainder(a, small)) == to_binary(remainder(a_, small_)));
+        CHECK(div(small, a) == U::zero());
+        CHECK(remainder(small, a) == small);
+    }
+
+    THEN("Shifting, counting and comparing yields the same results")
+    {
+        for (const size_t shift : {size_t{1}, size_t{63}, size_t{64}, size_t{65}, W - 1})
+        {
+            CHECK(to_binary(a << shift) == to_binary(a_ << shift));
+            CHECK(to_binary(a >> shift) == to_binary(a_ >> shift));
+        }
+        CHECK(count_leading_zeroes(small) == count_leading_zeroes(small_));
+        CHECK((a < b) == (a_ < b_));
+        CHECK((b < a) == (b_ < a_));
+        CHECK_FALSE(a < a);
+    }
+}
+
+SCENARIO("The limb kernels are not called during constant evaluation", "[integer][kernels]")
+{
+    using U = uinteger<512, uint64_t>;
+
+    static_assert(add(U::max(), U::one()).is_zero());
+    static_assert(sub(U::zero(), U::one()) == U::max());
+    static_assert(mul(U::max(), U::max()) == U::one());
+    static_assert(div(U::max(), U::max()) == U::one());
+    static_assert(remainder(U{100U}, U{7U}) == U{2U});
+    static_assert(count_leading_zeroes(U::one()) == 511);
+    static_assert((U::one() << 300) > (U::one() << 299));
+    static_assert(expanding_karazuba(U::max(), U::max()) ==
+                  sub(uinteger<1024, uint64_t>::zero(), shl<513>(uinteger<1024, uint64_t>::one())) +
+                      uinteger<1024, uint64_t>::one());
+
+    SUCCEED("The results are checked at compile time");
+}
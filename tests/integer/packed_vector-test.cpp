@@ -0,0 +1,219 @@
+#include <aarith/integer.hpp>
+#include <aarith/linalg.hpp>
+
+#include <catch.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+template <class Integer> std::vector<Integer> random_values(const size_t count)
+{
+    static std::mt19937 rng{std::random_device{}()};
+    std::vector<Integer> values;
+    if constexpr (is_unsigned_v<Integer>)
+    {
+        uniform_uinteger_distribution<Integer::width(), typename Integer::word_type> dist;
+        for (size_t i = 0; i < count; ++i)
+        {
+            values.push_back(dist(rng));
+        }
+    }
+    else
+    {
+        uniform_integer_distribution<Integer::width(), typename Integer::word_type> dist;
+        for (size_t i = 0; i < count; ++i)
+        {
+            values.push_back(dist(rng));
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Packed vectors store values densely", "[integer][packed_vector]", uinteger<1>,
+                   uinteger<4>, uinteger<5>, uinteger<13>, uinteger<64>, uinteger<100>,
+                   integer<3>, integer<5>, integer<31>, integer<70>, (uinteger<5, uint8_t>))
+{
+    using Integer = TestType;
+
+    const size_t count = GENERATE(0, 1, 13, 64, 333);
+    const auto values = random_values<Integer>(count);
+
+    GIVEN("A packed vector created from " << count << " random values")
+    {
+        packed_vector<Integer> packed(values.begin(), values.end());
+
+        THEN("It stores exactly W bits per value")
+        {
+            REQUIRE(packed.size() == count);
+            REQUIRE(packed.storage_size() == (count * Integer::width() + 63) / 64);
+        }
+
+        THEN("Every value can be read back")
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(packed.get(i) == values[i]);
+                REQUIRE(packed[i] == values[i]);
+            }
+            REQUIRE(std::vector<Integer>(packed.begin(), packed.end()) == values);
+        }
+
+        WHEN("Every value is overwritten using the proxy references")
+        {
+            const auto replacement = random_values<Integer>(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                packed[i] = replacement[i];
+            }
+            THEN("Only the addressed values change")
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    REQUIRE(packed.get(i) == replacement[i]);
+                }
+            }
+        }
+
+        WHEN("The vector is shrunk and grown again")
+        {
+            packed.resize(count / 2);
+            packed.resize(count, Integer::zero());
+            THEN("The new values are zero and the vector equals a freshly built one")
+            {
+                std::vector<Integer> expected(values.begin(), values.begin() + count / 2);
+                expected.resize(count, Integer::zero());
+                REQUIRE(packed == packed_vector<Integer>(expected.begin(), expected.end()));
+            }
+        }
+    }
+}
+
+SCENARIO("Accessing packed vectors", "[integer][packed_vector]")
+{
+    GIVEN("A small packed vector")
+    {
+        packed_vector<integer<5>> packed{integer<5>{3}, integer<5>{-16}, integer<5>{15}};
+
+        THEN("Bounds are checked by at")
+        {
+            REQUIRE(packed.at(2) == integer<5>{15});
+            REQUIRE_THROWS_AS(packed.at(3), std::out_of_range);
+        }
+
+        THEN("Elements can be swapped through proxy references")
+        {
+            swap(packed[0], packed[2]);
+            REQUIRE(packed.front() == integer<5>{15});
+            REQUIRE(packed.back() == integer<5>{3});
+        }
+
+        THEN("Iterators support random access")
+        {
+            auto it = packed.cbegin();
+            REQUIRE(packed.cend() - it == 3);
+            REQUIRE(it[1] == integer<5>{-16});
+            REQUIRE(*(it + 2) == integer<5>{15});
+            *(packed.begin() + 1) = integer<5>{7};
+            REQUIRE(packed.get(1) == integer<5>{7});
+        }
+
+        THEN("Popping elements clears their bits")
+        {
+            packed.pop_back();
+            packed.pop_back();
+            REQUIRE(packed.size() == 1);
+            REQUIRE(packed.data()[0] == 3U);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Packing and unpacking native lanes", "[integer][packed_vector]", uinteger<4>,
+                   uinteger<7>, integer<5>, integer<8>, integer<13>)
+{
+    using Integer = TestType;
+
+    const size_t count = GENERATE(0, 7, 8, 64, 101);
+    const auto values = random_values<Integer>(count);
+    packed_vector<Integer> packed(values.begin(), values.end());
+
+    const auto expected = [&](const size_t i) {
+        if constexpr (is_unsigned_v<Integer>)
+        {
+            return static_cast<int64_t>(static_cast<uint64_t>(values[i]));
+        }
+        else
+        {
+            const uinteger<64> bits{width_cast<64>(values[i])};
+            return static_cast<int64_t>(static_cast<uint64_t>(bits));
+        }
+    };
+
+    THEN("Unpacking yields the (sign-extended) values")
+    {
+        std::vector<int16_t> lanes16(count);
+        std::vector<int64_t> lanes64(count);
+        packed.unpack(0, count, lanes16.data());
+        packed.unpack(0, count, lanes64.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(lanes16[i] == expected(i));
+            REQUIRE(lanes64[i] == expected(i));
+        }
+    }
+
+    THEN("Packing the unpacked values restores the vector")
+    {
+        std::vector<int16_t> lanes(count);
+        packed.unpack(0, count, lanes.data());
+
+        packed_vector<Integer> restored(count);
+        restored.pack(0, count, lanes.data());
+        REQUIRE(restored == packed);
+    }
+
+    THEN("Ranges in the middle of the vector can be unpacked")
+    {
+        if (count > 2)
+        {
+            std::vector<int32_t> lanes(count - 2);
+            packed.unpack(1, count - 2, lanes.data());
+            for (size_t i = 0; i + 2 < count; ++i)
+            {
+                REQUIRE(lanes[i] == expected(i + 1));
+            }
+        }
+        REQUIRE_THROWS_AS(packed.unpack(count, 1, static_cast<int32_t*>(nullptr)),
+                          std::out_of_range);
+    }
+}
+
+SCENARIO("Multiplying packed matrices", "[integer][packed_vector][linalg]")
+{
+    GIVEN("Packed matrices of 5 bit integers")
+    {
+        const size_t m = 9;
+        const size_t n = 11;
+        const size_t k = 13;
+
+        const auto a = random_values<integer<5>>(m * k);
+        const auto b = random_values<integer<5>>(k * n);
+        const packed_vector<integer<5>> a_packed(a.begin(), a.end());
+        const packed_vector<integer<5>> b_packed(b.begin(), b.end());
+
+        THEN("gemm reads them through their iterators")
+        {
+            using Strategy = exact_arithmetic<integer<5>, integer<16>>;
+            std::vector<integer<16>> c(m * n);
+            std::vector<integer<16>> expected(m * n);
+            gemm<Strategy>(m, n, k, a_packed.begin(), k, b_packed.begin(), n, c.data(), n);
+            gemm<Strategy>(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+            REQUIRE(c == expected);
+        }
+    }
+}
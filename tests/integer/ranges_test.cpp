@@ -1,6 +1,15 @@
 #include <aarith/integer_no_operators.hpp>
 #include <catch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#if defined(AARITH_TEST_PARALLEL_ALGORITHMS)
+#include <execution>
+#endif
+
 using namespace aarith;
 
 SCENARIO("Iterating ranges", "[integer][signed][ranges][operation][utility]")
@@ -228,4 +237,287 @@ SCENARIO("Using non-positive strides", "[integer][unsigned][ranges][operation][u
             CHECK_THROWS_AS(integer_range(a, b, I{-4}), std::invalid_argument);
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO("Accessing integer ranges randomly", "[integer][unsigned][ranges][utility]")
+{
+    GIVEN("A range of signed integers with a stride")
+    {
+        using I = integer<8>;
+        const integer_range range(I{-100}, I{100}, I{7});
+
+        THEN("The size is the number of elements")
+        {
+            CHECK(range.size() == 29U);
+            CHECK(std::distance(range.begin(), range.end()) == 29);
+            CHECK_FALSE(range.empty());
+        }
+        THEN("The elements can be accessed by their position")
+        {
+            for (size_t i = 0; i < range.size(); ++i)
+            {
+                CHECK(range[i] == I{static_cast<int>(-100 + 7 * i)});
+                CHECK(range.begin()[static_cast<std::ptrdiff_t>(i)] == range[i]);
+            }
+        }
+        THEN("The iterators can jump")
+        {
+            auto it = range.begin() + 10;
+            CHECK(*it == I{-30});
+            it -= 3;
+            CHECK(*it == I{-51});
+            CHECK(range.end() - it == 22);
+            CHECK(it < range.end());
+            CHECK(*(range.end() - 1) == I{96});
+        }
+    }
+
+    GIVEN("The full range of an unsigned type")
+    {
+        using I = uinteger<16>;
+        const integer_range<I> range;
+
+        THEN("It contains all values")
+        {
+            CHECK(range.size() == 65536U);
+            CHECK(*range.rbegin() == I::max());
+            CHECK(std::count_if(range.begin(), range.end(),
+                                [](const I& i) { return i.word(0) % 2 == 0; }) == 32768);
+        }
+    }
+
+    GIVEN("An empty range")
+    {
+        using I = uinteger<16>;
+        const integer_range range(I{5U}, I{4U});
+
+        THEN("It has no elements and can not be split")
+        {
+            CHECK(range.empty());
+            CHECK(range.begin() == range.end());
+            CHECK(range.split(4).empty());
+        }
+    }
+}
+
+SCENARIO("Accessing ranges of wide integers randomly", "[integer][unsigned][ranges][utility]")
+{
+    GIVEN("A range of wide unsigned integers")
+    {
+        using I = uinteger<150>;
+        const I start = sub(I::max(), I{1000U});
+        const integer_range range(start, I::max(), I{3U});
+
+        THEN("The elements are computed without overflow")
+        {
+            CHECK(range.size() == integer_range<I>::size_type{334U});
+            CHECK(std::distance(range.begin(), range.end()) == 334);
+            CHECK(*range.rbegin() == I::max());
+            CHECK(*(range.end() - 1) == sub(I::max(), I{1U}));
+
+            auto it = range.begin();
+            for (size_t i = 0; i < 334; ++i, ++it)
+            {
+                REQUIRE(*it == add(start, I{static_cast<uint32_t>(3 * i)}));
+            }
+            CHECK(it == range.end());
+        }
+        THEN("The iterators can jump")
+        {
+            const auto it = range.end() - 4;
+            CHECK(*it == sub(I::max(), I{10U}));
+            CHECK(*(it + -2) == sub(I::max(), I{16U}));
+        }
+    }
+
+    GIVEN("The full range of a wide type")
+    {
+        using I = integer<100>;
+        const integer_range<I> range;
+
+        THEN("Its size is 2^W")
+        {
+            const auto size = range.size();
+            CHECK(size.bit(100) == 1);
+            CHECK(count_leading_zeroes(size) == size.width() - 101);
+            CHECK(range[0U] == I::min());
+            CHECK_THROWS_AS(range.end() - range.begin(), std::out_of_range);
+        }
+        THEN("It can be split")
+        {
+            const auto parts = range.split(4);
+            REQUIRE(parts.size() == 4);
+            CHECK(*parts[0].begin() == I::min());
+            CHECK(*parts[2].begin() == I::zero());
+            CHECK(*parts[3].rbegin() == I::max());
+        }
+    }
+}
+
+SCENARIO("Splitting integer ranges", "[integer][ranges][utility]")
+{
+    GIVEN("A range with a stride")
+    {
+        using I = integer<12>;
+        const integer_range range(I{-1000}, I{1000}, I{3});
+
+        WHEN("Splitting it into parts")
+        {
+            const size_t parts = GENERATE(1, 2, 7, 100, 667, 1000);
+            const auto subranges = range.split(parts);
+
+            THEN("The subranges are consecutive and of almost equal size")
+            {
+                CHECK(subranges.size() == std::min<size_t>(parts, range.size()));
+                auto expected = range.begin();
+                for (const auto& subrange : subranges)
+                {
+                    CHECK(subrange.size() >= range.size() / subranges.size());
+                    CHECK(subrange.size() <= range.size() / subranges.size() + 1);
+                    for (const I i : subrange)
+                    {
+                        REQUIRE(i == *expected);
+                        ++expected;
+                    }
+                }
+                CHECK(expected == range.end());
+            }
+        }
+        THEN("Splitting into zero parts throws")
+        {
+            CHECK_THROWS_AS(range.split(0), std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Iterating cartesian products of ranges", "[integer][ranges][utility]")
+{
+    GIVEN("Two ranges of different types")
+    {
+        using U = uinteger<4>;
+        using I = integer<6>;
+        const cartesian_range product(integer_range<U>{}, integer_range(I{-3}, I{3}, I{2}));
+
+        THEN("All pairs are produced with the last range varying fastest")
+        {
+            CHECK(product.size() == 64U);
+            const auto to_int = [](const I& i) {
+                return static_cast<int>(i.word(0)) - (i.is_negative() ? 64 : 0);
+            };
+            std::vector<std::pair<int, int>> pairs;
+            for (const auto& [u, i] : product)
+            {
+                pairs.emplace_back(static_cast<int>(u.word(0)), to_int(i));
+            }
+            REQUIRE(pairs.size() == 64);
+            CHECK(pairs[0] == std::make_pair(0, -3));
+            CHECK(pairs[1] == std::make_pair(0, -1));
+            CHECK(pairs[4] == std::make_pair(1, -3));
+            CHECK(pairs[63] == std::make_pair(15, 3));
+        }
+        THEN("The product can be split")
+        {
+            const auto parts = product.split(5);
+            REQUIRE(parts.size() == 5);
+            size_t count = 0;
+            for (const auto& part : parts)
+            {
+                for (const auto& element : part)
+                {
+                    REQUIRE(element == product[count]);
+                    ++count;
+                }
+            }
+            CHECK(count == 64);
+        }
+    }
+
+    GIVEN("A full sweep of two 32-bit ranges (2^64 pairs)")
+    {
+        using U = uinteger<32>;
+        const cartesian_range product(integer_range<U>{}, integer_range<U>{});
+        using size_type = decltype(product)::size_type;
+
+        THEN("The size and the positions do not overflow")
+        {
+            CHECK(product.size() == size_type{1U, 0U});
+            CHECK(product[size_type{0xFFFFFFFFFFFFFFFFU}] ==
+                  std::make_tuple(U{0xFFFFFFFFU}, U{0xFFFFFFFFU}));
+            CHECK(*(product.end() - 1) == std::make_tuple(U{0xFFFFFFFFU}, U{0xFFFFFFFFU}));
+            CHECK(product.end() - (product.end() - 5) == 5);
+        }
+        THEN("Distances beyond std::ptrdiff_t throw")
+        {
+            CHECK_THROWS_AS(product.end() - product.begin(), std::out_of_range);
+        }
+        THEN("The product can be split")
+        {
+            const auto parts = product.split(3);
+            REQUIRE(parts.size() == 3);
+            CHECK(parts[0][size_type{0U}] == std::make_tuple(U{0U}, U{0U}));
+            CHECK(*parts[1].begin() == product[parts[0].size()]);
+            CHECK(add(add(parts[0].size(), parts[1].size()), parts[2].size()) == product.size());
+        }
+    }
+
+    GIVEN("Ranges with more than 2^64 pairs")
+    {
+        using U = uinteger<40>;
+        const cartesian_range product(integer_range<U>{}, integer_range<U>{U{1U}, U{8U}});
+
+        THEN("The elements are decoded from the wide positions")
+        {
+            using size_type = decltype(product)::size_type;
+            const size_type position = add(mul(size_type{0xFFFFFFFFFFU}, size_type{8U}),
+                                           size_type{7U});
+            CHECK(product.size() == mul(size_type{0x10000000000U}, size_type{8U}));
+            CHECK(product[position] == std::make_tuple(U{0xFFFFFFFFFFU}, U{8U}));
+        }
+    }
+
+    GIVEN("A product with an empty range")
+    {
+        using U = uinteger<8>;
+        const cartesian_range product(integer_range<U>{}, integer_range(U{2U}, U{1U}));
+        THEN("The product is empty")
+        {
+            CHECK(product.empty());
+            CHECK(product.begin() == product.end());
+        }
+    }
+}
+
+SCENARIO("Sweeping ranges in parallel", "[integer][ranges][utility][parallel]")
+{
+    GIVEN("A thread pool and a cartesian product")
+    {
+        using U = uinteger<8>;
+        thread_pool pool{4};
+        const cartesian_range product(integer_range<U>{}, integer_range<U>{});
+
+        THEN("Every element is visited exactly once")
+        {
+            std::vector<std::atomic<int>> visits(product.size());
+            parallel_for_each(pool, product, [&](const auto& element) {
+                const auto& [a, b] = element;
+                ++visits[a.word(0) * 256 + b.word(0)];
+            });
+            CHECK(std::all_of(visits.begin(), visits.end(),
+                              [](const std::atomic<int>& v) { return v == 1; }));
+        }
+    }
+
+#if defined(AARITH_TEST_PARALLEL_ALGORITHMS)
+    GIVEN("A range used with a parallel standard algorithm")
+    {
+        using U = uinteger<16>;
+        const integer_range<U> range;
+
+        THEN("The algorithm visits all elements")
+        {
+            const auto odd = std::count_if(std::execution::par_unseq, range.begin(), range.end(),
+                                           [](const U& u) { return u.bit(0) == 1; });
+            CHECK(odd == 32768);
+        }
+    }
+#endif
+}
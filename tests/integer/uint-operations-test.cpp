@@ -1220,3 +1220,26 @@ SCENARIO("Computing the remainder of two unsigned integers works as expected",
         }
     }
 }
+
+TEMPLATE_TEST_CASE_SIG("Leading zero anticipation is off by at most one",
+                       "[integer][unsigned][arithmetic][subtraction]", AARITH_INT_TEST_SIGNATURE,
+                       AARITH_INT_TEST_TEMPLATE_PARAM_RANGE)
+{
+    using I = uinteger<W, WordType>;
+
+    const I a = GENERATE(take(50, random_uinteger<W, WordType>()));
+    const I b = GENERATE(take(50, random_uinteger<W, WordType>()));
+
+    if (a != b)
+    {
+        const I& larger = (a > b) ? a : b;
+        const I& smaller = (a > b) ? b : a;
+
+        const size_t exact = count_leading_zeroes(sub(larger, smaller));
+        const size_t predicted = leading_zero_anticipation(larger, smaller);
+
+        CAPTURE(larger, smaller, exact, predicted);
+        CHECK(predicted <= exact);
+        REQUIRE(exact - predicted <= 1);
+    }
+}
@@ -4,6 +4,10 @@
 #include "../test-signature-ranges.hpp"
 #include "gen_integer.hpp"
 
+#include <array>
+#include <random>
+#include <vector>
+
 using namespace aarith;
 
 TEMPLATE_TEST_CASE_SIG("Generating exactly one number works as intended",
@@ -100,3 +104,122 @@ TEMPLATE_TEST_CASE_SIG("Generating two numbers with constraints works",
         REQUIRE(a <= a_);
     }
 }
+
+TEMPLATE_TEST_CASE_SIG("The generated numbers are uniformly distributed",
+                       "[integer][unsigned][utility][random]",
+                       ((size_t W, typename WordType, size_t L, size_t U), W, WordType, L, U),
+                       (8, uint8_t, 0, 2), (8, uint8_t, 10, 15), (16, uint16_t, 100, 109),
+                       (40, uint32_t, 1000, 1012), (64, uint64_t, 7, 16),
+                       (130, uint64_t, 5, 11))
+{
+    using I = uinteger<W, WordType>;
+
+    const I lower{L};
+    const I upper{U};
+    constexpr size_t values = U - L + 1;
+    constexpr size_t samples = 2000 * values;
+
+    xoshiro256starstar rng{W + L};
+    uniform_uinteger_distribution<W, WordType> distribution{lower, upper};
+
+    std::array<size_t, values> histogram{};
+    for (size_t i = 0; i < samples; ++i)
+    {
+        const I number = distribution(rng);
+        REQUIRE(number >= lower);
+        REQUIRE(number <= upper);
+        ++histogram[number.word(0) - L];
+    }
+
+    // Pearson's chi-squared test, the bound is far above the 99.9% quantile for up to 12 degrees
+    // of freedom
+    double chi_squared = 0.0;
+    for (const size_t count : histogram)
+    {
+        const double difference = static_cast<double>(count) - 2000.0;
+        chi_squared += difference * difference / 2000.0;
+    }
+    CHECK(chi_squared < 40.0);
+}
+
+TEMPLATE_TEST_CASE_SIG("Numbers from intervals with the length of a power of two are generated",
+                       "[integer][unsigned][utility][random]",
+                       ((size_t W, typename WordType), W, WordType), (8, uint8_t), (64, uint64_t),
+                       (100, uint32_t), (150, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+
+    xoshiro256starstar rng;
+
+    WHEN("Generating numbers of the full range")
+    {
+        uniform_uinteger_distribution<W, WordType> distribution;
+        I all_bits;
+        for (size_t i = 0; i < 200; ++i)
+        {
+            all_bits = all_bits | distribution(rng);
+        }
+        THEN("All bits are set eventually")
+        {
+            CHECK(all_bits == I::max());
+        }
+    }
+
+    WHEN("Generating numbers of a shifted interval with the length of a power of two")
+    {
+        const I lower = I::from_words(3U);
+        const I upper = add(lower, I{uint8_t{63}});
+        uniform_uinteger_distribution<W, WordType> distribution{lower, upper};
+        for (size_t i = 0; i < 200; ++i)
+        {
+            const I number = distribution(rng);
+            REQUIRE(number >= lower);
+            REQUIRE(number <= upper);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_SIG("Large intervals of wide numbers are respected",
+                       "[integer][unsigned][utility][random]",
+                       ((size_t W, typename WordType), W, WordType), (64, uint64_t),
+                       (100, uint8_t), (192, uint64_t))
+{
+    using I = uinteger<W, WordType>;
+
+    // the most significant word of the range is small, i.e., many numbers are rejected
+    const I lower = I::one();
+    const I upper = add(sub(I::max(), I::max() >> 1U), I{5U});
+    uniform_uinteger_distribution<W, WordType> distribution{lower, upper};
+
+    std::mt19937_64 rng;
+    bool upper_half = false;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const I number = distribution(rng);
+        REQUIRE(number >= lower);
+        REQUIRE(number <= upper);
+        upper_half = upper_half || number > (upper >> 1U);
+    }
+    CHECK(upper_half);
+}
+
+SCENARIO("Generating batches of random numbers", "[integer][unsigned][utility][random]")
+{
+    GIVEN("A distribution and two identically seeded generators")
+    {
+        using I = uinteger<96>;
+        uniform_uinteger_distribution<96> distribution{I{17U}, I::from_words(5U, 0U)};
+        xoshiro256starstar rng_single{42};
+        xoshiro256starstar rng_batch{42};
+
+        THEN("The batch contains the same numbers as generating them one by one")
+        {
+            std::vector<I> batch(100);
+            distribution.generate(batch.begin(), batch.end(), rng_batch);
+            for (const I& number : batch)
+            {
+                REQUIRE(number == distribution(rng_single));
+            }
+        }
+    }
+}
@@ -0,0 +1,265 @@
+#include <aarith/float.hpp>
+#include <aarith/integer.hpp>
+#include <aarith/linalg.hpp>
+
+#include <catch.hpp>
+#include <random>
+#include <vector>
+
+using namespace aarith;
+
+namespace {
+
+template <class Strategy>
+auto naive_gemm(const size_t m, const size_t n, const size_t k,
+                const std::vector<typename Strategy::element_type>& a,
+                const std::vector<typename Strategy::element_type>& b,
+                const Strategy& strategy = Strategy{})
+{
+    std::vector<typename Strategy::result_type> c;
+    for (size_t i = 0; i < m; ++i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            auto acc = strategy.zero();
+            for (size_t p = 0; p < k; ++p)
+            {
+                strategy.multiply_accumulate(acc, a[i * k + p], b[p * n + j]);
+            }
+            c.push_back(strategy.finalize(acc));
+        }
+    }
+    return c;
+}
+
+template <class T> std::vector<T> random_matrix(const size_t size)
+{
+    static std::mt19937 rng{std::random_device{}()};
+
+    std::vector<T> values;
+    if constexpr (is_float_v<T>)
+    {
+        std::uniform_real_distribution<float> dist{-4.0F, 4.0F};
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.push_back(T{dist(rng)});
+        }
+    }
+    else if constexpr (is_unsigned_v<T>)
+    {
+        uniform_uinteger_distribution<T::width()> dist;
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.push_back(dist(rng));
+        }
+    }
+    else
+    {
+        uniform_integer_distribution<T::width()> dist;
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.push_back(dist(rng));
+        }
+    }
+    return values;
+}
+
+template <class T> bool same_bits(const T& a, const T& b)
+{
+    if constexpr (is_float_v<T>)
+    {
+        return bit_equal(a, b);
+    }
+    else
+    {
+        return a == b;
+    }
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Blocked gemm computes the same result as the naive triple loop",
+                   "[linalg][gemm]", (exact_arithmetic<uinteger<8>, uinteger<32>>),
+                   (exact_arithmetic<integer<8>, integer<24>>), (exact_arithmetic<uinteger<100>>),
+                   (exact_arithmetic<integer<70>>),
+                   (exact_arithmetic<floating_point<8, 23>, floating_point<11, 52>>),
+                   (exact_arithmetic<floating_point<5, 10>>), (kulisch_arithmetic<8, 23>))
+{
+    using Strategy = TestType;
+    using Element = typename Strategy::element_type;
+
+    const size_t m = GENERATE(1, 7, 70);
+    const size_t n = GENERATE(1, 9, 40);
+    const size_t k = GENERATE(1, 5, 33);
+
+    const auto a = random_matrix<Element>(m * k);
+    const auto b = random_matrix<Element>(k * n);
+
+    std::vector<typename Strategy::result_type> c(m * n);
+    thread_pool pool{3};
+    gemm(m, n, k, a.data(), k, b.data(), n, c.data(), n, Strategy{}, pool,
+         gemm_blocking{16, 8, 4}); // NOLINT
+
+    const auto expected = naive_gemm<Strategy>(m, n, k, a, b);
+    for (size_t i = 0; i < c.size(); ++i)
+    {
+        CAPTURE(m, n, k, i);
+        REQUIRE(same_bits(c[i], expected[i]));
+    }
+}
+
+SCENARIO("The native fast path of gemm yields bit-identical results", "[linalg][gemm]")
+{
+    GIVEN("Random single precision matrices")
+    {
+        using F = floating_point<8, 23>;
+
+        const size_t m = 37;
+        const size_t n = 29;
+        const size_t k = 61;
+
+        const auto a = random_matrix<F>(m * k);
+        const auto b = random_matrix<F>(k * n);
+
+        THEN("Computing with float equals computing with aarith's operations")
+        {
+            const auto generic = make_approximate_arithmetic<F>(
+                [](const F& x, const F& y) { return mul(x, y); },
+                [](const F& x, const F& y) { return add(x, y); });
+
+            std::vector<F> native_result(m * n);
+            std::vector<F> generic_result(m * n);
+            gemm<exact_arithmetic<F>>(m, n, k, a.data(), k, b.data(), n, native_result.data(), n);
+            gemm(m, n, k, a.data(), k, b.data(), n, generic_result.data(), n, generic);
+
+            for (size_t i = 0; i < m * n; ++i)
+            {
+                REQUIRE(bit_equal(native_result[i], generic_result[i]));
+            }
+        }
+    }
+
+    GIVEN("Matrices that are not stored contiguously")
+    {
+        using I = integer<16>;
+
+        const size_t m = 5;
+        const size_t n = 6;
+        const size_t k = 7;
+        const size_t ld = 11;
+
+        const auto a = random_matrix<I>(m * ld);
+        const auto b = random_matrix<I>(k * ld);
+
+        THEN("Only the elements within the leading dimension are used")
+        {
+            std::vector<I> c(m * ld, I::zero());
+            gemm<exact_arithmetic<I>>(m, n, k, a.data(), ld, b.data(), ld, c.data(), ld);
+
+            for (size_t i = 0; i < m; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    I expected = I::zero();
+                    for (size_t p = 0; p < k; ++p)
+                    {
+                        expected = add(expected, mul(a[i * ld + p], b[p * ld + j]));
+                    }
+                    REQUIRE(c[i * ld + j] == expected);
+                }
+                for (size_t j = n; j < ld; ++j)
+                {
+                    REQUIRE(c[i * ld + j] == I::zero());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Computing two-dimensional convolutions", "[linalg][conv2d]")
+{
+    using I = integer<32>;
+    using Strategy = exact_arithmetic<I>;
+
+    const size_t channels = 3;
+    const size_t height = 9;
+    const size_t width = 7;
+    const size_t out_channels = 4;
+    const size_t kernel_height = 3;
+    const size_t kernel_width = 2;
+
+    const size_t stride = GENERATE(1, 2, 3);
+    const size_t padding = GENERATE(0, 1, 2);
+
+    GIVEN("A random image and random kernels with stride " << stride << " and padding " << padding)
+    {
+        const auto input = random_matrix<integer<8>>(channels * height * width);
+        const auto kernels = random_matrix<integer<8>>(out_channels * channels * kernel_height *
+                                                       kernel_width);
+
+        std::vector<I> input_wide(input.begin(), input.end());
+        std::vector<I> kernels_wide(kernels.begin(), kernels.end());
+
+        const size_t out_height = (height + 2 * padding - kernel_height) / stride + 1;
+        const size_t out_width = (width + 2 * padding - kernel_width) / stride + 1;
+
+        THEN("The result matches the direct computation")
+        {
+            std::vector<I> output(out_channels * out_height * out_width);
+            conv2d<Strategy>(input_wide.data(), channels, height, width, kernels_wide.data(),
+                             out_channels, kernel_height, kernel_width, output.data(),
+                             conv2d_parameters{stride, padding});
+
+            for (size_t oc = 0; oc < out_channels; ++oc)
+            {
+                for (size_t oh = 0; oh < out_height; ++oh)
+                {
+                    for (size_t ow = 0; ow < out_width; ++ow)
+                    {
+                        I expected = I::zero();
+                        for (size_t ch = 0; ch < channels; ++ch)
+                        {
+                            for (size_t kh = 0; kh < kernel_height; ++kh)
+                            {
+                                for (size_t kw = 0; kw < kernel_width; ++kw)
+                                {
+                                    const auto y = static_cast<long>(oh * stride + kh) -
+                                                   static_cast<long>(padding);
+                                    const auto x = static_cast<long>(ow * stride + kw) -
+                                                   static_cast<long>(padding);
+                                    if (y < 0 || x < 0 || y >= static_cast<long>(height) ||
+                                        x >= static_cast<long>(width))
+                                    {
+                                        continue;
+                                    }
+                                    const auto& value =
+                                        input_wide[(ch * height + static_cast<size_t>(y)) * width +
+                                                   static_cast<size_t>(x)];
+                                    const auto& weight =
+                                        kernels_wide[((oc * channels + ch) * kernel_height + kh) *
+                                                         kernel_width +
+                                                     kw];
+                                    expected = add(expected, mul(value, weight));
+                                }
+                            }
+                        }
+                        REQUIRE(output[(oc * out_height + oh) * out_width + ow] == expected);
+                    }
+                }
+            }
+        }
+    }
+
+    WHEN("The kernel is larger than the padded image")
+    {
+        std::vector<I> image(4, I::zero());
+        std::vector<I> kernel(9, I::zero());
+        std::vector<I> output(1);
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(conv2d<Strategy>(image.data(), 1, 2, 2, kernel.data(), 1, 3, 3,
+                                               output.data()),
+                              std::invalid_argument);
+        }
+    }
+}